@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Arduino.h (host build)
+ * Subset of the Arduino-ESP32 core for building the firmware on Linux.
+ *
+ * Time: millis()/micros() count from the program start. With
+ * host_fast_delay, delay() advances a virtual clock instead of sleeping,
+ * and the emulated LCD bus time (host_lcd.h) is added to the same clock.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdarg.h>
+#include <string>
+#include <atomic>
+#include <algorithm>
+#include "pgmspace.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// like the ESP32 core: min/max from the standard library, constrain as macro
+using std::min;
+using std::max;
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long howmax);
+long random(long howmin, long howmax);
+uint32_t esp_random();
+
+// host clock control
+extern bool host_fast_delay;
+// advance the clock without sleeping (emulated bus time)
+void host_advance_clock(uint64_t us);
+
+size_t host_strlcpy(char *dst, const char *src, size_t size);
+#define strlcpy host_strlcpy
+
+class String {
+ public:
+  String(const char *c = "") : s(c ? c : "") {}
+  String(const std::string &v) : s(v) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned int v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  unsigned int length() const { return s.size(); }
+  const char *c_str() const { return s.c_str(); }
+  bool startsWith(const char *p) const { return s.rfind(p, 0) == 0; }
+  bool startsWith(const String &p) const { return s.rfind(p.s, 0) == 0; }
+  bool endsWith(const char *p) const;
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const char *p, unsigned int from = 0) const;
+  int indexOf(const String &p, unsigned int from = 0) const { return indexOf(p.c_str(), from); }
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+  long toInt() const { return strtol(s.c_str(), NULL, 10); }
+  float toFloat() const { return strtof(s.c_str(), NULL); }
+  bool equals(const char *p) const { return s == p; }
+  bool operator==(const char *p) const { return s == p; }
+  bool operator==(const String &p) const { return s == p.s; }
+  bool operator!=(const char *p) const { return s != p; }
+  char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  char charAt(unsigned int i) const { return (*this)[i]; }
+  String &operator+=(char c) { s += c; return *this; }
+  String &operator+=(const char *p) { s += p; return *this; }
+  String &operator+=(const String &p) { s += p.s; return *this; }
+  String operator+(const char *p) const { return String(s + p); }
+  String operator+(const String &p) const { return String(s + p.s); }
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+ private:
+  std::string s;
+};
+
+class IPAddress;
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *data, size_t len);
+  size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+  size_t write(const char *data, size_t len) { return write((const uint8_t *)data, len); }
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &str) { return write(str.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = 10) { return print((long)v, base); }
+  size_t print(unsigned int v, int base = 10) { return print((unsigned long)v, base); }
+  size_t print(long v, int base = 10);
+  size_t print(unsigned long v, int base = 10);
+  size_t print(double v, int digits = 2);
+  size_t print(const IPAddress &ip);
+  size_t println() { return write("\r\n"); }
+  template<typename T> size_t println(const T &v) { size_t n = print(v); return n + println(); }
+  template<typename T> size_t println(const T &v, int arg) { size_t n = print(v, arg); return n + println(); }
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long ms) { timeout = ms; }
+ protected:
+  unsigned long timeout = 1000;
+};
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *data, size_t len) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override;
+};
+
+extern HardwareSerial Serial;
+
+class IPAddress {
+ public:
+  IPAddress() : addr(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+  explicit IPAddress(uint32_t a) : addr(a) {}
+  // bytes in network order, like on the ESP32
+  operator uint32_t() const { return addr; }
+  uint8_t operator[](int i) const { return (addr >> (8 * i)) & 0xFF; }
+  String toString() const;
+ private:
+  uint32_t addr;
+};
+
+// memory of the host: PSRAM is always "found" unless disabled (--no-psram)
+extern bool host_psram;
+bool psramFound();
+void *ps_malloc(size_t size);
+void *ps_calloc(size_t n, size_t size);
+
+struct EspClass {
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getFreePsram();
+  uint32_t getMaxAllocHeap();
+  uint32_t getCpuFreqMHz() { return 240; }
+};
+extern EspClass ESP;
+
+#include "freertos/FreeRTOS.h"
+
+#endif
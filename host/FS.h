@@ -0,0 +1,88 @@
+/******************************************************************************
+ * FS.h (host build)
+ * Arduino-ESP32 file system interface on a directory of the host.
+ *
+ * Every FS has a root directory; "/gauge_0.bmp" on SD is the file
+ * gauge_0.bmp in the SD directory (host_sd/ by default). Files opened for
+ * writing ("w", "a", "r+") behave like on the ESP32 VFS.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+#include <time.h>
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+enum SeekMode {
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+namespace fs {
+
+struct FileImpl;
+
+class File : public Stream {
+ public:
+  File() {}
+  explicit File(std::shared_ptr<FileImpl> impl) : impl(impl) {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t read(uint8_t *buf, size_t size);
+  void flush() override;
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void close();
+  operator bool() const;
+  const char *name() const;
+  bool isDirectory();
+  File openNextFile(const char *mode = FILE_READ);
+  void rewindDirectory();
+  time_t getLastWrite();
+ private:
+  std::shared_ptr<FileImpl> impl;
+};
+
+class FS {
+ public:
+  explicit FS(const char *root) : root(root) {}
+  File open(const char *path, const char *mode = FILE_READ);
+  File open(const String &path, const char *mode = FILE_READ) { return open(path.c_str(), mode); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool rename(const String &from, const String &to) { return rename(from.c_str(), to.c_str()); }
+  bool mkdir(const char *path);
+  bool mkdir(const String &path) { return mkdir(path.c_str()); }
+  bool rmdir(const char *path);
+  // host directory of the file system
+  void set_root(const char *dir) { root = dir; }
+  const char *root_dir() const { return root.c_str(); }
+  std::string host_path(const char *path) const;
+ protected:
+  std::string root;
+  uint64_t bytes_total();
+  uint64_t bytes_free();
+};
+
+}
+
+using fs::File;
+using fs::FS;
+
+#endif
@@ -0,0 +1,30 @@
+/******************************************************************************
+ * Free_Fonts.h (host build)
+ * FF1..FF4 as used by the firmware (FreeMono 9/12/18/24 pt).
+ *
+ * With -DHOST_REAL_FONTS, the font data of the M5Stack library is used
+ * (add its src/Fonts directory to the include path). Otherwise the fonts
+ * are boxes with the same metrics, see host_lcd.h.
+ ******************************************************************************/
+#ifndef HOST_FREE_FONTS_H
+#define HOST_FREE_FONTS_H
+
+#include "host_lcd.h"
+
+#ifdef HOST_REAL_FONTS
+#include <GFXFF/FreeMono9pt7b.h>
+#include <GFXFF/FreeMono12pt7b.h>
+#include <GFXFF/FreeMono18pt7b.h>
+#include <GFXFF/FreeMono24pt7b.h>
+#define FF1 &FreeMono9pt7b
+#define FF2 &FreeMono12pt7b
+#define FF3 &FreeMono18pt7b
+#define FF4 &FreeMono24pt7b
+#else
+extern const GFXfont *FF1;
+extern const GFXfont *FF2;
+extern const GFXfont *FF3;
+extern const GFXfont *FF4;
+#endif
+
+#endif
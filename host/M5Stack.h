@@ -0,0 +1,60 @@
+/******************************************************************************
+ * M5Stack.h (host build)
+ * M5Stack library interface on top of the framebuffer LCD (host_lcd.h).
+ *
+ * The buttons are pressed by the host program (keys a, b, c on stdin or
+ * the benchmark) with host_press_button(); a press is held for
+ * HOST_BUTTON_HOLD_MS, long enough for the debouncing of the firmware.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef HOST_M5STACK_H
+#define HOST_M5STACK_H
+
+#include <Arduino.h>
+#include "SD.h"
+#include "host_lcd.h"
+
+#define HOST_BUTTON_HOLD_MS 50
+
+class Button {
+ public:
+  bool isPressed();
+  bool isReleased() { return !isPressed(); }
+  bool wasPressed() { return pressed_edge; }
+  bool wasReleased() { return released_edge; }
+  bool pressedFor(uint32_t ms);
+  bool read() { return isPressed(); }
+  // host side
+  void press(uint32_t hold_ms);
+  void update();
+ private:
+  unsigned long release_ms = 0;
+  unsigned long press_ms = 0;
+  bool state = false;
+  bool pressed_edge = false;
+  bool released_edge = false;
+};
+
+class M5Power {
+ public:
+  bool begin() { return true; }
+  int8_t getBatteryLevel() { return 75; }
+  bool isCharging() { return false; }
+};
+
+class M5Stack_ {
+ public:
+  void begin(bool lcd = true, bool sd = true, bool serial = true, bool i2c = false);
+  void update();
+  TFT_eSPI Lcd;
+  Button BtnA, BtnB, BtnC;
+  M5Power Power;
+};
+
+extern M5Stack_ M5;
+
+// press button 'A', 'B' or 'C'
+void host_press_button(char button, uint32_t hold_ms = HOST_BUTTON_HOLD_MS);
+
+#endif
@@ -0,0 +1,34 @@
+/******************************************************************************
+ * Preferences.h (host build)
+ * NVS key-value storage of the ESP32, one text file per namespace in the
+ * directory host_nvs/ ("key=value" lines). Only integer values are
+ * supported. Every put writes the file (like a commit of the NVS).
+ ******************************************************************************/
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+
+class Preferences {
+ public:
+  bool begin(const char *name, bool read_only = false);
+  void end();
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+  uint32_t getUInt(const char *key, uint32_t default_value = 0);
+  size_t putUInt(const char *key, uint32_t value);
+  uint64_t getULong64(const char *key, uint64_t default_value = 0);
+  size_t putULong64(const char *key, uint64_t value);
+
+ private:
+  bool save();
+  std::string path;
+  std::map<std::string, uint64_t> values;
+  bool started = false;
+  bool read_only = false;
+};
+
+#endif
@@ -0,0 +1,22 @@
+/******************************************************************************
+ * SD.h (host build)
+ * SD card in the directory host_sd/ (option --sd of the host program).
+ ******************************************************************************/
+#ifndef HOST_SD_H
+#define HOST_SD_H
+
+#include "FS.h"
+
+class SDFS : public fs::FS {
+ public:
+  SDFS() : FS("host_sd") {}
+  bool begin() { return mkdir("/") || exists("/"); }
+  void end() {}
+  uint64_t cardSize() { return bytes_total(); }
+  uint64_t totalBytes() { return bytes_total(); }
+  uint64_t usedBytes() { return bytes_total() - bytes_free(); }
+};
+
+extern SDFS SD;
+
+#endif
@@ -0,0 +1,21 @@
+/******************************************************************************
+ * SPIFFS.h (host build)
+ * SPIFFS in the directory host_spiffs/.
+ ******************************************************************************/
+#ifndef HOST_SPIFFS_H
+#define HOST_SPIFFS_H
+
+#include "FS.h"
+
+class SPIFFSFS : public fs::FS {
+ public:
+  SPIFFSFS() : FS("host_spiffs") {}
+  bool begin(bool format_on_fail = false) { (void)format_on_fail; return mkdir("/") || exists("/"); }
+  void end() {}
+  size_t totalBytes() { return bytes_total(); }
+  size_t usedBytes() { return bytes_total() - bytes_free(); }
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * WiFi.h (host build)
+ * WiFi station and TCP server/client on POSIX sockets.
+ *
+ * The station is connected as soon as WiFi.begin() is called, with the
+ * address 127.0.0.1. WiFiServer listens on all interfaces; ports below
+ * 1024 are moved by HOST_PORT_OFFSET (80 -> 8080) so no root rights are
+ * needed, or the port is set with the environment variable HOST_HTTP_PORT.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+#include <memory>
+
+#define HOST_PORT_OFFSET 8000
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL,
+  WL_SCAN_COMPLETED,
+  WL_CONNECTED,
+  WL_CONNECT_FAILED,
+  WL_CONNECTION_LOST,
+  WL_DISCONNECTED
+} wl_status_t;
+
+#define WIFI_OFF 0
+#define WIFI_STA 1
+#define WIFI_AP 2
+
+struct host_socket_t;
+
+class WiFiClient : public Stream {
+ public:
+  WiFiClient() {}
+  explicit WiFiClient(int fd);
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  size_t write_P(const char *buf, size_t size) { return write((const uint8_t *)buf, size); }
+  int available() override;
+  int read() override;
+  int read(uint8_t *buf, size_t size);
+  int peek() override;
+  void flush() override {}
+  uint8_t connected();
+  void stop();
+  operator bool() { return connected(); }
+  bool operator==(const WiFiClient &other) const { return sock == other.sock; }
+  bool operator!=(const WiFiClient &other) const { return sock != other.sock; }
+  int setNoDelay(bool nodelay);
+  bool getNoDelay();
+  void setTimeout(uint32_t seconds);
+  IPAddress remoteIP();
+  uint16_t remotePort();
+  int fd() const;
+ private:
+  std::shared_ptr<host_socket_t> sock;
+};
+
+class WiFiServer {
+ public:
+  explicit WiFiServer(uint16_t port) : port(port), listen_fd(-1) {}
+  void begin();
+  WiFiClient available();
+  // a connection is waiting to be accepted
+  bool hasClient();
+  void setNoDelay(bool nodelay) { (void)nodelay; }
+  void stop();
+  // port on the host
+  uint16_t host_port() const;
+ private:
+  uint16_t port;
+  int listen_fd;
+};
+
+class WiFiClass {
+ public:
+  void mode(int m) { (void)m; }
+  void disconnect() { state = WL_DISCONNECTED; }
+  void begin(const char *ssid, const char *key) { (void)ssid; (void)key; state = WL_CONNECTED; }
+  wl_status_t status() { return state; }
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  int8_t RSSI() { return -55; }
+ private:
+  wl_status_t state = WL_DISCONNECTED;
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,5 @@
+/******************************************************************************
+ * WiFiClientSecure.h (host build)
+ * Not used by the firmware, the WiFi interface is enough.
+ ******************************************************************************/
+#include "WiFi.h"
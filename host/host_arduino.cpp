@@ -0,0 +1,436 @@
+/******************************************************************************
+ * host_arduino.cpp
+ * Arduino core, FreeRTOS tasks and M5Stack board for the host build.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <M5Stack.h>
+#include <WiFi.h>
+#include <SPIFFS.h>
+#include "freertos/queue.h"
+#include <unistd.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+M5Stack_ M5;
+SDFS SD;
+SPIFFSFS SPIFFS;
+WiFiClass WiFi;
+
+bool host_fast_delay = false;
+bool host_psram = true;
+
+static const std::chrono::steady_clock::time_point clock_start = std::chrono::steady_clock::now();
+// virtual time added by delay() (--fast-delay) and by the emulated LCD bus
+static std::atomic<uint64_t> clock_offset_us(0);
+
+
+/***************************************************************************************
+* Time
+***************************************************************************************/
+static uint64_t host_micros(){
+  auto elapsed = std::chrono::steady_clock::now() - clock_start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + clock_offset_us.load();
+}
+
+
+unsigned long micros(){
+  return (unsigned long)(uint32_t)host_micros();
+}
+
+
+unsigned long millis(){
+  return (unsigned long)(uint32_t)(host_micros() / 1000);
+}
+
+
+void host_advance_clock(uint64_t us){
+  clock_offset_us += us;
+}
+
+
+void delay(unsigned long ms){
+  if(host_fast_delay)
+    host_advance_clock((uint64_t)ms * 1000);
+  else
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+
+void delayMicroseconds(unsigned int us){
+  if(host_fast_delay)
+    host_advance_clock(us);
+  else
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+
+void yield(){
+  std::this_thread::yield();
+}
+
+
+long random(long howmax){
+  if(howmax <= 0)
+    return 0;
+  return rand() % howmax;
+}
+
+
+long random(long howmin, long howmax){
+  if(howmin >= howmax)
+    return howmin;
+  return howmin + random(howmax - howmin);
+}
+
+
+uint32_t esp_random(){
+  return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+
+size_t host_strlcpy(char *dst, const char *src, size_t size){
+  size_t len = strlen(src);
+  if(size){
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return len;
+}
+
+
+/***************************************************************************************
+* Memory
+***************************************************************************************/
+bool psramFound(){
+  return host_psram;
+}
+
+
+void *ps_malloc(size_t size){
+  return host_psram ? malloc(size) : NULL;
+}
+
+
+void *ps_calloc(size_t n, size_t size){
+  return host_psram ? calloc(n, size) : NULL;
+}
+
+
+// typical values of the M5Stack Fire with the firmware running
+uint32_t EspClass::getFreeHeap(){ return 180000; }
+uint32_t EspClass::getMinFreeHeap(){ return 150000; }
+uint32_t EspClass::getFreePsram(){ return host_psram ? 4000000 : 0; }
+uint32_t EspClass::getMaxAllocHeap(){ return 110000; }
+
+
+/***************************************************************************************
+* String
+***************************************************************************************/
+bool String::endsWith(const char *p) const {
+  size_t n = strlen(p);
+  return s.size() >= n && s.compare(s.size() - n, n, p) == 0;
+}
+
+
+int String::indexOf(char c, unsigned int from) const {
+  size_t pos = s.find(c, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+
+int String::indexOf(const char *p, unsigned int from) const {
+  size_t pos = s.find(p, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+
+String String::substring(unsigned int from) const {
+  return from >= s.size() ? String() : String(s.substr(from));
+}
+
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if(from > to){
+    unsigned int t = from; from = to; to = t;
+  }
+  if(from >= s.size())
+    return String();
+  return String(s.substr(from, to - from));
+}
+
+
+void String::toLowerCase(){
+  for(auto &c : s)
+    c = tolower((unsigned char)c);
+}
+
+
+void String::toUpperCase(){
+  for(auto &c : s)
+    c = toupper((unsigned char)c);
+}
+
+
+void String::trim(){
+  size_t start = s.find_first_not_of(" \t\r\n");
+  if(start == std::string::npos){
+    s.clear();
+    return;
+  }
+  size_t end = s.find_last_not_of(" \t\r\n");
+  s = s.substr(start, end - start + 1);
+}
+
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+  return String(buf);
+}
+
+
+/***************************************************************************************
+* Print
+***************************************************************************************/
+size_t Print::write(const uint8_t *data, size_t len){
+  size_t n = 0;
+  while(len--)
+    n += write(*data++);
+  return n;
+}
+
+
+size_t Print::print(long v, int base){
+  char buf[68];
+  if(base == 10)
+    snprintf(buf, sizeof(buf), "%ld", v);
+  else
+    return print((unsigned long)v, base);
+  return write(buf);
+}
+
+
+size_t Print::print(unsigned long v, int base){
+  char buf[68];
+  char *p = buf + sizeof(buf) - 1;
+  *p = 0;
+  if(base < 2)
+    base = 10;
+  do {
+    int digit = v % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    v /= base;
+  } while(v);
+  return write(p);
+}
+
+
+size_t Print::print(double v, int digits){
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", digits, v);
+  return write(buf);
+}
+
+
+size_t Print::print(const IPAddress &ip){
+  return print(ip.toString());
+}
+
+
+size_t Print::printf(const char *format, ...){
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if(len < 0)
+    return 0;
+  if((size_t)len < sizeof(buf))
+    return write((const uint8_t *)buf, len);
+  std::string big(len + 1, 0);
+  va_start(args, format);
+  vsnprintf(&big[0], big.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)big.data(), len);
+}
+
+
+size_t HardwareSerial::write(uint8_t c){
+  return fwrite(&c, 1, 1, stdout);
+}
+
+
+size_t HardwareSerial::write(const uint8_t *data, size_t len){
+  return fwrite(data, 1, len, stdout);
+}
+
+
+void HardwareSerial::flush(){
+  fflush(stdout);
+}
+
+
+/***************************************************************************************
+* FreeRTOS
+* Every task is a detached thread. The core and the priority are ignored.
+***************************************************************************************/
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stack_depth,
+                                   void *parameter, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core){
+  (void)name; (void)stack_depth; (void)priority; (void)core;
+  std::thread *t = new std::thread(task, parameter);
+  if(handle)
+    *handle = t;
+  t->detach();
+  return pdPASS;
+}
+
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char *name, uint32_t stack_depth,
+                       void *parameter, UBaseType_t priority, TaskHandle_t *handle){
+  return xTaskCreatePinnedToCore(task, name, stack_depth, parameter, priority, handle, 0);
+}
+
+
+void vTaskDelay(TickType_t ticks){
+  // real time, tasks are not affected by --fast-delay
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+
+void vTaskDelete(TaskHandle_t handle){
+  // only tasks deleting themselves are supported (return from the thread)
+  (void)handle;
+}
+
+
+TickType_t xTaskGetTickCount(){
+  return millis();
+}
+
+
+struct host_queue_t {
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::deque<std::vector<uint8_t>> items;
+  UBaseType_t length;
+  UBaseType_t item_size;
+};
+
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size){
+  host_queue_t *q = new host_queue_t;
+  q->length = length;
+  q->item_size = item_size;
+  return q;
+}
+
+
+// wait until the condition is true, at most ticks_to_wait ms
+template<typename Pred> static bool queue_wait(host_queue_t *q, std::unique_lock<std::mutex> &lock,
+                                               TickType_t ticks_to_wait, Pred pred){
+  if(ticks_to_wait == portMAX_DELAY){
+    q->changed.wait(lock, pred);
+    return true;
+  }
+  return q->changed.wait_for(lock, std::chrono::milliseconds(ticks_to_wait), pred);
+}
+
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait){
+  host_queue_t *q = (host_queue_t *) queue;
+  std::unique_lock<std::mutex> lock(q->mutex);
+  if(!queue_wait(q, lock, ticks_to_wait, [q]{ return q->items.size() < q->length; }))
+    return pdFALSE;
+  const uint8_t *p = (const uint8_t *) item;
+  q->items.emplace_back(p, p + q->item_size);
+  q->changed.notify_all();
+  return pdTRUE;
+}
+
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks_to_wait){
+  host_queue_t *q = (host_queue_t *) queue;
+  std::unique_lock<std::mutex> lock(q->mutex);
+  if(!queue_wait(q, lock, ticks_to_wait, [q]{ return !q->items.empty(); }))
+    return pdFALSE;
+  memcpy(item, q->items.front().data(), q->item_size);
+  q->items.pop_front();
+  q->changed.notify_all();
+  return pdTRUE;
+}
+
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue){
+  host_queue_t *q = (host_queue_t *) queue;
+  std::lock_guard<std::mutex> lock(q->mutex);
+  return q->items.size();
+}
+
+
+void vQueueDelete(QueueHandle_t queue){
+  delete (host_queue_t *) queue;
+}
+
+
+/***************************************************************************************
+* M5Stack
+***************************************************************************************/
+void M5Stack_::begin(bool lcd, bool sd, bool serial, bool i2c){
+  (void)lcd; (void)i2c;
+  if(serial)
+    Serial.begin(115200);
+  if(sd)
+    SD.begin();
+}
+
+
+void M5Stack_::update(){
+  BtnA.update();
+  BtnB.update();
+  BtnC.update();
+}
+
+
+static std::mutex button_mutex;
+
+bool Button::isPressed(){
+  std::lock_guard<std::mutex> lock(button_mutex);
+  return (long)(millis() - release_ms) < 0;
+}
+
+
+bool Button::pressedFor(uint32_t ms){
+  return state && millis() - press_ms >= ms;
+}
+
+
+void Button::press(uint32_t hold_ms){
+  std::lock_guard<std::mutex> lock(button_mutex);
+  release_ms = millis() + hold_ms;
+}
+
+
+void Button::update(){
+  bool now = isPressed();
+  pressed_edge = now && !state;
+  released_edge = !now && state;
+  if(pressed_edge)
+    press_ms = millis();
+  state = now;
+}
+
+
+void host_press_button(char button, uint32_t hold_ms){
+  if(button == 'A' || button == 'a') M5.BtnA.press(hold_ms);
+  if(button == 'B' || button == 'b') M5.BtnB.press(hold_ms);
+  if(button == 'C' || button == 'c') M5.BtnC.press(hold_ms);
+}
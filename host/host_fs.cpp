@@ -0,0 +1,239 @@
+/******************************************************************************
+ * host_fs.cpp
+ * Arduino-ESP32 file system interface on a directory of the host.
+ * See FS.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include <FS.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace fs {
+
+struct FileImpl {
+  FILE *file = NULL;
+  DIR *dir = NULL;
+  // path in the file system ("/dir/name.bmp") and on the host
+  std::string path;
+  std::string host_path;
+  const FS *owner = NULL;
+  ~FileImpl() {
+    if(file)
+      fclose(file);
+    if(dir)
+      closedir(dir);
+  }
+};
+
+
+std::string FS::host_path(const char *path) const {
+  std::string p = root;
+  if(!path || path[0] != '/')
+    p += '/';
+  if(path)
+    p += path;
+  return p;
+}
+
+
+File FS::open(const char *path, const char *mode){
+  std::string hp = host_path(path);
+  auto impl = std::make_shared<FileImpl>();
+  impl->path = path;
+  impl->host_path = hp;
+  impl->owner = this;
+  struct stat st;
+  if(stat(hp.c_str(), &st) == 0 && S_ISDIR(st.st_mode)){
+    impl->dir = opendir(hp.c_str());
+    if(!impl->dir)
+      return File();
+    return File(impl);
+  }
+  std::string m = mode;
+  // binary mode, "r+" keeps its meaning
+  m += 'b';
+  impl->file = fopen(hp.c_str(), m.c_str());
+  if(!impl->file)
+    return File();
+  return File(impl);
+}
+
+
+bool FS::exists(const char *path){
+  struct stat st;
+  return stat(host_path(path).c_str(), &st) == 0;
+}
+
+
+bool FS::remove(const char *path){
+  return unlink(host_path(path).c_str()) == 0;
+}
+
+
+bool FS::rename(const char *from, const char *to){
+  return ::rename(host_path(from).c_str(), host_path(to).c_str()) == 0;
+}
+
+
+bool FS::mkdir(const char *path){
+  std::string hp = host_path(path);
+  // create the parent directories (root included)
+  for(size_t pos = 1; (pos = hp.find('/', pos)) != std::string::npos; pos++)
+    ::mkdir(hp.substr(0, pos).c_str(), 0755);
+  return ::mkdir(hp.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+
+bool FS::rmdir(const char *path){
+  return ::rmdir(host_path(path).c_str()) == 0;
+}
+
+
+uint64_t FS::bytes_total(){
+  struct statvfs sv;
+  if(statvfs(root.c_str(), &sv) != 0)
+    return 0;
+  return (uint64_t)sv.f_blocks * sv.f_frsize;
+}
+
+
+uint64_t FS::bytes_free(){
+  struct statvfs sv;
+  if(statvfs(root.c_str(), &sv) != 0)
+    return 0;
+  return (uint64_t)sv.f_bavail * sv.f_frsize;
+}
+
+
+size_t File::write(uint8_t c){
+  return write(&c, 1);
+}
+
+
+size_t File::write(const uint8_t *buf, size_t size){
+  if(!impl || !impl->file)
+    return 0;
+  return fwrite(buf, 1, size, impl->file);
+}
+
+
+int File::available(){
+  if(!impl || !impl->file)
+    return 0;
+  return size() - position();
+}
+
+
+int File::read(){
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+
+size_t File::read(uint8_t *buf, size_t size){
+  if(!impl || !impl->file)
+    return 0;
+  return fread(buf, 1, size, impl->file);
+}
+
+
+int File::peek(){
+  if(!impl || !impl->file)
+    return -1;
+  int c = fgetc(impl->file);
+  if(c != EOF)
+    ungetc(c, impl->file);
+  return c == EOF ? -1 : c;
+}
+
+
+void File::flush(){
+  if(impl && impl->file)
+    fflush(impl->file);
+}
+
+
+bool File::seek(uint32_t pos, SeekMode mode){
+  if(!impl || !impl->file)
+    return false;
+  int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+  return fseek(impl->file, pos, whence) == 0;
+}
+
+
+size_t File::position() const {
+  if(!impl || !impl->file)
+    return 0;
+  return ftell(impl->file);
+}
+
+
+size_t File::size() const {
+  if(!impl)
+    return 0;
+  if(impl->file)
+    fflush(impl->file);
+  struct stat st;
+  if(stat(impl->host_path.c_str(), &st) != 0)
+    return 0;
+  return st.st_size;
+}
+
+
+void File::close(){
+  impl.reset();
+}
+
+
+File::operator bool() const {
+  return impl && (impl->file || impl->dir);
+}
+
+
+const char *File::name() const {
+  return impl ? impl->path.c_str() : "";
+}
+
+
+bool File::isDirectory(){
+  return impl && impl->dir;
+}
+
+
+File File::openNextFile(const char *mode){
+  if(!impl || !impl->dir)
+    return File();
+  struct dirent *entry;
+  while((entry = readdir(impl->dir)) != NULL){
+    if(strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+      continue;
+    std::string path = impl->path;
+    if(path.empty() || path.back() != '/')
+      path += '/';
+    path += entry->d_name;
+    return const_cast<FS *>(impl->owner)->open(path.c_str(), mode);
+  }
+  return File();
+}
+
+
+void File::rewindDirectory(){
+  if(impl && impl->dir)
+    rewinddir(impl->dir);
+}
+
+
+time_t File::getLastWrite(){
+  if(!impl)
+    return 0;
+  struct stat st;
+  if(stat(impl->host_path.c_str(), &st) != 0)
+    return 0;
+  return st.st_mtime;
+}
+
+}
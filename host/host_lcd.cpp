@@ -0,0 +1,649 @@
+/******************************************************************************
+ * host_lcd.cpp
+ * Framebuffer implementation of the TFT_eSPI interface for the host build.
+ * See host_lcd.h for a description.
+ *
+ * The drawing algorithms follow the TFT_eSPI library, so the pixels and
+ * the address windows sent for a call are the same as on the device.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "M5Stack.h"
+#include "Free_Fonts.h"
+
+host_lcd_config_t host_lcd_config = { 40000000, 16000000, false };
+host_lcd_cost_t host_lcd_cost[LCD_OPS];
+// bytes of one address window: CASET + 4, RASET + 4, RAMWR
+#define LCD_WINDOW_BYTES 11
+// dummy byte before the pixel data of a read
+#define LCD_READ_DUMMY_BYTES 1
+
+static const char *op_names[LCD_OPS] = {
+  "setWindow", "pushImage", "pushColors", "fillRect", "drawLine", "fillTriangle",
+  "fillCircle", "drawXBitmap", "drawString", "drawPixel", "readRect"
+};
+
+static inline void swap32(int32_t &a, int32_t &b){
+  int32_t t = a; a = b; b = t;
+}
+
+
+/***************************************************************************************
+* Fallback fonts
+* Outlined boxes with the metrics of FreeMono 9/12/18/24 pt, built at startup.
+***************************************************************************************/
+#ifndef HOST_REAL_FONTS
+struct box_font_t {
+  GFXfont font;
+  GFXglyph glyphs[0x7E - 0x20 + 1];
+  uint8_t *bitmap;
+};
+
+static GFXfont *make_box_font(box_font_t &f, uint8_t x_advance, uint8_t y_advance){
+  uint8_t w = x_advance * 6 / 10;
+  uint8_t h = y_advance * 6 / 10;
+  f.bitmap = (uint8_t *) calloc((w * h + 7) / 8, 1);
+  for(int y=0; y<h; y++){
+    for(int x=0; x<w; x++){
+      if(x == 0 || y == 0 || x == w-1 || y == h-1){
+        int bit = y * w + x;
+        f.bitmap[bit / 8] |= 0x80 >> (bit & 7);
+      }
+    }
+  }
+  for(int c=0x20; c<=0x7E; c++){
+    GFXglyph &g = f.glyphs[c - 0x20];
+    bool blank = (c == ' ');
+    g.bitmapOffset = 0;
+    g.width = blank ? 0 : w;
+    g.height = blank ? 0 : h;
+    g.xAdvance = x_advance;
+    g.xOffset = (x_advance - w) / 2;
+    g.yOffset = -h;
+  }
+  f.font.bitmap = f.bitmap;
+  f.font.glyph = f.glyphs;
+  f.font.first = 0x20;
+  f.font.last = 0x7E;
+  f.font.yAdvance = y_advance;
+  return &f.font;
+}
+
+static box_font_t box_fonts[4];
+const GFXfont *FF1 = make_box_font(box_fonts[0], 11, 18);
+const GFXfont *FF2 = make_box_font(box_fonts[1], 14, 24);
+const GFXfont *FF3 = make_box_font(box_fonts[2], 21, 35);
+const GFXfont *FF4 = make_box_font(box_fonts[3], 28, 47);
+#endif
+
+
+/***************************************************************************************
+* Function name:          font_metrics
+* Description:            ascent and descent of a font over all glyphs (like the
+*                         glyph_ab and glyph_bb values of TFT_eSPI::setFreeFont)
+***************************************************************************************/
+static void font_metrics(const GFXfont *f, int &ab, int &bb){
+  ab = 0;
+  bb = 0;
+  for(int c=f->first; c<=f->last; c++){
+    const GFXglyph &g = f->glyph[c - f->first];
+    int a = -g.yOffset;
+    if(a > ab) ab = a;
+    int b = g.height - a;
+    if(b > bb) bb = b;
+  }
+}
+
+
+/***************************************************************************************
+* SPI cost accounting
+***************************************************************************************/
+void host_lcd_reset_cost(){
+  memset(host_lcd_cost, 0, sizeof(host_lcd_cost));
+}
+
+
+host_lcd_cost_t host_lcd_total(){
+  host_lcd_cost_t total = {0, 0, 0, 0};
+  for(int i=0; i<LCD_OPS; i++){
+    total.calls += host_lcd_cost[i].calls;
+    total.pixels += host_lcd_cost[i].pixels;
+    total.bytes += host_lcd_cost[i].bytes;
+    total.bus_us += host_lcd_cost[i].bus_us;
+  }
+  return total;
+}
+
+
+void host_lcd_report(FILE *out){
+  fprintf(out, "%-13s %8s %10s %10s %10s\n", "call", "calls", "pixels", "bytes", "bus ms");
+  for(int i=0; i<LCD_OPS; i++){
+    const host_lcd_cost_t &c = host_lcd_cost[i];
+    if(c.calls == 0 && c.bytes == 0)
+      continue;
+    fprintf(out, "%-13s %8u %10llu %10llu %10.2f\n", op_names[i], (unsigned)c.calls,
+            (unsigned long long)c.pixels, (unsigned long long)c.bytes, c.bus_us / 1000.0);
+  }
+  host_lcd_cost_t t = host_lcd_total();
+  fprintf(out, "%-13s %8u %10llu %10llu %10.2f  (SPI %.0f MHz)\n", "total", (unsigned)t.calls,
+          (unsigned long long)t.pixels, (unsigned long long)t.bytes, t.bus_us / 1000.0,
+          host_lcd_config.spi_write_hz / 1e6);
+}
+
+
+bool host_lcd_save_ppm(const char *path){
+  FILE *f = fopen(path, "wb");
+  if(!f)
+    return false;
+  const uint16_t *fb = M5.Lcd.frame_buffer();
+  int w = M5.Lcd.width();
+  int h = M5.Lcd.height();
+  fprintf(f, "P6\n%d %d\n255\n", w, h);
+  for(int i=0; i<w*h; i++){
+    uint16_t c = fb[i];
+    uint8_t rgb[3] = { (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3) };
+    fwrite(rgb, 1, 3, f);
+  }
+  fclose(f);
+  return true;
+}
+
+
+/***************************************************************************************
+* TFT_eSPI
+***************************************************************************************/
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+  : lcd_order(false), accounted(true), pixels(NULL), _width(w), _height(h),
+    swap_bytes(false), brightness(255), font(NULL), text_datum(TL_DATUM), text_size(1),
+    text_color(TFT_WHITE), cursor_x(0), cursor_y(0),
+    win_x0(0), win_y0(0), win_x1(w-1), win_y1(h-1), win_x(0), win_y(0) {
+  if(w > 0 && h > 0)
+    pixels = (uint16_t *) calloc(w * h, sizeof(uint16_t));
+}
+
+
+TFT_eSPI::~TFT_eSPI(){
+  free(pixels);
+}
+
+
+void TFT_eSPI::begin_call(host_lcd_op_t op){
+  if(accounted)
+    host_lcd_cost[op].calls++;
+}
+
+
+/***************************************************************************************
+* Function name:          account
+* Description:            add the bytes of a call to the statistics and optionally
+*                         the bus time to the clock
+***************************************************************************************/
+void TFT_eSPI::account(host_lcd_op_t op, uint32_t windows, uint64_t pixels_written, uint64_t pixels_read){
+  if(!accounted)
+    return;
+  uint64_t write_bytes = (uint64_t)windows * LCD_WINDOW_BYTES + pixels_written * 2;
+  uint64_t read_bytes = pixels_read ? pixels_read * 3 + LCD_READ_DUMMY_BYTES : 0;
+  double us = write_bytes * 8e6 / host_lcd_config.spi_write_hz
+            + read_bytes * 8e6 / host_lcd_config.spi_read_hz;
+  host_lcd_cost_t &c = host_lcd_cost[op];
+  c.pixels += pixels_written + pixels_read;
+  c.bytes += write_bytes + read_bytes;
+  c.bus_us += us;
+  if(host_lcd_config.emulate){
+    // keep the fractions of a microsecond
+    static double residue = 0;
+    residue += us;
+    uint64_t whole = (uint64_t)residue;
+    residue -= whole;
+    host_advance_clock(whole);
+  }
+}
+
+
+uint32_t TFT_eSPI::fill(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color){
+  if(!pixels)
+    return 0;
+  if(x < 0){ w += x; x = 0; }
+  if(y < 0){ h += y; y = 0; }
+  if(x + w > _width) w = _width - x;
+  if(y + h > _height) h = _height - y;
+  if(w <= 0 || h <= 0)
+    return 0;
+  uint16_t c = store(color);
+  for(int32_t row=y; row<y+h; row++){
+    uint16_t *p = pixels + row * _width + x;
+    for(int32_t i=0; i<w; i++)
+      p[i] = c;
+  }
+  return w * h;
+}
+
+
+void TFT_eSPI::span(host_lcd_op_t op, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color){
+  uint32_t n = fill(x, y, w, h, color);
+  if(n)
+    account(op, 1, n);
+}
+
+
+void TFT_eSPI::fillScreen(uint32_t color){
+  fillRect(0, 0, _width, _height, color);
+}
+
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color){
+  begin_call(LCD_OP_FILL_RECT);
+  span(LCD_OP_FILL_RECT, x, y, w, h, color);
+}
+
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color){
+  begin_call(LCD_OP_FILL_RECT);
+  span(LCD_OP_FILL_RECT, x, y, w, 1, color);
+  span(LCD_OP_FILL_RECT, x, y + h - 1, w, 1, color);
+  span(LCD_OP_FILL_RECT, x, y + 1, 1, h - 2, color);
+  span(LCD_OP_FILL_RECT, x + w - 1, y + 1, 1, h - 2, color);
+}
+
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color){
+  begin_call(LCD_OP_FILL_RECT);
+  span(LCD_OP_FILL_RECT, x, y, w, 1, color);
+}
+
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color){
+  begin_call(LCD_OP_FILL_RECT);
+  span(LCD_OP_FILL_RECT, x, y, 1, h, color);
+}
+
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color){
+  begin_call(LCD_OP_DRAW_PIXEL);
+  span(LCD_OP_DRAW_PIXEL, x, y, 1, 1, color);
+}
+
+
+/***************************************************************************************
+* Function name:          drawLine
+* Description:            Bresenham line, drawn as horizontal or vertical runs
+*                         (one address window per run, like TFT_eSPI)
+***************************************************************************************/
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color){
+  begin_call(LCD_OP_DRAW_LINE);
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if(steep){
+    swap32(x0, y0);
+    swap32(x1, y1);
+  }
+  if(x0 > x1){
+    swap32(x0, x1);
+    swap32(y0, y1);
+  }
+  int32_t dx = x1 - x0, dy = abs(y1 - y0);
+  int32_t err = dx >> 1, ystep = (y0 < y1) ? 1 : -1, xs = x0, dlen = 0;
+  for(; x0 <= x1; x0++){
+    dlen++;
+    err -= dy;
+    if(err < 0){
+      if(steep)
+        span(LCD_OP_DRAW_LINE, y0, xs, 1, dlen, color);
+      else
+        span(LCD_OP_DRAW_LINE, xs, y0, dlen, 1, color);
+      dlen = 0;
+      y0 += ystep;
+      xs = x0 + 1;
+      err += dx;
+    }
+  }
+  if(dlen){
+    if(steep)
+      span(LCD_OP_DRAW_LINE, y0, xs, 1, dlen, color);
+    else
+      span(LCD_OP_DRAW_LINE, xs, y0, dlen, 1, color);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          fillTriangle
+* Description:            scanline fill (Adafruit GFX / TFT_eSPI algorithm)
+***************************************************************************************/
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color){
+  begin_call(LCD_OP_FILL_TRIANGLE);
+  int32_t a, b, y, last;
+  // sort by y (y2 >= y1 >= y0)
+  if(y0 > y1){ swap32(y0, y1); swap32(x0, x1); }
+  if(y1 > y2){ swap32(y2, y1); swap32(x2, x1); }
+  if(y0 > y1){ swap32(y0, y1); swap32(x0, x1); }
+  if(y0 == y2){
+    a = b = x0;
+    if(x1 < a) a = x1; else if(x1 > b) b = x1;
+    if(x2 < a) a = x2; else if(x2 > b) b = x2;
+    span(LCD_OP_FILL_TRIANGLE, a, y0, b - a + 1, 1, color);
+    return;
+  }
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0;
+  int32_t dx12 = x2 - x1, dy12 = y2 - y1, sa = 0, sb = 0;
+  // include the y1 scanline only if the lower part is flat
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for(y = y0; y <= last; y++){
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if(a > b) swap32(a, b);
+    span(LCD_OP_FILL_TRIANGLE, a, y, b - a + 1, 1, color);
+  }
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for(; y <= y2; y++){
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if(a > b) swap32(a, b);
+    span(LCD_OP_FILL_TRIANGLE, a, y, b - a + 1, 1, color);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          fillCircle
+* Description:            filled circle from horizontal lines (TFT_eSPI algorithm)
+***************************************************************************************/
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color){
+  begin_call(LCD_OP_FILL_CIRCLE);
+  int32_t x = 0, dx = 1, dy = r + r, p = -(r >> 1);
+  span(LCD_OP_FILL_CIRCLE, x0 - r, y0, 2 * r + 1, 1, color);
+  while(x < r){
+    if(p >= 0){
+      span(LCD_OP_FILL_CIRCLE, x0 - x, y0 + r, 2 * x + 1, 1, color);
+      span(LCD_OP_FILL_CIRCLE, x0 - x, y0 - r, 2 * x + 1, 1, color);
+      dy -= 2;
+      p -= dy;
+      r--;
+    }
+    dx += 2;
+    p += dx;
+    x++;
+    span(LCD_OP_FILL_CIRCLE, x0 - r, y0 + x, 2 * r + 1, 1, color);
+    span(LCD_OP_FILL_CIRCLE, x0 - r, y0 - x, 2 * r + 1, 1, color);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          drawXBitmap
+* Description:            XBM bitmap (LSB first), every set bit is a drawPixel
+***************************************************************************************/
+void TFT_eSPI::drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color){
+  begin_call(LCD_OP_DRAW_XBITMAP);
+  int32_t byte_width = (w + 7) / 8;
+  for(int32_t j=0; j<h; j++){
+    for(int32_t i=0; i<w; i++){
+      if(pgm_read_byte(bitmap + j * byte_width + i / 8) & (1 << (i & 7)))
+        span(LCD_OP_DRAW_XBITMAP, x + i, y + j, 1, 1, color);
+    }
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          pushImage
+* Description:            copy an RGB565 image, one address window for the whole image
+*                         swap bytes = true: data in native byte order
+*                         swap bytes = false: data in LCD byte order
+***************************************************************************************/
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data){
+  begin_call(LCD_OP_PUSH_IMAGE);
+  if(!pixels || w <= 0 || h <= 0)
+    return;
+  int32_t dx = 0, dy = 0, dw = w, dh = h;
+  if(x < 0){ dw += x; dx = -x; x = 0; }
+  if(y < 0){ dh += y; dy = -y; y = 0; }
+  if(x + dw > _width) dw = _width - x;
+  if(y + dh > _height) dh = _height - y;
+  if(dw <= 0 || dh <= 0)
+    return;
+  for(int32_t row=0; row<dh; row++){
+    const uint16_t *src = data + (dy + row) * w + dx;
+    uint16_t *dst = pixels + (y + row) * _width + x;
+    for(int32_t i=0; i<dw; i++){
+      uint16_t c = swap_bytes ? src[i] : (uint16_t)((src[i] >> 8) | (src[i] << 8));
+      dst[i] = store(c);
+    }
+  }
+  account(LCD_OP_PUSH_IMAGE, 1, (uint64_t)dw * dh);
+}
+
+
+void TFT_eSPI::readRectRGB(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *data){
+  begin_call(LCD_OP_READ);
+  for(int32_t row=y; row<y+h; row++){
+    for(int32_t col=x; col<x+w; col++){
+      uint16_t c = readPixel(col, row);
+      *data++ = (c >> 8) & 0xF8;
+      *data++ = (c >> 3) & 0xFC;
+      *data++ = (c << 3) & 0xF8;
+    }
+  }
+  account(LCD_OP_READ, 1, 0, (uint64_t)w * h);
+}
+
+
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data){
+  begin_call(LCD_OP_READ);
+  // same byte order as needed by pushImage
+  for(int32_t row=y; row<y+h; row++){
+    for(int32_t col=x; col<x+w; col++){
+      uint16_t c = readPixel(col, row);
+      *data++ = swap_bytes ? c : (uint16_t)((c >> 8) | (c << 8));
+    }
+  }
+  account(LCD_OP_READ, 1, 0, (uint64_t)w * h);
+}
+
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y){
+  if(!pixels || x < 0 || y < 0 || x >= _width || y >= _height)
+    return 0;
+  return load(pixels[y * _width + x]);
+}
+
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1){
+  begin_call(LCD_OP_WINDOW);
+  win_x0 = x0;
+  win_y0 = y0;
+  win_x1 = x1;
+  win_y1 = y1;
+  win_x = x0;
+  win_y = y0;
+  account(LCD_OP_WINDOW, 1, 0);
+}
+
+
+void TFT_eSPI::pushColor(uint16_t color){
+  pushColors(&color, 1, true);
+}
+
+
+/***************************************************************************************
+* Function name:          pushColors
+* Description:            write pixels into the address window of setWindow
+*                         swap = true: data in native byte order
+*                         swap = false: data in LCD byte order
+***************************************************************************************/
+void TFT_eSPI::pushColors(uint16_t *data, uint32_t len, bool swap){
+  begin_call(LCD_OP_PUSH_COLORS);
+  if(!pixels)
+    return;
+  for(uint32_t i=0; i<len; i++){
+    uint16_t c = swap ? data[i] : (uint16_t)((data[i] >> 8) | (data[i] << 8));
+    if(win_x >= 0 && win_y >= 0 && win_x < _width && win_y < _height)
+      pixels[win_y * _width + win_x] = store(c);
+    if(++win_x > win_x1){
+      win_x = win_x0;
+      if(++win_y > win_y1)
+        win_y = win_y0;
+    }
+  }
+  account(LCD_OP_PUSH_COLORS, 0, len);
+}
+
+
+/***************************************************************************************
+* Function name:          draw_glyph
+* Description:            draw one character of the Free Font at the baseline
+*                         Every horizontal run of set pixels is one drawFastHLine.
+* return value:           x advance
+***************************************************************************************/
+int16_t TFT_eSPI::draw_glyph(uint16_t c, int32_t x, int32_t baseline){
+  const GFXfont *f = font ? font : FF1;
+  if(c < f->first || c > f->last)
+    return 0;
+  const GFXglyph &g = f->glyph[c - f->first];
+  const uint8_t *bitmap = f->bitmap + g.bitmapOffset;
+  uint32_t bo = 0;
+  uint8_t bits = 0, bit = 0;
+  for(int yy=0; yy<g.height; yy++){
+    int run = 0;
+    int xx;
+    for(xx=0; xx<g.width; xx++){
+      if(bit == 0){
+        bits = pgm_read_byte(&bitmap[bo++]);
+        bit = 0x80;
+      }
+      if(bits & bit){
+        run++;
+      } else if(run){
+        span(LCD_OP_DRAW_STRING, x + g.xOffset + xx - run, baseline + g.yOffset + yy, run, 1, text_color);
+        run = 0;
+      }
+      bit >>= 1;
+    }
+    if(run)
+      span(LCD_OP_DRAW_STRING, x + g.xOffset + xx - run, baseline + g.yOffset + yy, run, 1, text_color);
+  }
+  return g.xAdvance;
+}
+
+
+int16_t TFT_eSPI::textWidth(const char *string){
+  const GFXfont *f = font ? font : FF1;
+  int16_t width = 0;
+  for(; *string; string++){
+    uint8_t c = *string;
+    if(c >= f->first && c <= f->last)
+      width += f->glyph[c - f->first].xAdvance;
+  }
+  return width * text_size;
+}
+
+
+int16_t TFT_eSPI::fontHeight(){
+  const GFXfont *f = font ? font : FF1;
+  return f->yAdvance * text_size;
+}
+
+
+/***************************************************************************************
+* Function name:          drawString
+* Description:            draw a string with the Free Font at the text datum
+*                         (baseline handling of TFT_eSPI for Free Fonts)
+* return value:           width of the string in pixels
+***************************************************************************************/
+int16_t TFT_eSPI::drawString(const char *string, int32_t x, int32_t y, uint8_t font_number){
+  (void)font_number;
+  begin_call(LCD_OP_DRAW_STRING);
+  const GFXfont *f = font ? font : FF1;
+  int ab, bb;
+  font_metrics(f, ab, bb);
+  int16_t cwidth = textWidth(string);
+  int32_t cheight = ab;
+  int32_t baseline = ab;
+  y += ab;
+  if(text_datum == BL_DATUM || text_datum == BC_DATUM || text_datum == BR_DATUM)
+    cheight += bb;
+  switch(text_datum){
+    case TC_DATUM: x -= cwidth/2; break;
+    case TR_DATUM: x -= cwidth; break;
+    case ML_DATUM: y -= cheight/2; break;
+    case MC_DATUM: x -= cwidth/2; y -= cheight/2; break;
+    case MR_DATUM: x -= cwidth; y -= cheight/2; break;
+    case BL_DATUM: y -= cheight; break;
+    case BC_DATUM: x -= cwidth/2; y -= cheight; break;
+    case BR_DATUM: x -= cwidth; y -= cheight; break;
+    case L_BASELINE: y -= baseline; break;
+    case C_BASELINE: x -= cwidth/2; y -= baseline; break;
+    case R_BASELINE: x -= cwidth; y -= baseline; break;
+  }
+  for(; *string; string++)
+    x += draw_glyph((uint8_t)*string, x, y);
+  return cwidth;
+}
+
+
+size_t TFT_eSPI::write(uint8_t c){
+  const GFXfont *f = font ? font : FF1;
+  if(c == '\n'){
+    cursor_x = 0;
+    cursor_y += f->yAdvance;
+  } else if(c != '\r'){
+    int ab, bb;
+    font_metrics(f, ab, bb);
+    begin_call(LCD_OP_DRAW_STRING);
+    cursor_x += draw_glyph(c, cursor_x, cursor_y + ab);
+  }
+  return 1;
+}
+
+
+/***************************************************************************************
+* TFT_eSprite
+***************************************************************************************/
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(0, 0), parent(tft) {
+  lcd_order = true;
+  accounted = false;
+}
+
+
+TFT_eSprite::~TFT_eSprite(){
+  deleteSprite();
+}
+
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames){
+  (void)frames;
+  if(pixels)
+    return pixels;
+  // in the PSRAM if available, like the library
+  pixels = (uint16_t *)(psramFound() ? ps_calloc(w * h, sizeof(uint16_t)) : calloc(w * h, sizeof(uint16_t)));
+  if(!pixels)
+    return NULL;
+  _width = w;
+  _height = h;
+  win_x1 = w - 1;
+  win_y1 = h - 1;
+  return pixels;
+}
+
+
+void TFT_eSprite::deleteSprite(){
+  free(pixels);
+  pixels = NULL;
+  _width = 0;
+  _height = 0;
+}
+
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y){
+  if(!pixels)
+    return;
+  // the sprite buffer is in LCD byte order
+  bool swap = parent->getSwapBytes();
+  parent->setSwapBytes(false);
+  parent->pushImage(x, y, _width, _height, pixels);
+  parent->setSwapBytes(swap);
+}
@@ -0,0 +1,235 @@
+/******************************************************************************
+ * host_lcd.h
+ * Framebuffer implementation of the TFT_eSPI interface for the host build.
+ *
+ * M5.Lcd is a 320x240 RGB565 frame buffer in memory. Only the functions
+ * used by the firmware are implemented, with the same results as the
+ * TFT_eSPI library (byte order of pushImage/pushColors, clipping, the
+ * scanline algorithms of fillTriangle/fillCircle and the text datums).
+ * TFT_eSprite draws into a buffer in LCD byte order, like the library.
+ *
+ * SPI cost accounting:
+ * Every call on M5.Lcd (not on sprites) is counted with the number of
+ * pixels and the bytes that the library would send over the SPI bus:
+ * 11 bytes for an address window (CASET, RASET, RAMWR) and 2 bytes per
+ * written pixel, 3 bytes per pixel for reads. The bus time is calculated
+ * with the clock rates in host_lcd_config. With emulate = true the bus
+ * time is added to the clock (micros()/millis()), so the frame scheduler
+ * and the statistics of the firmware see the time the real bus would take.
+ *
+ *   host_lcd_reset_cost();
+ *   draw_dashboard(45, 50);
+ *   host_lcd_report(stdout);
+ *
+ * Fonts: the Free Fonts of the M5Stack library are used if the build has
+ * -DHOST_REAL_FONTS and the include path of the library (Fonts/GFXFF).
+ * Otherwise FF1..FF4 are box fonts with the metrics of FreeMono 9/12/18/24,
+ * so the text has the right size and cost but is not readable.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef HOST_LCD_H
+#define HOST_LCD_H
+
+#include <Arduino.h>
+
+// colors (RGB565)
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xC618
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define BLACK           TFT_BLACK
+#define WHITE           TFT_WHITE
+#define RED             TFT_RED
+#define GREEN           TFT_GREEN
+#define BLUE            TFT_BLUE
+
+// text datums
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+#define HOST_LCD_WIDTH 320
+#define HOST_LCD_HEIGHT 240
+
+// Adafruit GFX font format (gfxfont.h)
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width, height;
+  uint8_t xAdvance;
+  int8_t xOffset, yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first, last;
+  uint8_t yAdvance;
+} GFXfont;
+
+// accounted call types
+enum host_lcd_op_t {
+  LCD_OP_WINDOW,
+  LCD_OP_PUSH_IMAGE,
+  LCD_OP_PUSH_COLORS,
+  LCD_OP_FILL_RECT,
+  LCD_OP_DRAW_LINE,
+  LCD_OP_FILL_TRIANGLE,
+  LCD_OP_FILL_CIRCLE,
+  LCD_OP_DRAW_XBITMAP,
+  LCD_OP_DRAW_STRING,
+  LCD_OP_DRAW_PIXEL,
+  LCD_OP_READ,
+  LCD_OPS
+};
+
+struct host_lcd_cost_t {
+  uint32_t calls;
+  uint64_t pixels;
+  uint64_t bytes;
+  double bus_us;
+};
+
+struct host_lcd_config_t {
+  uint32_t spi_write_hz;
+  uint32_t spi_read_hz;
+  // add the bus time to the clock
+  bool emulate;
+};
+
+extern host_lcd_config_t host_lcd_config;
+extern host_lcd_cost_t host_lcd_cost[LCD_OPS];
+
+void host_lcd_reset_cost();
+// sum over all call types
+host_lcd_cost_t host_lcd_total();
+void host_lcd_report(FILE *out);
+// save the LCD content as binary PPM
+bool host_lcd_save_ppm(const char *path);
+
+
+class TFT_eSPI : public Print {
+ public:
+  TFT_eSPI(int16_t w = HOST_LCD_WIDTH, int16_t h = HOST_LCD_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init() {}
+  void begin() {}
+  int16_t width() { return _width; }
+  int16_t height() { return _height; }
+  void setRotation(uint8_t r) { (void)r; }
+  void setBrightness(uint8_t b) { brightness = b; }
+  void setSwapBytes(bool swap) { swap_bytes = swap; }
+  bool getSwapBytes() { return swap_bytes; }
+
+  void fillScreen(uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+  void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+  void drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+  void readRectRGB(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *data);
+  void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+  uint16_t readPixel(int32_t x, int32_t y);
+
+  void startWrite() {}
+  void endWrite() {}
+  void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+  void pushColors(uint16_t *data, uint32_t len, bool swap = true);
+  void pushColor(uint16_t color);
+
+  void setTextDatum(uint8_t datum) { text_datum = datum; }
+  uint8_t getTextDatum() { return text_datum; }
+  void setFreeFont(const GFXfont *f) { font = f; }
+  void setTextFont(uint8_t f) { (void)f; font = NULL; }
+  void setTextSize(uint8_t s) { text_size = s ? s : 1; }
+  void setTextColor(uint16_t c) { text_color = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { text_color = c; (void)bg; }
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  int16_t drawString(const char *string, int32_t x, int32_t y, uint8_t font_number = 1);
+  int16_t drawString(const String &string, int32_t x, int32_t y, uint8_t font_number = 1) {
+    return drawString(string.c_str(), x, y, font_number);
+  }
+  int16_t textWidth(const char *string);
+  int16_t fontHeight();
+  // Print interface: text at the cursor
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+  // native RGB565 pixels (the LCD content), NULL for an empty sprite
+  const uint16_t *frame_buffer() const { return pixels; }
+
+ protected:
+  // pixels in LCD byte order (sprites) or native order (the LCD)
+  bool lcd_order;
+  // true: calls are accounted (the physical LCD)
+  bool accounted;
+  uint16_t *pixels;
+  int16_t _width, _height;
+  bool swap_bytes;
+  uint8_t brightness;
+  const GFXfont *font;
+  uint8_t text_datum;
+  uint8_t text_size;
+  uint16_t text_color;
+  int16_t cursor_x, cursor_y;
+  // address window of setWindow/pushColors
+  int32_t win_x0, win_y0, win_x1, win_y1, win_x, win_y;
+
+  uint16_t store(uint16_t native) const { return lcd_order ? (uint16_t)((native >> 8) | (native << 8)) : native; }
+  uint16_t load(uint16_t stored) const { return store(stored); }
+  // fill a clipped rectangle without accounting, returns the number of pixels
+  uint32_t fill(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+  // draw a span and account it as one address window with its pixels
+  void span(host_lcd_op_t op, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+  void account(host_lcd_op_t op, uint32_t windows, uint64_t pixels_written, uint64_t pixels_read = 0);
+  void begin_call(host_lcd_op_t op);
+  int16_t draw_glyph(uint16_t c, int32_t x, int32_t baseline);
+};
+
+
+class TFT_eSprite : public TFT_eSPI {
+ public:
+  explicit TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite();
+  void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  void setColorDepth(int8_t depth) { (void)depth; }
+  void *getPointer() { return pixels; }
+  bool created() { return pixels != NULL; }
+  void pushSprite(int32_t x, int32_t y);
+ private:
+  TFT_eSPI *parent;
+};
+
+#endif
@@ -0,0 +1,172 @@
+/******************************************************************************
+ * host_main.cpp
+ * Runs the firmware (src/main.cpp, unchanged) on Linux.
+ *
+ * The LCD is a frame buffer (host_lcd.h), the web server listens on port
+ * 8080 (see WiFi.h), the SD card is the directory host_sd/ and the NVS
+ * is host_nvs/ (see Preferences.h).
+ * Keys on stdin: a, b, c press the buttons, s saves host_screen.ppm,
+ * q quits.
+ *
+ * Options:
+ *   --bench            measure the drawing of the dashboard and the file
+ *                      writes and exit
+ *   --frames N         exit after N frames of the dashboard
+ *   --no-psram         run without PSRAM (no canvas, drawing on the LCD)
+ *   --spi MHZ          SPI write clock for the cost accounting (default 40)
+ *   --emulate-spi      add the SPI bus time to the clock of the firmware
+ *   --fast-delay       delay() advances the clock instead of sleeping
+ *   --sd DIR           directory of the SD card
+ *   --port N           port of the web server (instead of 8080)
+ *   --screenshot FILE  save the LCD as PPM at the end
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include <chrono>
+#include <poll.h>
+#include <unistd.h>
+#include <M5Stack.h>
+#include "capture.h"
+#include "file_writer.h"
+#include "frame.h"
+#include "widgets.h"
+
+void setup();
+void loop();
+// defined in main.cpp
+void draw_dashboard(float val_1, float val_2);
+
+// bytes counter as capture target
+class CountingPrint : public Print {
+ public:
+  size_t bytes = 0;
+  size_t write(uint8_t c) override { (void)c; bytes++; return 1; }
+  size_t write(const uint8_t *data, size_t len) override { (void)data; bytes += len; return len; }
+};
+
+static double host_now_us(){
+  using namespace std::chrono;
+  return duration_cast<duration<double, std::micro>>(steady_clock::now().time_since_epoch()).count();
+}
+
+
+/***************************************************************************************
+* Function name:          bench_dashboard
+* Description:            draw the moving needle for a number of frames, with a full
+*                         redraw of all widgets or only of the changed areas
+***************************************************************************************/
+static void bench_dashboard(bool full, int frames){
+  host_lcd_reset_cost();
+  double host_us = 0;
+  uint64_t render_pixels = 0;
+  for(int i=0; i<frames; i++){
+    float value = 50 + 40 * sinf(i * 0.1f);
+    if(full)
+      widgets_invalidate();
+    double start = host_now_us();
+    draw_dashboard(value, 50);
+    host_us += host_now_us() - start;
+    render_pixels += widgets_render_pixels;
+  }
+  host_lcd_cost_t t = host_lcd_total();
+  printf("%-8s redraw: %7.1f us host, %7llu px rendered, %7llu bytes SPI, %8.1f us bus per frame\n",
+         full ? "full" : "partial", host_us / frames, (unsigned long long)(render_pixels / frames),
+         (unsigned long long)(t.bytes / frames), t.bus_us / frames);
+}
+
+
+static void bench(){
+  const int frames = 200;
+  printf("\ndashboard, %d frames, %s, SPI %.0f MHz\n", frames,
+         psramFound() ? "canvas in PSRAM" : "direct LCD drawing", host_lcd_config.spi_write_hz / 1e6);
+  bench_dashboard(true, frames);
+  host_lcd_report(stdout);
+  bench_dashboard(false, frames);
+  host_lcd_report(stdout);
+
+  // screenshot: read the LCD and encode the BMP
+  host_lcd_reset_cost();
+  CountingPrint out;
+  double start = host_now_us();
+  M5Screen2bmp(out);
+  double host_us = host_now_us() - start;
+  host_lcd_cost_t t = host_lcd_total();
+  printf("\nscreenshot BMP: %u bytes, %.1f us host, %llu bytes SPI, %.1f us bus\n",
+         (unsigned)out.bytes, host_us, (unsigned long long)t.bytes, t.bus_us);
+
+  // write speed of the capture files (host disk instead of the SD card)
+  file_writer_benchmark(SD);
+}
+
+
+static void poll_keys(bool &quit){
+  static bool stdin_open = true;
+  struct pollfd pfd = { 0, POLLIN, 0 };
+  while(stdin_open && poll(&pfd, 1, 0) > 0){
+    char c;
+    if(read(0, &c, 1) != 1){
+      stdin_open = false;
+      break;
+    }
+    if(c == 'a' || c == 'b' || c == 'c')
+      host_press_button(c);
+    if(c == 's' && host_lcd_save_ppm("host_screen.ppm"))
+      printf("saved host_screen.ppm\n");
+    if(c == 'q')
+      quit = true;
+  }
+}
+
+
+int main(int argc, char **argv){
+  bool run_bench = false;
+  long frames = 0;
+  const char *screenshot = NULL;
+  for(int i=1; i<argc; i++){
+    const char *arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if(strcmp(arg, "--bench") == 0){
+      run_bench = true;
+      host_fast_delay = true;
+    } else if(strcmp(arg, "--frames") == 0 && has_value){
+      frames = atol(argv[++i]);
+    } else if(strcmp(arg, "--no-psram") == 0){
+      host_psram = false;
+    } else if(strcmp(arg, "--spi") == 0 && has_value){
+      host_lcd_config.spi_write_hz = atof(argv[++i]) * 1e6;
+    } else if(strcmp(arg, "--emulate-spi") == 0){
+      host_lcd_config.emulate = true;
+    } else if(strcmp(arg, "--fast-delay") == 0){
+      host_fast_delay = true;
+    } else if(strcmp(arg, "--sd") == 0 && has_value){
+      SD.set_root(argv[++i]);
+    } else if(strcmp(arg, "--port") == 0 && has_value){
+      setenv("HOST_HTTP_PORT", argv[++i], 1);
+    } else if(strcmp(arg, "--screenshot") == 0 && has_value){
+      screenshot = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--bench] [--frames N] [--no-psram] [--spi MHZ] [--emulate-spi]\n"
+                      "       [--fast-delay] [--sd DIR] [--port N] [--screenshot FILE]\n", argv[0]);
+      return 1;
+    }
+  }
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  setup();
+  if(run_bench){
+    bench();
+  } else {
+    bool quit = false;
+    while(!quit && (frames == 0 || (long)frame_stats.frames < frames)){
+      loop();
+      poll_keys(quit);
+    }
+    printf("\n%u frames\n", (unsigned)frame_stats.frames);
+    host_lcd_report(stdout);
+  }
+  if(screenshot && !host_lcd_save_ppm(screenshot))
+    fprintf(stderr, "unable to write %s\n", screenshot);
+  // let the logger task write the last messages
+  vTaskDelay(100);
+  fflush(stdout);
+  return 0;
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * host_preferences.cpp
+ * NVS key-value storage for the host build. See Preferences.h.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include <Preferences.h>
+#include <sys/stat.h>
+
+#define HOST_NVS_DIR "host_nvs"
+
+
+bool Preferences::begin(const char *name, bool ro){
+  if(started)
+    end();
+  path = std::string(HOST_NVS_DIR "/") + name + ".txt";
+  values.clear();
+  FILE *f = fopen(path.c_str(), "r");
+  if(f){
+    char line[128];
+    while(fgets(line, sizeof(line), f)){
+      char *eq = strchr(line, '=');
+      if(!eq)
+        continue;
+      *eq = 0;
+      values[line] = strtoull(eq + 1, NULL, 10);
+    }
+    fclose(f);
+  }
+  started = true;
+  read_only = ro;
+  return true;
+}
+
+
+void Preferences::end(){
+  started = false;
+  values.clear();
+}
+
+
+/***************************************************************************************
+* Function name:          save
+* Description:            write all values to a temporary file and rename it, so a
+*                         crash never leaves a half written namespace (like the NVS)
+***************************************************************************************/
+bool Preferences::save(){
+  if(!started || read_only)
+    return false;
+  mkdir(HOST_NVS_DIR, 0755);
+  std::string tmp = path + ".tmp";
+  FILE *f = fopen(tmp.c_str(), "w");
+  if(!f)
+    return false;
+  for(const auto &v : values)
+    fprintf(f, "%s=%llu\n", v.first.c_str(), (unsigned long long)v.second);
+  bool ok = fclose(f) == 0;
+  return ok && ::rename(tmp.c_str(), path.c_str()) == 0;
+}
+
+
+bool Preferences::clear(){
+  values.clear();
+  return save();
+}
+
+
+bool Preferences::remove(const char *key){
+  return values.erase(key) > 0 && save();
+}
+
+
+bool Preferences::isKey(const char *key){
+  return values.count(key) > 0;
+}
+
+
+uint32_t Preferences::getUInt(const char *key, uint32_t default_value){
+  auto v = values.find(key);
+  return v == values.end() ? default_value : (uint32_t)v->second;
+}
+
+
+size_t Preferences::putUInt(const char *key, uint32_t value){
+  values[key] = value;
+  return save() ? sizeof(value) : 0;
+}
+
+
+uint64_t Preferences::getULong64(const char *key, uint64_t default_value){
+  auto v = values.find(key);
+  return v == values.end() ? default_value : v->second;
+}
+
+
+size_t Preferences::putULong64(const char *key, uint64_t value){
+  values[key] = value;
+  return save() ? sizeof(value) : 0;
+}
@@ -0,0 +1,221 @@
+/******************************************************************************
+ * host_wifi.cpp
+ * TCP server and client of the WiFi library on POSIX sockets.
+ * See WiFi.h for a description.
+ *
+ * The client sockets are blocking for writing (like lwIP with the send
+ * timeout of the ESP32) and are read without blocking.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include <WiFi.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+
+#define HOST_SEND_TIMEOUT_S 5
+
+struct host_socket_t {
+  int fd;
+  explicit host_socket_t(int fd) : fd(fd) {}
+  ~host_socket_t() { close_fd(); }
+  void close_fd() {
+    if(fd >= 0){
+      ::close(fd);
+      fd = -1;
+    }
+  }
+};
+
+
+WiFiClient::WiFiClient(int fd) : sock(std::make_shared<host_socket_t>(fd)) {
+  struct timeval tv = { HOST_SEND_TIMEOUT_S, 0 };
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+
+int WiFiClient::fd() const {
+  return sock ? sock->fd : -1;
+}
+
+
+size_t WiFiClient::write(uint8_t c){
+  return write(&c, 1);
+}
+
+
+size_t WiFiClient::write(const uint8_t *buf, size_t size){
+  if(fd() < 0)
+    return 0;
+  size_t sent = 0;
+  while(sent < size){
+    ssize_t n = send(fd(), buf + sent, size - sent, MSG_NOSIGNAL);
+    if(n < 0 && errno == EINTR)
+      continue;
+    if(n <= 0){
+      // peer gone or send timeout, like a failed lwIP write
+      stop();
+      break;
+    }
+    sent += n;
+  }
+  return sent;
+}
+
+
+int WiFiClient::available(){
+  if(fd() < 0)
+    return 0;
+  int n = 0;
+  if(ioctl(fd(), FIONREAD, &n) < 0)
+    return 0;
+  return n;
+}
+
+
+int WiFiClient::read(){
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+
+int WiFiClient::read(uint8_t *buf, size_t size){
+  if(fd() < 0)
+    return -1;
+  ssize_t n = recv(fd(), buf, size, MSG_DONTWAIT);
+  return n > 0 ? (int)n : -1;
+}
+
+
+int WiFiClient::peek(){
+  if(fd() < 0)
+    return -1;
+  uint8_t c;
+  return recv(fd(), &c, 1, MSG_DONTWAIT | MSG_PEEK) == 1 ? c : -1;
+}
+
+
+uint8_t WiFiClient::connected(){
+  if(fd() < 0)
+    return 0;
+  uint8_t c;
+  ssize_t n = recv(fd(), &c, 1, MSG_DONTWAIT | MSG_PEEK);
+  if(n > 0)
+    return 1;
+  if(n == 0)
+    return 0;
+  return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 1 : 0;
+}
+
+
+void WiFiClient::stop(){
+  // closes the connection for all copies of the client
+  if(sock)
+    sock->close_fd();
+  sock.reset();
+}
+
+
+int WiFiClient::setNoDelay(bool nodelay){
+  int flag = nodelay ? 1 : 0;
+  return setsockopt(fd(), IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+
+bool WiFiClient::getNoDelay(){
+  int flag = 0;
+  socklen_t len = sizeof(flag);
+  if(getsockopt(fd(), IPPROTO_TCP, TCP_NODELAY, &flag, &len) < 0)
+    return false;
+  return flag != 0;
+}
+
+
+void WiFiClient::setTimeout(uint32_t seconds){
+  Stream::setTimeout(seconds * 1000);
+  struct timeval tv = { (time_t)seconds, 0 };
+  setsockopt(fd(), SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+
+IPAddress WiFiClient::remoteIP(){
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  if(getpeername(fd(), (struct sockaddr *)&addr, &len) < 0)
+    return IPAddress();
+  return IPAddress((uint32_t)addr.sin_addr.s_addr);
+}
+
+
+uint16_t WiFiClient::remotePort(){
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  if(getpeername(fd(), (struct sockaddr *)&addr, &len) < 0)
+    return 0;
+  return ntohs(addr.sin_port);
+}
+
+
+uint16_t WiFiServer::host_port() const {
+  const char *env = getenv("HOST_HTTP_PORT");
+  if(env && atoi(env) > 0)
+    return atoi(env);
+  return port < 1024 ? port + HOST_PORT_OFFSET : port;
+}
+
+
+void WiFiServer::begin(){
+  if(listen_fd >= 0)
+    return;
+  listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if(listen_fd < 0)
+    return;
+  int on = 1;
+  setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(host_port());
+  if(bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listen_fd, 8) < 0){
+    fprintf(stderr, "host: unable to listen on port %u: %s\n", host_port(), strerror(errno));
+    ::close(listen_fd);
+    listen_fd = -1;
+    return;
+  }
+  fcntl(listen_fd, F_SETFL, O_NONBLOCK);
+}
+
+
+WiFiClient WiFiServer::available(){
+  if(listen_fd < 0)
+    return WiFiClient();
+  int fd = accept(listen_fd, NULL, NULL);
+  if(fd < 0)
+    return WiFiClient();
+  // accepted sockets are blocking, reads use MSG_DONTWAIT
+  int flags = fcntl(fd, F_GETFL);
+  fcntl(fd, F_SETFL, flags & ~O_NONBLOCK);
+  return WiFiClient(fd);
+}
+
+
+bool WiFiServer::hasClient(){
+  if(listen_fd < 0)
+    return false;
+  struct pollfd pfd = { listen_fd, POLLIN, 0 };
+  return poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLIN);
+}
+
+
+void WiFiServer::stop(){
+  if(listen_fd >= 0)
+    ::close(listen_fd);
+  listen_fd = -1;
+}
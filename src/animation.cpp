@@ -0,0 +1,40 @@
+/******************************************************************************
+ * animation.cpp
+ * Critically damped animation of displayed values.
+ * See animation.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "animation.h"
+
+
+void anim_jump(anim_value_t &a, float value){
+  a.value = value;
+  a.target = value;
+  a.velocity = 0;
+}
+
+
+/***************************************************************************************
+* Function name:          anim_step
+* Description:            advance a critically damped spring by dt seconds
+*                         The exact solution exp(-w*dt) is replaced by a polynomial
+*                         approximation (error < 0.1% for w*dt < 1), so a step costs a
+*                         few multiplications and one division.
+***************************************************************************************/
+bool anim_step(anim_value_t &a, float dt){
+  if(a.value == a.target)
+    return false;
+  float omega = 2.0f / max(a.smooth_time, 0.001f);
+  float x = omega * dt;
+  float decay = 1.0f / (1.0f + x + 0.48f * x * x + 0.235f * x * x * x);
+  float change = a.value - a.target;
+  float temp = (a.velocity + omega * change) * dt;
+  a.velocity = (a.velocity - omega * temp) * decay;
+  a.value = a.target + (change + temp) * decay;
+  if(fabsf(a.value - a.target) < ANIM_EPSILON && fabsf(a.velocity) < ANIM_EPSILON){
+    a.value = a.target;
+    a.velocity = 0;
+  }
+  return true;
+}
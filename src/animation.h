@@ -0,0 +1,45 @@
+/******************************************************************************
+ * animation.h
+ * Critically damped animation of displayed values (e.g. the gauge needle).
+ *
+ * The displayed value follows its target like a critically damped
+ * spring: it moves fast at first and slows down smoothly, without
+ * overshooting. smooth_time is roughly the time needed to cover most of
+ * the distance. A moving target (new value while the animation runs) is
+ * followed without jumps, because the velocity is kept.
+ *
+ * usage (once per frame):
+ *   anim_value_t needle = ANIM_VALUE(50.0, 0.25);
+ *   anim_set_target(needle, 80.0);
+ *   if(anim_step(needle, frame_dt()))
+ *     draw(needle.value);
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <Arduino.h>
+
+// default smooth time of the gauge needle in seconds
+#define ANIM_SMOOTH_TIME 0.25f
+// the animation stops if the value is closer than this to the target
+#define ANIM_EPSILON 0.01f
+
+struct anim_value_t {
+  float value;
+  float target;
+  float velocity;
+  float smooth_time;
+};
+
+#define ANIM_VALUE(v, smooth_time) { (v), (v), 0.0f, (smooth_time) }
+
+inline void anim_set_target(anim_value_t &a, float target) { a.target = target; }
+// set the value without animation
+void anim_jump(anim_value_t &a, float value);
+// advance the animation by dt seconds, return value: true if the value changed
+bool anim_step(anim_value_t &a, float dt);
+inline bool anim_running(const anim_value_t &a) { return a.value != a.target; }
+
+#endif
@@ -0,0 +1,367 @@
+/******************************************************************************
+ * archive.cpp
+ * Multi-frame capture archive of the M5Stack Screen-Capture firmware.
+ * See archive.h for the file format.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "archive.h"
+#include "logger.h"
+
+#define ARCHIVE_MAX_RUN 128
+#define ARCHIVE_MAX_LITERAL 128
+
+static uint32_t crc_table[256];
+
+
+/***************************************************************************************
+* Function name:          archive_crc32
+* Description:            CRC-32 (IEEE 802.3, as zlib), start with crc = 0
+***************************************************************************************/
+uint32_t archive_crc32(uint32_t crc, const uint8_t *data, size_t len){
+  if(crc_table[1] == 0){
+    for(uint32_t i=0; i<256; i++){
+      uint32_t c = i;
+      for(int k=0; k<8; k++)
+        c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      crc_table[i] = c;
+    }
+  }
+  crc = ~crc;
+  while(len--)
+    crc = crc_table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+
+ArchiveWriter::ArchiveWriter(){
+  out = NULL;
+  write_error = false;
+  compress = true;
+  index = NULL;
+  max_count = 0;
+  count = 0;
+  since_key = 0;
+  offset = 0;
+  pixel_count = 0;
+  crc = 0;
+  open = false;
+}
+
+
+ArchiveWriter::~ArchiveWriter(){
+  if(open)
+    end();
+  free(index);
+}
+
+
+bool ArchiveWriter::allocate_index(uint32_t max_frames){
+  if(index && max_count == max_frames)
+    return true;
+  free(index);
+  index = NULL;
+  if(psramFound())
+    index = (archive_index_t *) ps_malloc(max_frames * sizeof(archive_index_t));
+  if(!index)
+    index = (archive_index_t *) malloc(max_frames * sizeof(archive_index_t));
+  if(!index){
+    logger_write(LOG_CAPTURE, LOG_ERR, "no memory for the archive index");
+    return false;
+  }
+  max_count = max_frames;
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          begin
+* Description:            create the archive file and write the header
+***************************************************************************************/
+bool ArchiveWriter::begin(fs::FS &fs, const char *path, int width, int height, uint32_t max_frames){
+  if(open)
+    end();
+  if(!allocate_index(max_frames))
+    return false;
+  file = fs.open(path, FILE_WRITE);
+  if(!file){
+    logger_write(LOG_CAPTURE, LOG_ERR, "unable to create %s", path);
+    return false;
+  }
+  writer.begin(file);
+  return begin(writer, width, height, max_frames);
+}
+
+
+/***************************************************************************************
+* Function name:          begin
+* Description:            start an archive on any output and write the header
+***************************************************************************************/
+bool ArchiveWriter::begin(Print &output, int width, int height, uint32_t max_frames){
+  if(open && &output != &writer)
+    end();
+  if(!allocate_index(max_frames))
+    return false;
+  out = &output;
+  write_error = false;
+  archive_header_t header;
+  memset(&header, 0, sizeof(header));
+  header.magic = ARCHIVE_MAGIC;
+  header.version = ARCHIVE_VERSION;
+  header.header_size = sizeof(header);
+  header.width = width;
+  header.height = height;
+  header.key_interval = ARCHIVE_KEY_INTERVAL;
+  header.start_ms = millis();
+  put((const uint8_t *) &header, sizeof(header));
+  pixel_count = width * height;
+  offset = sizeof(header);
+  count = 0;
+  since_key = 0;
+  open = true;
+  return !write_error;
+}
+
+
+size_t ArchiveWriter::max_frame_bytes(){
+  return sizeof(archive_frame_t) + pixel_count * sizeof(uint16_t) + sizeof(uint32_t);
+}
+
+
+void ArchiveWriter::put(const uint8_t *data, size_t len){
+  if(!write_error && out->write(data, len) != len)
+    write_error = true;
+}
+
+
+void ArchiveWriter::emit_bytes(const uint8_t *data, size_t len){
+  crc = archive_crc32(crc, data, len);
+  put(data, len);
+}
+
+
+/***************************************************************************************
+* Function name:          encode
+* Description:            run-length code the pixels (XORed with prev if not NULL)
+*                         emit = false: only count the bytes
+* return value:           size of the coded pixels in bytes
+***************************************************************************************/
+size_t ArchiveWriter::encode(const uint16_t *pixels, const uint16_t *prev, bool emit){
+  // staging buffer, a token with 128 literal pixels always fits in
+  uint8_t out[512];
+  size_t used = 0;
+  size_t size = 0;
+  uint32_t n = pixel_count;
+  uint32_t i = 0;
+  #define VALUE(k) (prev ? (uint16_t)(pixels[k] ^ prev[k]) : pixels[k])
+  while(i < n){
+    if(emit && used > sizeof(out) - (1 + 2*ARCHIVE_MAX_LITERAL)){
+      emit_bytes(out, used);
+      used = 0;
+    }
+    uint16_t v = VALUE(i);
+    uint32_t run = 1;
+    while(i + run < n && run < ARCHIVE_MAX_RUN && VALUE(i + run) == v)
+      run++;
+    if(run >= 2){
+      if(emit){
+        out[used++] = run - 1;
+        out[used++] = v & 0xFF;
+        out[used++] = v >> 8;
+      }
+      size += 3;
+      i += run;
+      continue;
+    }
+    // literal pixels up to the start of the next run
+    uint32_t len = 0;
+    size_t token = used++;
+    while(i < n && len < ARCHIVE_MAX_LITERAL){
+      uint16_t l = VALUE(i);
+      if(i + 1 < n && VALUE(i + 1) == l && len > 0)
+        break;
+      if(emit){
+        out[used++] = l & 0xFF;
+        out[used++] = l >> 8;
+      }
+      i++;
+      len++;
+    }
+    if(emit)
+      out[token] = 0x7F + len;
+    else
+      used = 0;
+    size += 1 + 2*len;
+  }
+  #undef VALUE
+  if(emit && used > 0)
+    emit_bytes(out, used);
+  return size;
+}
+
+
+/***************************************************************************************
+* Function name:          add_frame
+* Description:            append a frame, coded as delta or key frame (smaller one) or
+*                         raw if run-length coding does not help
+***************************************************************************************/
+bool ArchiveWriter::add_frame(const uint16_t *pixels, const uint16_t *prev, uint32_t timestamp_ms){
+  if(!open || count >= max_count || write_error)
+    return false;
+  size_t raw_size = pixel_count * sizeof(uint16_t);
+  // first pass: size of the coded frame
+  if(since_key + 1 >= ARCHIVE_KEY_INTERVAL || !compress)
+    prev = NULL;
+  size_t size = compress ? encode(pixels, prev, false) : raw_size;
+  if(prev && size > raw_size / 4){
+    // a lot of changes, a key frame may be smaller
+    size_t key_size = encode(pixels, NULL, false);
+    if(key_size <= size){
+      prev = NULL;
+      size = key_size;
+    }
+  }
+  uint8_t flags = prev ? ARCHIVE_DELTA : 0;
+  if(size < raw_size)
+    flags |= ARCHIVE_RLE;
+  else
+    size = raw_size;
+  archive_frame_t frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.magic = ARCHIVE_FRAME_MAGIC;
+  frame.sequence = count;
+  frame.timestamp_ms = timestamp_ms;
+  frame.length = size;
+  frame.flags = flags;
+  put((const uint8_t *) &frame, sizeof(frame));
+  // second pass: write the payload
+  crc = 0;
+  if(flags & ARCHIVE_RLE){
+    encode(pixels, prev, true);
+  } else if(prev){
+    uint16_t line[64];
+    for(uint32_t i=0; i<pixel_count; i+=64){
+      uint32_t n = min((uint32_t)64, pixel_count - i);
+      for(uint32_t k=0; k<n; k++)
+        line[k] = pixels[i + k] ^ prev[i + k];
+      emit_bytes((const uint8_t *) line, n * sizeof(uint16_t));
+    }
+  } else {
+    emit_bytes((const uint8_t *) pixels, raw_size);
+  }
+  put((const uint8_t *) &crc, sizeof(crc));
+  archive_index_t &entry = index[count++];
+  memset(&entry, 0, sizeof(entry));
+  entry.offset = offset;
+  entry.timestamp_ms = timestamp_ms;
+  entry.length = size;
+  entry.flags = flags;
+  offset += sizeof(frame) + size + sizeof(crc);
+  since_key = prev ? since_key + 1 : 0;
+  return !write_error;
+}
+
+
+/***************************************************************************************
+* Function name:          write_index
+* Description:            write the index and the footer (at the end of the file)
+***************************************************************************************/
+static void write_index(Print &out, const archive_index_t *index, uint32_t count, uint32_t index_offset){
+  out.write((const uint8_t *) index, count * sizeof(archive_index_t));
+  archive_footer_t footer;
+  footer.magic = ARCHIVE_INDEX_MAGIC;
+  footer.frames = count;
+  footer.index_offset = index_offset;
+  footer.index_crc = archive_crc32(0, (const uint8_t *) index, count * sizeof(archive_index_t));
+  out.write((const uint8_t *) &footer, sizeof(footer));
+}
+
+
+bool ArchiveWriter::end(){
+  if(!open)
+    return false;
+  write_index(*out, index, count, offset);
+  open = false;
+  if(out != &writer)
+    return !write_error;
+  bool ok = writer.end() && !write_error;
+  file.close();
+  return ok;
+}
+
+
+/***************************************************************************************
+* Function name:          archive_recover
+* Description:            check the footer of an archive; without a valid footer the
+*                         frames are scanned up to the first bad frame and the index
+*                         is appended
+* return value:           number of frames, -1 if the file is not an archive
+***************************************************************************************/
+int archive_recover(fs::FS &fs, const char *path){
+  File file = fs.open(path, FILE_READ);
+  if(!file)
+    return -1;
+  archive_header_t header;
+  if(file.read((uint8_t *) &header, sizeof(header)) != sizeof(header) || header.magic != ARCHIVE_MAGIC)
+    return -1;
+  size_t file_size = file.size();
+  archive_footer_t footer;
+  if(file_size >= sizeof(header) + sizeof(footer) && file.seek(file_size - sizeof(footer)) &&
+     file.read((uint8_t *) &footer, sizeof(footer)) == sizeof(footer) &&
+     footer.magic == ARCHIVE_INDEX_MAGIC &&
+     footer.index_offset + footer.frames * sizeof(archive_index_t) + sizeof(footer) == file_size)
+    return footer.frames;
+  // scan the frames
+  uint32_t max_length = header.width * header.height * 2;
+  archive_index_t *index = NULL;
+  if(psramFound())
+    index = (archive_index_t *) ps_malloc(ARCHIVE_MAX_FRAMES * sizeof(archive_index_t));
+  if(!index)
+    index = (archive_index_t *) malloc(ARCHIVE_MAX_FRAMES * sizeof(archive_index_t));
+  if(!index)
+    return -1;
+  uint8_t buffer[1024];
+  uint32_t count = 0;
+  uint32_t offset = header.header_size;
+  while(count < ARCHIVE_MAX_FRAMES && file.seek(offset)){
+    archive_frame_t frame;
+    if(file.read((uint8_t *) &frame, sizeof(frame)) != sizeof(frame) ||
+       frame.magic != ARCHIVE_FRAME_MAGIC || frame.length > max_length)
+      break;
+    uint32_t crc = 0;
+    uint32_t left = frame.length;
+    while(left > 0){
+      size_t n = file.read(buffer, min((uint32_t)sizeof(buffer), left));
+      if(n == 0)
+        break;
+      crc = archive_crc32(crc, buffer, n);
+      left -= n;
+    }
+    uint32_t stored_crc;
+    if(left > 0 || file.read((uint8_t *) &stored_crc, sizeof(stored_crc)) != sizeof(stored_crc) ||
+       stored_crc != crc)
+      break;
+    archive_index_t &entry = index[count++];
+    memset(&entry, 0, sizeof(entry));
+    entry.offset = offset;
+    entry.timestamp_ms = frame.timestamp_ms;
+    entry.length = frame.length;
+    entry.flags = frame.flags;
+    offset += sizeof(frame) + frame.length + sizeof(stored_crc);
+  }
+  file.close();
+  // the index follows the damaged rest of the file (there is no truncate)
+  file = fs.open(path, FILE_APPEND);
+  bool ok = false;
+  if(file){
+    FileWriter writer(4096);
+    writer.begin(file);
+    write_index(writer, index, count, file_size);
+    ok = writer.end();
+    file.close();
+  }
+  free(index);
+  logger_write(LOG_CAPTURE, ok ? LOG_INFO : LOG_ERR, "%s: %u frames recovered%s", path,
+               (unsigned)count, ok ? "" : ", unable to write the index");
+  return ok ? count : -1;
+}
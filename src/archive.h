@@ -0,0 +1,149 @@
+/******************************************************************************
+ * archive.h
+ * Multi-frame capture archive of the M5Stack Screen-Capture firmware.
+ *
+ * A burst of captures is written into one file instead of one BMP per
+ * frame: one directory entry and one cluster chain, and the frames are
+ * compressed against the previous frame. The file is append-only:
+ *
+ *   header   32 bytes: "M5AR", version, header size, width, height,
+ *            key frame interval, start time (ms)
+ *   frame    20 bytes: "FRME", sequence, time (ms), payload length, flags
+ *            payload: RGB565 pixels (little endian), raw or run-length
+ *            coded, XORed with the previous frame for delta frames
+ *            4 bytes: CRC-32 of the payload
+ *   ...
+ *   index    16 bytes per frame: offset, time (ms), payload length, flags
+ *   footer   16 bytes: "M5AI", number of frames, offset of the index,
+ *            CRC-32 of the index
+ *
+ * The footer is the last 16 bytes of the file, so a reader finds every
+ * frame with two reads. Run-length tokens (as in gauge_rle.h):
+ *   0x00..0x7F  (token+1) times the next pixel
+ *   0x80..0xFF  (token-0x7F) literal pixels
+ *
+ * Every ARCHIVE_KEY_INTERVAL frames (and whenever it is smaller) a key
+ * frame without delta is written, so a frame is decoded from the last
+ * key frame at most ARCHIVE_KEY_INTERVAL-1 frames back.
+ *
+ * After a power loss the archive has no index. archive_recover() scans
+ * the frames, stops at the first frame with a bad CRC and appends the
+ * index and the footer; it is called at startup for the archives on the
+ * SD card (burst_recover()). tools/archive_extract.py converts an archive
+ * (with or without index) to PNG images or a video.
+ *
+ * example:
+ *   ArchiveWriter archive;
+ *   archive.begin(SD, "/burst.m5a", 320, 240);
+ *   archive.add_frame(frame_1, NULL, t1);
+ *   archive.add_frame(frame_2, frame_1, t2);
+ *   archive.end();
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "file_writer.h"
+
+#define ARCHIVE_MAGIC 0x5241354D        // "M5AR"
+#define ARCHIVE_FRAME_MAGIC 0x454D5246  // "FRME"
+#define ARCHIVE_INDEX_MAGIC 0x4941354D  // "M5AI"
+#define ARCHIVE_VERSION 1
+// frame flags
+#define ARCHIVE_DELTA 0x01
+#define ARCHIVE_RLE 0x02
+
+#ifndef ARCHIVE_KEY_INTERVAL
+#define ARCHIVE_KEY_INTERVAL 30
+#endif
+// frames in the index of one archive
+#ifndef ARCHIVE_MAX_FRAMES
+#define ARCHIVE_MAX_FRAMES 4096
+#endif
+
+struct archive_header_t {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_size;
+  uint16_t width;
+  uint16_t height;
+  uint16_t key_interval;
+  uint16_t reserved;
+  uint32_t start_ms;
+  uint32_t reserved2[3];
+};
+
+struct archive_frame_t {
+  uint32_t magic;
+  uint32_t sequence;
+  uint32_t timestamp_ms;
+  uint32_t length;
+  uint8_t flags;
+  uint8_t reserved[3];
+};
+
+struct archive_index_t {
+  uint32_t offset;
+  uint32_t timestamp_ms;
+  uint32_t length;
+  uint8_t flags;
+  uint8_t reserved[3];
+};
+
+struct archive_footer_t {
+  uint32_t magic;
+  uint32_t frames;
+  uint32_t index_offset;
+  uint32_t index_crc;
+};
+
+class ArchiveWriter {
+  public:
+    ArchiveWriter();
+    ~ArchiveWriter();
+    bool begin(fs::FS &fs, const char *path, int width, int height,
+               uint32_t max_frames = ARCHIVE_MAX_FRAMES);
+    // archive in memory or on a network connection
+    bool begin(Print &out, int width, int height, uint32_t max_frames = ARCHIVE_MAX_FRAMES);
+    // false: raw frames only (fastest, no run-length coding and no delta)
+    void set_compress(bool enable) { compress = enable; }
+    // append a frame, prev: the previous frame for a delta frame (or NULL)
+    // return value: false on a write error or if the index is full
+    bool add_frame(const uint16_t *pixels, const uint16_t *prev, uint32_t timestamp_ms);
+    // write the index and the footer (and close the file)
+    bool end();
+    uint32_t frames() { return count; }
+    uint32_t bytes() { return offset; }
+    // largest possible frame and size of index + footer, in bytes
+    size_t max_frame_bytes();
+    size_t index_bytes() { return (count + 1) * sizeof(archive_index_t) + sizeof(archive_footer_t); }
+
+  private:
+    bool allocate_index(uint32_t max_frames);
+    size_t encode(const uint16_t *pixels, const uint16_t *prev, bool emit);
+    void emit_bytes(const uint8_t *data, size_t len);
+    void put(const uint8_t *data, size_t len);
+    File file;
+    FileWriter writer;
+    Print *out;
+    bool write_error;
+    bool compress;
+    archive_index_t *index;
+    uint32_t max_count;
+    uint32_t count;
+    uint32_t since_key;
+    uint32_t offset;
+    uint32_t pixel_count;
+    uint32_t crc;
+    bool open;
+};
+
+uint32_t archive_crc32(uint32_t crc, const uint8_t *data, size_t len);
+// rebuild the index of an archive without footer (power loss)
+// return value: number of frames, -1 if the file is not an archive
+int archive_recover(fs::FS &fs, const char *path);
+
+#endif
@@ -0,0 +1,290 @@
+/******************************************************************************
+ * burst.cpp
+ * Burst capture of consecutive frames for the M5Stack Screen-Capture firmware.
+ * See burst.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "burst.h"
+#include <M5Stack.h>
+#include <SD.h>
+#include "archive.h"
+#include "capture_name.h"
+#include "events.h"
+#include "http_writer.h"
+#include "logger.h"
+#include "retention.h"
+#include "screen.h"
+#include "storage.h"
+
+burst_stats_t burst_stats;
+
+// archive in memory, a write that does not fit completely is refused
+class BurstBuffer : public Print {
+  public:
+    void begin(uint8_t *buffer, size_t size) { buf = buffer; capacity = size; pos = 0; }
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *data, size_t len) override {
+      if(len > capacity - pos)
+        return 0;
+      memcpy(buf + pos, data, len);
+      pos += len;
+      return len;
+    }
+    size_t size() { return pos; }
+    size_t left() { return capacity - pos; }
+    const uint8_t *data() { return buf; }
+  private:
+    uint8_t *buf = NULL;
+    size_t capacity = 0;
+    size_t pos = 0;
+};
+
+static burst_state_t state = BURST_IDLE;
+static uint8_t *buffer = NULL;
+static BurstBuffer archive_buffer;
+static ArchiveWriter archive;
+// the last two frames, for the delta of the next frame
+static uint16_t *frames[2] = { NULL, NULL };
+static int current;
+static bool has_previous;
+static uint32_t frame_limit;
+static unsigned long start_ms;
+static unsigned long duration_limit_ms;
+static bool write_sd;
+static char path[CAPTURE_NAME_LEN];
+// download of the archive (one client at a time)
+static WiFiClient download_client;
+static bool download_active = false;
+static size_t download_sent;
+static unsigned long download_deadline;
+
+
+/***************************************************************************************
+* Function name:          burst_allocate
+* Description:            archive buffer and frame buffers, allocated for the first burst
+*                         and kept afterwards
+***************************************************************************************/
+static bool burst_allocate(){
+  if(buffer)
+    return true;
+  if(!psramFound())
+    return false;
+  size_t frame_size = M5.Lcd.width() * M5.Lcd.height() * sizeof(uint16_t);
+  buffer = (uint8_t *) ps_malloc(BURST_BUFFER_SIZE);
+  frames[0] = (uint16_t *) ps_malloc(frame_size);
+  frames[1] = (uint16_t *) ps_malloc(frame_size);
+  if(buffer && frames[0] && frames[1])
+    return true;
+  free(buffer);
+  free(frames[0]);
+  free(frames[1]);
+  buffer = NULL;
+  frames[0] = frames[1] = NULL;
+  return false;
+}
+
+
+bool burst_start(uint32_t frame_count, uint32_t duration_ms, bool delta, bool to_sd){
+  if(state == BURST_CAPTURING || state == BURST_FLUSHING || download_active)
+    return false;
+  if(!burst_allocate()){
+    logger_write(LOG_CAPTURE, LOG_WARN, "no PSRAM for a burst");
+    return false;
+  }
+  if(frame_count == 0)
+    frame_count = BURST_DEFAULT_FRAMES;
+  frame_limit = min(frame_count, (uint32_t)BURST_MAX_FRAMES);
+  duration_limit_ms = duration_ms;
+  write_sd = to_sd;
+  archive_buffer.begin(buffer, BURST_BUFFER_SIZE);
+  archive.set_compress(delta);
+  if(!archive.begin(archive_buffer, M5.Lcd.width(), M5.Lcd.height(), frame_limit))
+    return false;
+  current = 0;
+  has_previous = false;
+  start_ms = millis();
+  burst_stats.bursts++;
+  burst_stats.frames = 0;
+  burst_stats.bytes = 0;
+  burst_stats.duration_ms = 0;
+  burst_stats.frame_max_us = 0;
+  state = BURST_CAPTURING;
+  logger_write(LOG_CAPTURE, LOG_INFO, "burst started: %u frames, %u ms, %s", (unsigned)frame_limit,
+               (unsigned)duration_limit_ms, delta ? "delta" : "raw");
+  return true;
+}
+
+
+// completion callback of the storage task
+static void burst_flushed(const char *file_path, bool ok, void *arg){
+  state = ok ? BURST_DONE : BURST_FAILED;
+  events_capture(file_path, ok);
+}
+
+
+/***************************************************************************************
+* Function name:          burst_finish
+* Description:            complete the archive and queue it for the SD card
+***************************************************************************************/
+static void burst_finish(){
+  bool ok = archive.end();
+  burst_stats.duration_ms = millis() - start_ms;
+  burst_stats.bytes = archive_buffer.size();
+  logger_write(LOG_CAPTURE, ok ? LOG_INFO : LOG_ERR, "burst: %u frames in %u ms, %u kB",
+               (unsigned)burst_stats.frames, (unsigned)burst_stats.duration_ms,
+               (unsigned)(burst_stats.bytes / 1024));
+  if(!ok){
+    state = BURST_FAILED;
+    return;
+  }
+  if(!write_sd){
+    state = BURST_DONE;
+    return;
+  }
+  // next capture number, with the extension of the archive
+  capture_name_next("burst", path, sizeof(path));
+  char *ext = strrchr(path, '.');
+  if(!ext || strchr(ext, '/'))
+    ext = path + strlen(path);
+  snprintf(ext, sizeof(path) - (ext - path), ".m5a");
+  state = BURST_FLUSHING;
+  storage_write(SD, path, archive_buffer.data(), archive_buffer.size(), burst_flushed, NULL,
+                RETENTION_PRIORITY_HIGH);
+}
+
+
+/***************************************************************************************
+* Function name:          burst_frame
+* Description:            read back the frame and append it to the archive
+*                         needs to be called after every frame that is drawn
+***************************************************************************************/
+void burst_frame(){
+  if(state != BURST_CAPTURING)
+    return;
+  unsigned long now = millis();
+  bool time_up = duration_limit_ms > 0 && now - start_ms >= duration_limit_ms;
+  // the next frame and the index have to fit into the buffer
+  bool full = archive_buffer.left() < archive.max_frame_bytes() + archive.index_bytes();
+  if(time_up || full || burst_stats.frames >= frame_limit){
+    burst_finish();
+    return;
+  }
+  unsigned long start = micros();
+  uint16_t *frame = frames[current];
+  screen_read_rgb565(0, 0, M5.Lcd.width(), M5.Lcd.height(), frame);
+  bool ok = archive.add_frame(frame, has_previous ? frames[1 - current] : NULL, now);
+  uint32_t us = micros() - start;
+  if(us > burst_stats.frame_max_us)
+    burst_stats.frame_max_us = us;
+  if(!ok){
+    burst_finish();
+    return;
+  }
+  burst_stats.frames++;
+  has_previous = true;
+  current = 1 - current;
+  if(burst_stats.frames >= frame_limit)
+    burst_finish();
+}
+
+
+/***************************************************************************************
+* Function name:          burst_download
+* Description:            send the header of the archive, the data follows in slices
+* return value:           true if the connection was taken over
+***************************************************************************************/
+bool burst_download(WiFiClient &client){
+  bool available = (state == BURST_DONE || state == BURST_FLUSHING ||
+                    (state == BURST_FAILED && archive_buffer.size() > 0));
+  if(!available){
+    http_send_text(client, 404, "Not Found", "no burst recorded");
+    return false;
+  }
+  if(download_active){
+    http_send_text(client, 503, "Service Unavailable", "burst download in progress", 1);
+    return false;
+  }
+  http_response.begin(client);
+  http_response.status(200, "OK");
+  http_response.header("Content-type", "application/octet-stream");
+  http_response.header("Content-Disposition", "attachment; filename=\"burst.m5a\"");
+  http_response.header("Content-Length", (unsigned long)archive_buffer.size());
+  http_response.header("Cache-Control", "no-cache");
+  http_response.end_headers();
+  http_response.end();
+  download_client = client;
+  download_active = true;
+  download_sent = 0;
+  download_deadline = millis() + BURST_TIMEOUT_MS;
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          burst_service
+* Description:            send one slice of the archive to the download client
+*                         needs to be called frequently from loop()
+***************************************************************************************/
+void burst_service(){
+  if(!download_active)
+    return;
+  bool done = !download_client.connected() || (long)(millis() - download_deadline) >= 0;
+  if(!done){
+    size_t n = min((size_t)BURST_SLICE_SIZE, archive_buffer.size() - download_sent);
+    size_t written = download_client.write(archive_buffer.data() + download_sent, n);
+    download_sent += written;
+    // nothing written: try again with the next call until the timeout
+    if(written > 0)
+      download_deadline = millis() + BURST_TIMEOUT_MS;
+    done = (download_sent >= archive_buffer.size());
+  }
+  if(done){
+    download_client.stop();
+    download_active = false;
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          burst_recover
+* Description:            complete the archives whose write was cut off by a power loss
+*                         (index and footer missing, archive.h); an intact archive costs
+*                         two small reads
+***************************************************************************************/
+void burst_recover(fs::FS &fs){
+  uint32_t cursor = 0;
+  char archive_path[CAPTURE_NAME_LEN];
+  while(retention_find(".m5a", &cursor, archive_path, sizeof(archive_path))){
+    File file = fs.open(archive_path, FILE_READ);
+    size_t size = file ? file.size() : 0;
+    file.close();
+    if(archive_recover(fs, archive_path) < 0){
+      logger_write(LOG_CAPTURE, LOG_WARN, "%s: no archive, not recovered", archive_path);
+      continue;
+    }
+    // the appended index is counted in the quota
+    file = fs.open(archive_path, FILE_READ);
+    if(file && file.size() != size)
+      retention_replace(fs, archive_path, archive_path, file.size());
+    file.close();
+  }
+}
+
+
+burst_state_t burst_state(){
+  return state;
+}
+
+
+size_t burst_status_json(char *buf, size_t size){
+  static const char *names[] = { "idle", "capturing", "flushing", "done", "failed" };
+  int n = snprintf(buf, size,
+                   "{\"state\":\"%s\",\"frames\":%u,\"bytes\":%u,\"duration_ms\":%u,"
+                   "\"frame_max_us\":%u,\"bursts\":%u,\"buffer\":%u,\"path\":\"%s\"}",
+                   names[state], (unsigned)burst_stats.frames, (unsigned)burst_stats.bytes,
+                   (unsigned)burst_stats.duration_ms, (unsigned)burst_stats.frame_max_us,
+                   (unsigned)burst_stats.bursts, (unsigned)BURST_BUFFER_SIZE,
+                   write_sd ? path : "");
+  return n < 0 ? 0 : min((size_t)n, size - 1);
+}
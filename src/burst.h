@@ -0,0 +1,80 @@
+/******************************************************************************
+ * burst.h
+ * Burst capture of consecutive frames for the M5Stack Screen-Capture firmware.
+ *
+ * To analyze glitches of the UI, a burst records every frame that loop()
+ * draws, for N frames or M seconds, without any SD access in between:
+ *  - each frame is read back from the canvas and appended to a capture
+ *    archive (archive.h) in a PSRAM buffer, as delta to the previous
+ *    frame (optional, raw frames are faster to take but larger)
+ *  - the burst ends after the requested frames or time, or when the
+ *    next frame might not fit into the buffer
+ *  - afterwards the archive is written to the SD card as one file by the
+ *    storage task (one sequential write) and can be downloaded as
+ *    GET /burst.m5a until the next burst starts
+ *
+ * Start a burst with POST /api/burst?frames=N&seconds=M&delta=0|1&sd=0|1
+ * or with the buttons A and C pressed together. GET /api/burst reports
+ * the state. tools/archive_extract.py converts the archive to PNG images.
+ *
+ * The buffers are allocated by the first burst and kept; no memory is
+ * used before the first burst. An archive whose write was cut off by a
+ * power loss gets its index at the next start (burst_recover()).
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef BURST_H
+#define BURST_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "WiFi.h"
+
+// size of the archive buffer in PSRAM
+#ifndef BURST_BUFFER_SIZE
+#define BURST_BUFFER_SIZE (1536*1024)
+#endif
+#define BURST_DEFAULT_FRAMES 30
+#define BURST_MAX_FRAMES 600
+// bytes sent to the download client per call of burst_service()
+#define BURST_SLICE_SIZE 8192
+// drop a download client that takes no data for this time
+#define BURST_TIMEOUT_MS 20000
+
+enum burst_state_t {
+  BURST_IDLE,
+  BURST_CAPTURING,
+  // archive queued for the SD card
+  BURST_FLUSHING,
+  // archive complete (and written to the SD card if requested)
+  BURST_DONE,
+  BURST_FAILED
+};
+
+struct burst_stats_t {
+  uint32_t bursts;
+  uint32_t frames;
+  uint32_t bytes;
+  // duration of the last burst and the slowest frame (readback + coding)
+  uint32_t duration_ms;
+  uint32_t frame_max_us;
+};
+
+extern burst_stats_t burst_stats;
+
+// start a burst (frames = 0: BURST_DEFAULT_FRAMES, duration_ms = 0: no time limit)
+// return value: false if a burst is running or there is no memory
+bool burst_start(uint32_t frames, uint32_t duration_ms, bool delta, bool to_sd);
+// take the next frame of a running burst (call after every drawn frame)
+void burst_frame();
+// send the download slices (call from loop())
+void burst_service();
+// answer GET /burst.m5a, the connection is taken over until the archive is sent
+bool burst_download(WiFiClient &client);
+// complete the archives cut off by a power loss (at startup, after retention_begin())
+void burst_recover(fs::FS &fs);
+burst_state_t burst_state();
+// status as JSON object (for GET /api/burst)
+size_t burst_status_json(char *buf, size_t size);
+
+#endif
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * canvas.cpp
+ * Off-screen frame buffer of the M5Stack Screen-Capture firmware.
+ * See canvas.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "canvas.h"
+#include "logger.h"
+
+bool canvas_on_screen = false;
+static TFT_eSprite canvas_sprite(&M5.Lcd);
+static uint16_t *canvas_pixels = NULL;
+
+
+/***************************************************************************************
+* Function name:          canvas_begin
+* Description:            create the sprite with the size of the screen
+*                         (the sprite library uses the PSRAM if available)
+* return value:           false if there is not enough memory
+***************************************************************************************/
+bool canvas_begin(){
+  if(canvas_pixels)
+    return true;
+  if(!psramFound()){
+    logger_write(LOG_SYS, LOG_WARN, "no PSRAM, drawing directly on the LCD");
+    return false;
+  }
+  canvas_sprite.setColorDepth(16);
+  canvas_pixels = (uint16_t *) canvas_sprite.createSprite(M5.Lcd.width(), M5.Lcd.height());
+  if(!canvas_pixels){
+    logger_write(LOG_SYS, LOG_WARN, "unable to allocate the canvas, drawing directly on the LCD");
+    return false;
+  }
+  return true;
+}
+
+
+bool canvas_ready(){
+  return canvas_pixels != NULL;
+}
+
+
+TFT_eSprite &canvas(){
+  return canvas_sprite;
+}
+
+
+uint16_t *canvas_buffer(){
+  return canvas_pixels;
+}
+
+
+void canvas_copy_image(int x, int y, int w, int h, const uint16_t *image, int image_width){
+  int width = M5.Lcd.width();
+  for(int row=0; row<h; row++){
+    const uint16_t *src = image + (y+row)*image_width + x;
+    uint16_t *dst = canvas_pixels + (y+row)*width + x;
+    for(int i=0; i<w; i++)
+      dst[i] = canvas_swap(src[i]);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          canvas_push
+* Description:            send an area of the canvas to the LCD
+*                         The whole area is sent within one address window and one
+*                         SPI transaction. Complete rows are sent in a single burst.
+***************************************************************************************/
+void canvas_push(int x, int y, int w, int h){
+  if(!canvas_pixels || w <= 0 || h <= 0)
+    return;
+  int width = M5.Lcd.width();
+  M5.Lcd.startWrite();
+  M5.Lcd.setWindow(x, y, x+w-1, y+h-1);
+  if(x == 0 && w == width){
+    M5.Lcd.pushColors(canvas_pixels + y*width, w*h, false);
+  } else {
+    for(int row=0; row<h; row++)
+      M5.Lcd.pushColors(canvas_pixels + (y+row)*width + x, w, false);
+  }
+  M5.Lcd.endWrite();
+  if(w == width && h == M5.Lcd.height())
+    canvas_on_screen = true;
+}
@@ -0,0 +1,37 @@
+/******************************************************************************
+ * canvas.h
+ * Off-screen frame buffer of the M5Stack Screen-Capture firmware.
+ *
+ * A 320x240 RGB565 sprite in PSRAM. Frames are composed in the sprite
+ * and the changed area is then sent to the LCD in one SPI transaction
+ * (one address window, no partly drawn frame is ever visible).
+ * While the canvas content is on the screen, it is used as the source
+ * for screenshots instead of reading the pixels back from the LCD.
+ *
+ * The pixels in the sprite buffer are stored in the byte order of the
+ * LCD (high byte first), so they can be sent without conversion.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef CANVAS_H
+#define CANVAS_H
+
+#include <M5Stack.h>
+
+// true: the screen shows the canvas content (set by a full canvas_push)
+extern bool canvas_on_screen;
+
+bool canvas_begin();
+bool canvas_ready();
+TFT_eSprite &canvas();
+// pixel buffer in LCD byte order (NULL if there is no canvas)
+uint16_t *canvas_buffer();
+// copy a part of a RGB565 image (e.g. from the flash) into the canvas
+void canvas_copy_image(int x, int y, int w, int h, const uint16_t *image, int image_width);
+// send an area of the canvas to the LCD
+void canvas_push(int x, int y, int w, int h);
+
+// RGB565 value from a pixel in LCD byte order and the other way round
+inline uint16_t canvas_swap(uint16_t c) { return (c >> 8) | (c << 8); }
+
+#endif
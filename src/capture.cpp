@@ -0,0 +1,220 @@
+/******************************************************************************
+ * capture.cpp
+ * Screen capture routines of the M5Stack Screen-Capture firmware.
+ * See capture.h for a description of the interface.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "capture.h"
+#include <M5Stack.h>
+#include "screen.h"
+#include "file_writer.h"
+
+
+/***************************************************************************************
+* Function name:          M5Screen2ppm
+* Description:            Dump the screen to a ppm image File
+* Image file format:      .ppm
+* return value:           true:  succesfully wrote screen to file
+*                         false: unabel to open or to write the file
+* example for screen capture onto SD-Card: 
+*                         M5Screen2ppm(SD, "/screen.ppm");
+***************************************************************************************/
+bool M5Screen2ppm(fs::FS &fs, const char * path){
+  // Open file for writing
+  // The existing image file will be replaced
+  // (the file is preallocated or an old file of the same size is reused)
+  File file = file_writer_open(fs, path, M5Screen_ppm_filesize());
+  if(file){
+    int image_height = M5.Lcd.height();
+    int image_width = M5.Lcd.width();
+    // write PPM file header
+    //    P6 - magical numer = file format indicator
+    //          P6 =  Binary (raw) format
+    //                16777216 colors (0–255 for each RGB channel)
+    //    \n - CR = Blank space (Spaceholder)
+    //    w h - width and heigt decimal in ASCII (Space-seperated)
+    //    \n - CR = Blank space (Spaceholder)
+    //    cmax - maximum color value (decimal in ASCII)
+    //    \n - CR = Blank space (Spaceholder)
+    // the rows are collected into sector aligned blocks
+    file_writer.begin(file);
+    file_writer.printf("P6\n%d %d\n255\n", image_width, image_height);
+    // To keep the required memory low, the image is captured line by line
+    unsigned char line_data[image_width*3];
+    // The function screen_read_rgb888 reads a screen area and returns the 
+    // RGB 8 bit colour values of each pixel (from the LCD or the canvas)
+    for(int y=0; y<image_height; y++){
+      // get one line of the screen content
+      screen_read_rgb888(0, y, image_width, 1, line_data);
+      // write the line to the file
+      file_writer.write(line_data, image_width*3);
+    }
+    bool ok = file_writer.end();
+    file.close();
+    return ok;
+  }
+  return false;
+}
+
+
+/***************************************************************************************
+* Function name:          M5Screen2bmp
+* Description:            Dump the screen to a bmp image File
+* Image file format:      .bmp
+* return value:           true:  succesfully wrote screen to file
+*                         false: unabel to open or to write the file
+* example for screen capture onto SD-Card: 
+*                         M5Screen2bmp(SD, "/screen.bmp");
+* inspired by: https://stackoverflow.com/a/58395323
+***************************************************************************************/
+bool M5Screen2bmp(fs::FS &fs, const char * path){
+  // Open file for writing
+  // The existing image file will be replaced
+  // (the file is preallocated or an old file of the same size is reused)
+  File file = file_writer_open(fs, path, M5Screen_bmp_filesize());
+  if(file){
+    // M5Stack:      TFT_WIDTH = 240 / TFT_HEIGHT = 320
+    // M5StickC:     TFT_WIDTH =  80 / TFT_HEIGHT = 160
+    // M5StickCplus: TFT_WIDTH =  135 / TFT_HEIGHT = 240
+    int image_height = M5.Lcd.height();
+    int image_width = M5.Lcd.width();
+    // horizontal line must be a multiple of 4 bytes long
+    // add padding to fill lines with 0
+    const uint pad=(4-(3*image_width)%4)%4;
+    unsigned char header[54];
+    M5Screen_bmp_header(header);
+    // write the header to the file
+    // (the header and the rows are collected into sector aligned blocks)
+    file_writer.begin(file);
+    file_writer.write(header, 54);
+    
+    // To keep the required memory low, the image is captured line by line
+    unsigned char line_data[image_width*3+pad];
+    // initialize padded pixel with 0 
+    for(int i=(image_width-1)*3; i<(image_width*3+pad); i++){
+      line_data[i]=0;
+    }
+    // The coordinate origin of a BMP image is at the bottom left.
+    // Therefore, the image must be read from bottom to top.
+    for(int y=image_height; y>0; y--){
+      // get one line of the screen content
+      screen_read_rgb888(0, y-1, image_width, 1, line_data);
+      // BMP color order is: Blue, Green, Red
+      // return values from screen_read_rgb888 is: Red, Green, Blue
+      // therefore: R und B need to be swapped
+      for(int x=0; x<image_width; x++){
+        unsigned char r_buff = line_data[x*3];
+        line_data[x*3] = line_data[x*3+2];
+        line_data[x*3+2] = r_buff;
+      }
+      // write the line to the file
+      file_writer.write(line_data, (image_width*3)+pad);
+    }
+    bool ok = file_writer.end();
+    file.close();
+    return ok;
+  }
+  return false;
+}
+
+/***************************************************************************************
+* Function name:          M5Screen_ppm_filesize
+* Description:            size of the ppm image of the screen in bytes
+***************************************************************************************/
+uint M5Screen_ppm_filesize(){
+  int image_height = M5.Lcd.height();
+  int image_width = M5.Lcd.width();
+  char header[32];
+  int header_size = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", image_width, image_height);
+  return header_size + 3*image_width*image_height;
+}
+
+/***************************************************************************************
+* Function name:          M5Screen_bmp_header
+* Description:            54 byte header of the bmp image of the screen
+*                         (24 bit, bottom-up rows padded to a multiple of 4 bytes)
+***************************************************************************************/
+void M5Screen_bmp_header(unsigned char *header){
+  int image_height = M5.Lcd.height();
+  int image_width = M5.Lcd.width();
+  // header size is 54 bytes:
+  //    File header = 14 bytes
+  //    Info header = 40 bytes
+  uint filesize = M5Screen_bmp_filesize();
+  const unsigned char bmp_header[54] = { 
+    'B','M',  // BMP signature (Windows 3.1x, 95, NT, …)
+    0,0,0,0,  // image file size in bytes
+    0,0,0,0,  // reserved
+    54,0,0,0, // start of pixel array
+    40,0,0,0, // info header size
+    0,0,0,0,  // image width
+    0,0,0,0,  // image height
+    1,0,      // number of color planes
+    24,0,     // bits per pixel
+    0,0,0,0,  // compression
+    0,0,0,0,  // image size (can be 0 for uncompressed images)
+    0,0,0,0,  // horizontal resolution (dpm)
+    0,0,0,0,  // vertical resolution (dpm)
+    0,0,0,0,  // colors in color table (0 = none)
+    0,0,0,0 };// important color count (0 = all colors are important)
+  memcpy(header, bmp_header, 54);
+  // fill filesize, width and heigth in the header array
+  for(uint i=0; i<4; i++) {
+      header[ 2+i] = (char)((filesize>>(8*i))&255);
+      header[18+i] = (char)((image_width   >>(8*i))&255);
+      header[22+i] = (char)((image_height  >>(8*i))&255);
+  }
+}
+
+/***************************************************************************************
+* Function name:          M5Screen_bmp_filesize
+* Description:            size of the bmp image of the screen in bytes
+*                         (e.g. for the Content-Length of the HTTP response)
+***************************************************************************************/
+uint M5Screen_bmp_filesize(){
+  int image_width = M5.Lcd.width();
+  const uint pad=(4-(3*image_width)%4)%4;
+  return 54+(3*image_width+pad)*M5.Lcd.height();
+}
+
+/***************************************************************************************
+* Function name:          M5Screen2bmp
+* Description:            Dump the screen to a WiFi client
+*                         (or any other output, e.g. the buffered HTTP response writer)
+* Image file format:      Content-type:image/bmp
+* return value:           always true
+***************************************************************************************/
+bool M5Screen2bmp(Print &output){
+  int image_height = M5.Lcd.height();
+  int image_width = M5.Lcd.width();
+  const uint pad=(4-(3*image_width)%4)%4;
+  unsigned char header[54];
+  M5Screen_bmp_header(header);
+  // write the header to the file
+  output.write(header, 54);
+  
+  // To keep the required memory low, the image is captured line by line
+  unsigned char line_data[image_width*3+pad];
+  // initialize padded pixel with 0 
+  for(int i=(image_width-1)*3; i<(image_width*3+pad); i++){
+    line_data[i]=0;
+  }
+  // The coordinate origin of a BMP image is at the bottom left.
+  // Therefore, the image must be read from bottom to top.
+  for(int y=image_height; y>0; y--){
+    // get one line of the screen content
+    screen_read_rgb888(0, y-1, image_width, 1, line_data);
+    // BMP color order is: Blue, Green, Red
+    // return values from screen_read_rgb888 is: Red, Green, Blue
+    // therefore: R und B need to be swapped
+    for(int x=0; x<image_width; x++){
+      unsigned char r_buff = line_data[x*3];
+      line_data[x*3] = line_data[x*3+2];
+      line_data[x*3+2] = r_buff;
+    }
+    // write the line to the file
+    output.write(line_data, (image_width*3)+pad);
+  }
+  return true;
+}
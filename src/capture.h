@@ -0,0 +1,25 @@
+/******************************************************************************
+ * capture.h
+ * Screen capture routines of the M5Stack Screen-Capture firmware.
+ * Save a screenshot of the display to the SD card or SPIFFS, or send it
+ * to a network client. The image can be saved in two formats: PPM or BMP.
+ *
+ * example for screen capture onto SD-Card:
+ *   M5Screen2bmp(SD, "/screen.bmp");
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+bool M5Screen2ppm(fs::FS &fs, const char * path);
+bool M5Screen2bmp(fs::FS &fs, const char * path);
+bool M5Screen2bmp(Print &output);
+uint M5Screen_bmp_filesize();
+uint M5Screen_ppm_filesize();
+void M5Screen_bmp_header(unsigned char *header);
+
+#endif
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * capture_name.cpp
+ * File names for the captures of the M5Stack Screen-Capture firmware.
+ * See capture_name.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "capture_name.h"
+#include <Preferences.h>
+#include <time.h>
+#include "logger.h"
+
+#define CAPTURE_NAME_NVS "capture"
+#define CAPTURE_NAME_KEY "reserved"
+// time() of a clock that was set (by NTP), 2021-01-01
+#define CAPTURE_NAME_VALID_TIME 1609459200
+
+static fs::FS *name_fs = NULL;
+static char name_template[CAPTURE_NAME_LEN];
+static Preferences name_prefs;
+// next sequence number and the first number that is not reserved in the NVS
+static uint32_t sequence = 0;
+static uint32_t reserved = 0;
+// last directory created, so it is created only once
+static char last_dir[CAPTURE_NAME_LEN];
+
+
+/***************************************************************************************
+* Function name:          capture_name_begin
+* Description:            load the sequence number from the NVS
+*                         All numbers below the stored limit may have been used before
+*                         the last reset, the sequence continues at the limit.
+***************************************************************************************/
+bool capture_name_begin(fs::FS &fs, const char *new_template){
+  name_fs = &fs;
+  strlcpy(name_template, new_template, sizeof(name_template));
+  last_dir[0] = 0;
+  if(!name_prefs.begin(CAPTURE_NAME_NVS)){
+    logger_write(LOG_CAPTURE, LOG_WARN, "no NVS for the capture numbers, starting at 0");
+    return false;
+  }
+  sequence = reserved = name_prefs.getUInt(CAPTURE_NAME_KEY, 0);
+  logger_write(LOG_CAPTURE, LOG_INFO, "next capture: %u", (unsigned)sequence);
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          make_dirs
+* Description:            create the directories of a path ("/cap/0001/x.bmp": /cap and
+*                         /cap/0001), only when the directory changes
+***************************************************************************************/
+static void make_dirs(const char *path){
+  const char *slash = strrchr(path, '/');
+  if(!slash || slash == path)
+    return;
+  size_t len = slash - path;
+  if(len >= sizeof(last_dir))
+    return;
+  if(strncmp(last_dir, path, len) == 0 && last_dir[len] == 0)
+    return;
+  char dir[CAPTURE_NAME_LEN];
+  for(size_t i=1; i<=len; i++){
+    if(i == len || path[i] == '/'){
+      memcpy(dir, path, i);
+      dir[i] = 0;
+      // an existing directory is not an error
+      name_fs->mkdir(dir);
+    }
+  }
+  memcpy(last_dir, path, len);
+  last_dir[len] = 0;
+}
+
+
+/***************************************************************************************
+* Function name:          format_name
+* Description:            fill in the fields of the template
+***************************************************************************************/
+static void format_name(uint32_t seq, const char *source, char *path, size_t size){
+  size_t n = 0;
+  for(const char *t=name_template; *t && n + 1 < size; t++){
+    if(*t != '%' || !t[1]){
+      path[n++] = *t;
+      continue;
+    }
+    char field[24];
+    field[0] = 0;
+    switch(*++t){
+      case 'n':
+        snprintf(field, sizeof(field), "%06u", (unsigned)seq);
+        break;
+      case 'b':
+        snprintf(field, sizeof(field), "%04u", (unsigned)(seq / CAPTURE_NAME_BUCKET));
+        break;
+      case 't': {
+        time_t now = time(NULL);
+        struct tm tm;
+        if(now >= CAPTURE_NAME_VALID_TIME && localtime_r(&now, &tm))
+          strftime(field, sizeof(field), "%Y%m%d-%H%M%S", &tm);
+        else
+          snprintf(field, sizeof(field), "u%lu", millis() / 1000);
+        break;
+      }
+      case 's':
+        strlcpy(field, source ? source : "", sizeof(field));
+        break;
+      default:
+        field[0] = *t;
+        field[1] = 0;
+        break;
+    }
+    for(const char *f=field; *f && n + 1 < size; f++)
+      path[n++] = *f;
+  }
+  path[n] = 0;
+}
+
+
+/***************************************************************************************
+* Function name:          capture_name_next
+* Description:            file name of the next capture, the NVS is written when the
+*                         reserved numbers are used up (every CAPTURE_NAME_RESERVE captures)
+* return value:           sequence number of the capture
+***************************************************************************************/
+uint32_t capture_name_next(const char *source, char *path, size_t size){
+  uint32_t seq = sequence++;
+  if(seq >= reserved){
+    reserved = seq + CAPTURE_NAME_RESERVE;
+    if(name_prefs.putUInt(CAPTURE_NAME_KEY, reserved) == 0)
+      logger_write(LOG_CAPTURE, LOG_WARN, "unable to store the capture number");
+  }
+  format_name(seq, source, path, size);
+  if(name_fs)
+    make_dirs(path);
+  return seq;
+}
+
+
+uint32_t capture_name_sequence(){
+  return sequence;
+}
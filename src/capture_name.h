@@ -0,0 +1,53 @@
+/******************************************************************************
+ * capture_name.h
+ * File names for the captures of the M5Stack Screen-Capture firmware.
+ *
+ * Every capture gets a new file name from a template, so older captures
+ * are kept. The sequence number is kept in the NVS (Preferences), the
+ * next name is found without looking at the SD card:
+ *  - the counter is reserved in steps of CAPTURE_NAME_RESERVE, the NVS
+ *    is written once per step and not for every capture
+ *  - after a reset or a power loss the counter continues at the reserved
+ *    limit: a few numbers are skipped, none is used twice
+ *  - the files are spread over directories of CAPTURE_NAME_BUCKET files
+ *    (%b), because FAT looks up and creates a file by scanning its
+ *    directory; capture 10000 costs the same as capture 1
+ *
+ * Template fields:
+ *   %n  sequence number (6 digits)
+ *   %b  directory number, sequence / CAPTURE_NAME_BUCKET (4 digits)
+ *   %t  date and time (YYYYMMDD-HHMMSS) if the clock is set,
+ *       otherwise the uptime in seconds (u123456)
+ *   %s  trigger source, e.g. "btnA" or "webC"
+ *   %%  a % character
+ *
+ * example:
+ *   capture_name_begin(SD);
+ *   char path[CAPTURE_NAME_LEN];
+ *   capture_name_next("btnA", path, sizeof(path));  // /cap/0000/000017_btnA.bmp
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef CAPTURE_NAME_H
+#define CAPTURE_NAME_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+#ifndef CAPTURE_NAME_TEMPLATE
+#define CAPTURE_NAME_TEMPLATE "/cap/%b/%n_%s.bmp"
+#endif
+#define CAPTURE_NAME_LEN 48
+// files per directory (%b)
+#define CAPTURE_NAME_BUCKET 256
+// sequence numbers reserved with one NVS write
+#define CAPTURE_NAME_RESERVE 32
+
+bool capture_name_begin(fs::FS &fs, const char *name_template = CAPTURE_NAME_TEMPLATE);
+// file name of the next capture (the directory is created)
+// return value: the sequence number of the capture
+uint32_t capture_name_next(const char *source, char *path, size_t size);
+// sequence number of the next capture
+uint32_t capture_name_sequence();
+
+#endif
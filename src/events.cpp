@@ -0,0 +1,204 @@
+/******************************************************************************
+ * events.cpp
+ * Server-Sent Events feed for the M5Stack Screen-Capture firmware.
+ * See events.h for a description of the events.
+ *
+ * Button and capture events are kept in a small ring with increasing
+ * sequence numbers. Every client remembers the last sequence number it
+ * has received, so one event list serves all clients.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "events.h"
+#include "capture_name.h"
+#include "http_writer.h"
+#include "logger.h"
+#include "frame.h"
+
+// largest event: {"path":"<capture path>","ok":false}
+#define EVENTS_DATA_LEN (CAPTURE_NAME_LEN + 24)
+
+struct event_entry_t {
+  uint32_t seq;
+  const char *type;
+  char data[EVENTS_DATA_LEN];
+};
+
+struct event_client_t {
+  WiFiClient client;
+  bool active;
+  unsigned long interval;
+  unsigned long next_write;
+  unsigned long next_telemetry;
+  uint32_t event_seq;
+  uint32_t gauge_seq;
+};
+
+static event_client_t event_clients[EVENTS_MAX_CLIENTS];
+static event_entry_t event_queue[EVENTS_QUEUE_SIZE];
+// sequence number of the latest queued event (0 = no event yet)
+static uint32_t event_seq = 0;
+static float gauge_value = 0;
+static uint32_t gauge_seq = 0;
+// keep alive comment for proxies and browsers every 15 seconds
+#define EVENTS_KEEPALIVE_MS 15000
+
+
+static void events_push(const char *type, const char *data){
+  event_seq++;
+  event_entry_t &e = event_queue[event_seq % EVENTS_QUEUE_SIZE];
+  e.seq = event_seq;
+  e.type = type;
+  strlcpy(e.data, data, sizeof(e.data));
+}
+
+
+void events_gauge(float value){
+  // the value is coalesced, only the latest one is sent
+  if(value != gauge_value || gauge_seq == 0){
+    gauge_value = value;
+    gauge_seq++;
+  }
+}
+
+
+void events_button(char button){
+  char data[24];
+  snprintf(data, sizeof(data), "{\"button\":\"%c\"}", button);
+  events_push("button", data);
+}
+
+
+void events_capture(const char *path, bool ok){
+  char data[EVENTS_DATA_LEN];
+  int n = snprintf(data, sizeof(data), "{\"path\":\"%.*s\",\"ok\":%s}", CAPTURE_NAME_LEN - 1, path,
+                   ok ? "true" : "false");
+  // a cut off event is no valid JSON
+  if(n < 0 || n >= (int)sizeof(data))
+    return;
+  events_push("capture", data);
+}
+
+
+/***************************************************************************************
+* Function name:          events_accept
+* Description:            answer the request and take over the connection
+* return value:           false if all client slots are in use
+***************************************************************************************/
+bool events_accept(WiFiClient &client, unsigned long interval_ms){
+  event_client_t *c = NULL;
+  for(int i=0; i<EVENTS_MAX_CLIENTS; i++){
+    if(!event_clients[i].active){
+      c = &event_clients[i];
+      break;
+    }
+  }
+  if(!c)
+    return false;
+  http_response.begin(client);
+  http_response.status(200, "OK");
+  http_response.header("Content-type", "text/event-stream");
+  http_response.header("Cache-Control", "no-cache");
+  http_response.header("Connection", "keep-alive");
+  http_response.end_headers();
+  http_response.print("retry: 2000\n\n");
+  http_response.end();
+
+  unsigned long now = millis();
+  c->client = client;
+  c->active = true;
+  c->interval = max(interval_ms, (unsigned long)EVENTS_MIN_INTERVAL_MS);
+  c->next_write = now;
+  // first telemetry event right away
+  c->next_telemetry = now;
+  // only events that happen from now on, but the current gauge value
+  c->event_seq = event_seq;
+  c->gauge_seq = 0;
+  logger_fast(LOG_HTTP, LOG_INFO, "event client %d connected, interval %d ms",
+              (int32_t)(c - event_clients), (int32_t)c->interval);
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          events_flush
+* Description:            send all pending events to one client in a single write
+***************************************************************************************/
+static void events_flush(event_client_t &c, unsigned long now){
+  bool any = false;
+  http_response.begin(c.client);
+  // events that were overwritten in the ring are lost for this client
+  if(event_seq - c.event_seq > EVENTS_QUEUE_SIZE)
+    c.event_seq = event_seq - EVENTS_QUEUE_SIZE;
+  while(c.event_seq != event_seq){
+    c.event_seq++;
+    event_entry_t &e = event_queue[c.event_seq % EVENTS_QUEUE_SIZE];
+    http_response.printf("event: %s\ndata: %s\n\n", e.type, e.data);
+    any = true;
+  }
+  if(c.gauge_seq != gauge_seq){
+    c.gauge_seq = gauge_seq;
+    http_response.printf("event: gauge\ndata: {\"value\":%.1f}\n\n", gauge_value);
+    any = true;
+  }
+  if((long)(now - c.next_telemetry) >= 0){
+    http_response.printf("event: telemetry\ndata: {\"uptime\":%lu,\"heap\":%u,\"rssi\":%d,"
+                         "\"fps\":%.1f,\"cpu\":%.1f,\"skipped\":%u,\"jitter\":%u}\n\n",
+                         now / 1000, (unsigned)ESP.getFreeHeap(), (int)WiFi.RSSI(),
+                         frame_stats.fps, frame_stats.cpu_percent, (unsigned)frame_stats.skipped,
+                         (unsigned)frame_stats.jitter_us);
+    c.next_telemetry = now + EVENTS_TELEMETRY_INTERVAL_MS;
+    any = true;
+  }
+  if(!any && (long)(now - c.next_write) >= EVENTS_KEEPALIVE_MS)
+    http_response.print(": keep-alive\n\n");
+  http_response.end();
+  if(!http_response.ok()){
+    c.client.stop();
+    c.active = false;
+    logger_fast(LOG_HTTP, LOG_INFO, "event client %d closed", (int32_t)(&c - event_clients));
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          events_service
+* Description:            send the pending events to all clients
+*                         needs to be called frequently from loop()
+***************************************************************************************/
+void events_service(){
+  unsigned long now = millis();
+  for(int i=0; i<EVENTS_MAX_CLIENTS; i++){
+    event_client_t &c = event_clients[i];
+    if(!c.active)
+      continue;
+    if(!c.client.connected()){
+      c.client.stop();
+      c.active = false;
+      logger_fast(LOG_HTTP, LOG_INFO, "event client %d closed", i);
+      continue;
+    }
+    // discard anything the client sends
+    while(c.client.available())
+      c.client.read();
+    if((long)(now - c.next_write) < 0)
+      continue;
+    bool pending = (c.event_seq != event_seq) || (c.gauge_seq != gauge_seq) ||
+                   (long)(now - c.next_telemetry) >= 0 ||
+                   (long)(now - c.next_write) >= EVENTS_KEEPALIVE_MS;
+    if(pending){
+      events_flush(c, now);
+      c.next_write = now + c.interval;
+    }
+  }
+}
+
+
+int events_client_count(){
+  int n = 0;
+  for(int i=0; i<EVENTS_MAX_CLIENTS; i++){
+    if(event_clients[i].active)
+      n++;
+  }
+  return n;
+}
@@ -0,0 +1,42 @@
+/******************************************************************************
+ * events.h
+ * Server-Sent Events feed for the M5Stack Screen-Capture firmware.
+ *
+ * A client opens GET /events (optionally /events?interval=<ms>) and keeps
+ * the connection open. The device streams the following events:
+ *   gauge      {"value":42.0}                 latest gauge value (coalesced)
+ *   button     {"button":"A"}                 button press (device or web)
+ *   capture    {"path":"/cap/0000/000017_btnA.bmp","ok":true}   finished capture
+ *   telemetry  {"uptime":123,"heap":123456,"rssi":-60,   every 5 seconds
+ *               "fps":30.0,"cpu":12.5,"skipped":0,"jitter":120}
+ *
+ * Events are batched: a client gets at most one write per interval, which
+ * contains all events since the last write. Several gauge changes within
+ * one interval are reduced to the latest value.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <Arduino.h>
+#include "WiFi.h"
+
+// number of event stream clients served at the same time
+#define EVENTS_MAX_CLIENTS 3
+// default and minimum time between two writes to a client
+#define EVENTS_DEFAULT_INTERVAL_MS 250
+#define EVENTS_MIN_INTERVAL_MS 50
+// time between two telemetry events
+#define EVENTS_TELEMETRY_INTERVAL_MS 5000
+// number of button / capture events kept for the clients
+#define EVENTS_QUEUE_SIZE 16
+
+bool events_accept(WiFiClient &client, unsigned long interval_ms);
+void events_service();
+void events_gauge(float value);
+void events_button(char button);
+void events_capture(const char *path, bool ok);
+int events_client_count();
+
+#endif
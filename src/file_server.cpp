@@ -0,0 +1,372 @@
+/******************************************************************************
+ * file_server.cpp
+ * Download of stored captures for the M5Stack Screen-Capture firmware.
+ * See file_server.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "file_server.h"
+#include <SPIFFS.h>
+#include <time.h>
+#include <atomic>
+#include "frame_hash.h"
+#include "http_writer.h"
+#include "logger.h"
+
+// files with an older time were written before the clock was set
+#define FILE_SERVER_MIN_TIME 1577836800  // 2020-01-01
+
+file_server_stats_t file_server_stats;
+
+struct file_client_t {
+  WiFiClient client;
+  // set before the file is opened, read by the storage task (file_server_busy())
+  std::atomic<bool> active;
+  fs::FS *fs;
+  char path[FILE_SERVER_PATH_LEN];
+  File file;
+  // first byte, next byte to read and end of the range (exclusive)
+  size_t first;
+  size_t pos;
+  size_t end;
+  uint8_t *buffer;
+  size_t buffer_len;
+  size_t buffer_pos;
+  unsigned long deadline;
+  // time spent reading the file
+  unsigned long read_us;
+  size_t read_bytes;
+};
+
+struct content_type_t {
+  const char *extension;
+  const char *type;
+};
+
+static const content_type_t content_types[] = {
+  { ".bmp", "image/bmp" },
+  { ".png", "image/png" },
+  { ".ppm", "image/x-portable-pixmap" },
+  { ".json", "application/json" },
+  { ".txt", "text/plain" },
+  { ".log", "text/plain" },
+  { ".html", "text/html" }
+};
+
+static file_client_t file_clients[FILE_SERVER_CLIENTS];
+// the storage task is choosing or evicting captures (file_server_pause())
+static std::atomic<bool> paused(false);
+
+
+void file_server_begin(){
+  if(!SPIFFS.begin())
+    logger_write(LOG_HTTP, LOG_INFO, "no SPIFFS, GET /spiffs/... is not available");
+}
+
+
+/***************************************************************************************
+* Function name:          normalize_path
+* Description:            one leading slash, no empty or "." segments
+*                         ("//cap/./0000/x.bmp" -> "/cap/0000/x.bmp"), so a download is
+*                         found by file_server_busy() with the path of the capture
+* return value:           false if the path does not fit
+***************************************************************************************/
+static bool normalize_path(const char *path, char *out, size_t size){
+  size_t n = 0;
+  while(*path){
+    while(*path == '/')
+      path++;
+    size_t len = strcspn(path, "/");
+    if(len == 0 || (len == 1 && path[0] == '.')){
+      path += len;
+      continue;
+    }
+    if(n + 1 + len + 1 > size)
+      return false;
+    out[n++] = '/';
+    memcpy(out + n, path, len);
+    n += len;
+    path += len;
+  }
+  out[n] = 0;
+  return n > 0;
+}
+
+
+static const char *content_type(const char *path){
+  const char *ext = strrchr(path, '.');
+  if(ext && !strchr(ext, '/')){
+    for(size_t i=0; i<sizeof(content_types)/sizeof(content_types[0]); i++){
+      if(strcasecmp(ext, content_types[i].extension) == 0)
+        return content_types[i].type;
+    }
+  }
+  // QOI images, capture archives, ...
+  return "application/octet-stream";
+}
+
+
+/***************************************************************************************
+* Function name:          parse_range
+* Description:            parse a Range header with one byte range
+*                         (bytes=a-b, bytes=a- or bytes=-n)
+* return value:           1: range in first..last, 0: no usable range (send the whole
+*                         file), -1: the range is behind the end of the file
+***************************************************************************************/
+static int parse_range(const char *range, size_t size, size_t &first, size_t &last){
+  if(strncasecmp(range, "bytes=", 6) != 0 || strchr(range, ','))
+    return 0;
+  const char *p = range + 6;
+  char *end;
+  if(*p == '-'){
+    // the last n bytes
+    unsigned long n = strtoul(p + 1, &end, 10);
+    if(end == p + 1)
+      return 0;
+    if(n == 0 || size == 0)
+      return -1;
+    first = (n >= size) ? 0 : size - n;
+    last = size - 1;
+    return 1;
+  }
+  first = strtoul(p, &end, 10);
+  if(end == p || *end != '-')
+    return 0;
+  p = end + 1;
+  if(*p == 0){
+    last = size - 1;
+  } else {
+    last = strtoul(p, &end, 10);
+    if(end == p || last < first)
+      return 0;
+  }
+  if(first >= size)
+    return -1;
+  if(last >= size)
+    last = size - 1;
+  return 1;
+}
+
+
+static void send_not_satisfiable(WiFiClient &client, size_t size){
+  char content_range[32];
+  snprintf(content_range, sizeof(content_range), "bytes */%u", (unsigned)size);
+  http_response.begin(client);
+  http_response.status(416, "Range Not Satisfiable");
+  http_response.header("Content-Range", content_range);
+  http_response.header("Content-Length", 0UL);
+  http_response.end_headers();
+  http_response.end();
+}
+
+
+/***************************************************************************************
+* Function name:          file_server_request
+* Description:            check the file and the conditional headers and send the header
+*                         of the response; the data follows from file_server_service()
+* return value:           true if the connection was taken over
+***************************************************************************************/
+bool file_server_request(WiFiClient &client, fs::FS &fs, const char *request_path, const char *range,
+                         const char *if_range, const char *if_none_match){
+  file_server_stats.requests++;
+  char path[FILE_SERVER_PATH_LEN];
+  if(strstr(request_path, "..") || !normalize_path(request_path, path, sizeof(path))){
+    http_send_text(client, 400, "Bad Request", "invalid path");
+    return false;
+  }
+  file_client_t *c = NULL;
+  for(int i=0; i<FILE_SERVER_CLIENTS && !c; i++){
+    if(!file_clients[i].active)
+      c = &file_clients[i];
+  }
+  if(c && !c->buffer){
+    // allocated by the first download of the slot and kept
+    if(psramFound())
+      c->buffer = (uint8_t *) ps_malloc(FILE_SERVER_BUFFER_SIZE);
+    if(!c->buffer)
+      c->buffer = (uint8_t *) malloc(FILE_SERVER_BUFFER_SIZE);
+  }
+  if(!c || !c->buffer){
+    http_send_text(client, 503, "Service Unavailable", "too many downloads", 1);
+    return false;
+  }
+  // claim the file before it is opened: either the storage task sees the claim and
+  // does not evict the file, or the download sees the eviction and backs off
+  c->fs = &fs;
+  strlcpy(c->path, path, sizeof(c->path));
+  c->active = true;
+  if(paused){
+    c->active = false;
+    http_send_text(client, 503, "Service Unavailable", "capture being stored", 1);
+    return false;
+  }
+  File file = fs.open(path, FILE_READ);
+  if(!file || file.isDirectory()){
+    c->active = false;
+    http_send_text(client, 404, "Not Found", "file not found");
+    return false;
+  }
+  size_t size = file.size();
+  time_t modified = file.getLastWrite();
+  // validators: the same path, size and time of the last write
+  char etag[FRAME_HASH_ETAG_LEN];
+  frame_hash_etag(frame_hash64(path, strlen(path), ((uint64_t)modified << 32) | size), etag, sizeof(etag));
+  char last_modified[32] = "";
+  if(modified >= FILE_SERVER_MIN_TIME){
+    struct tm tm;
+    gmtime_r(&modified, &tm);
+    strftime(last_modified, sizeof(last_modified), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+  }
+  if(if_none_match[0] && (strcmp(if_none_match, "*") == 0 || strstr(if_none_match, etag))){
+    file_server_stats.not_modified++;
+    http_response.begin(client);
+    http_response.status(304, "Not Modified");
+    http_response.header("ETag", etag);
+    http_response.end_headers();
+    http_response.end();
+    c->active = false;
+    return false;
+  }
+  size_t first = 0;
+  size_t last = size - 1;
+  int ranged = range[0] ? parse_range(range, size, first, last) : 0;
+  // If-Range: the range only applies to the same version of the file (strong ETag or date)
+  if(ranged != 0 && if_range[0]){
+    bool same = (if_range[0] == '"') ? strcmp(if_range, etag) == 0
+                                     : last_modified[0] && strcmp(if_range, last_modified) == 0;
+    if(!same)
+      ranged = 0;
+  }
+  if(ranged < 0){
+    file_server_stats.not_satisfiable++;
+    send_not_satisfiable(client, size);
+    c->active = false;
+    return false;
+  }
+  if(ranged == 0){
+    first = 0;
+    last = size - 1;
+  }
+  size_t length = (size > 0) ? last - first + 1 : 0;
+  http_response.begin(client);
+  if(ranged > 0){
+    char content_range[48];
+    snprintf(content_range, sizeof(content_range), "bytes %u-%u/%u", (unsigned)first,
+             (unsigned)last, (unsigned)size);
+    http_response.status(206, "Partial Content");
+    http_response.header("Content-Range", content_range);
+    file_server_stats.ranges++;
+  } else {
+    http_response.status(200, "OK");
+  }
+  http_response.header("Content-type", content_type(path));
+  http_response.header("Content-Length", (unsigned long)length);
+  http_response.header("Accept-Ranges", "bytes");
+  http_response.header("ETag", etag);
+  if(last_modified[0])
+    http_response.header("Last-Modified", last_modified);
+  http_response.header("Cache-Control", "no-cache");
+  http_response.end_headers();
+  http_response.end();
+  if(length == 0 || (first > 0 && !file.seek(first))){
+    c->active = false;
+    return false;
+  }
+  c->client = client;
+  c->file = file;
+  c->first = first;
+  c->pos = first;
+  c->end = first + length;
+  c->buffer_len = 0;
+  c->buffer_pos = 0;
+  c->deadline = millis() + FILE_SERVER_TIMEOUT_MS;
+  c->read_us = 0;
+  c->read_bytes = 0;
+  logger_write(LOG_HTTP, LOG_INFO, "sending %s, bytes %u-%u/%u", path, (unsigned)first,
+               (unsigned)last, (unsigned)size);
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          file_server_service
+* Description:            read the next block of the file if the buffer is sent and send
+*                         one slice to every client
+*                         needs to be called frequently from loop()
+***************************************************************************************/
+void file_server_service(){
+  unsigned long now = millis();
+  for(int i=0; i<FILE_SERVER_CLIENTS; i++){
+    file_client_t &c = file_clients[i];
+    if(!c.active)
+      continue;
+    bool done = !c.client.connected() || (long)(now - c.deadline) >= 0;
+    if(!done && c.buffer_pos >= c.buffer_len){
+      // one sequential read of the whole buffer
+      size_t n = min((size_t)FILE_SERVER_BUFFER_SIZE, c.end - c.pos);
+      unsigned long start = micros();
+      c.buffer_len = c.file.read(c.buffer, n);
+      c.read_us += micros() - start;
+      c.read_bytes += c.buffer_len;
+      c.buffer_pos = 0;
+      c.pos += c.buffer_len;
+      // the file was shortened or removed
+      done = (c.buffer_len == 0);
+    }
+    if(!done){
+      size_t n = min((size_t)FILE_SERVER_SLICE_SIZE, c.buffer_len - c.buffer_pos);
+      size_t written = c.client.write(c.buffer + c.buffer_pos, n);
+      c.buffer_pos += written;
+      file_server_stats.bytes += written;
+      // nothing written: the send buffer is full, try again with the next call;
+      // a slow client is dropped if it takes nothing for the timeout
+      if(written > 0)
+        c.deadline = now + FILE_SERVER_TIMEOUT_MS;
+      done = (c.pos >= c.end && c.buffer_pos >= c.buffer_len);
+    }
+    if(done){
+      bool complete = c.pos >= c.end && c.buffer_pos >= c.buffer_len;
+      if(c.read_us > 0)
+        file_server_stats.read_kbps = (uint64_t)c.read_bytes * 1000000 / c.read_us / 1024;
+      logger_write(LOG_HTTP, LOG_INFO, "%s: %u bytes sent%s", c.path,
+                   (unsigned)(c.pos - c.buffer_len + c.buffer_pos - c.first),
+                   complete ? "" : ", incomplete");
+      c.file.close();
+      c.client.stop();
+      c.active = false;
+    }
+  }
+}
+
+
+void file_server_pause(bool pause){
+  paused = pause;
+}
+
+
+bool file_server_busy(fs::FS &fs, const char *path){
+  for(int i=0; i<FILE_SERVER_CLIENTS; i++){
+    // FAT ignores the case of the names
+    if(file_clients[i].active && file_clients[i].fs == &fs && strcasecmp(file_clients[i].path, path) == 0)
+      return true;
+  }
+  return false;
+}
+
+
+size_t file_server_status_json(char *buf, size_t size){
+  int active = 0;
+  for(int i=0; i<FILE_SERVER_CLIENTS; i++){
+    if(file_clients[i].active)
+      active++;
+  }
+  int n = snprintf(buf, size,
+                   "{\"active\":%d,\"requests\":%u,\"ranges\":%u,\"not_satisfiable\":%u,"
+                   "\"not_modified\":%u,\"bytes\":%llu,\"read_kbps\":%u,\"buffer\":%u}",
+                   active, (unsigned)file_server_stats.requests, (unsigned)file_server_stats.ranges,
+                   (unsigned)file_server_stats.not_satisfiable,
+                   (unsigned)file_server_stats.not_modified,
+                   (unsigned long long)file_server_stats.bytes, (unsigned)file_server_stats.read_kbps,
+                   (unsigned)FILE_SERVER_BUFFER_SIZE);
+  return n < 0 ? 0 : min((size_t)n, size - 1);
+}
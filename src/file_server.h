@@ -0,0 +1,82 @@
+/******************************************************************************
+ * file_server.h
+ * Download of stored captures for the M5Stack Screen-Capture firmware.
+ *
+ * GET /sd/<path> and GET /spiffs/<path> send a file of the SD card or the
+ * SPIFFS, e.g. GET /sd/cap/0000/000017_btnA.qoi. A download that breaks
+ * off (weak WiFi) is resumed where it stopped:
+ *  - every response has "Accept-Ranges: bytes", an ETag (path, size and
+ *    time of the last write) and a Last-Modified header if the clock was
+ *    set when the file was written
+ *  - "Range: bytes=a-b", "bytes=a-" and "bytes=-n" are answered with
+ *    206 Partial Content and a Content-Range header; a range behind the
+ *    end of the file with 416 Range Not Satisfiable
+ *  - with If-Range, the range is only sent if the file is unchanged,
+ *    otherwise the whole file (200)
+ *  - If-None-Match with the current ETag is answered with 304
+ *  - more than one range in one request is not supported, the whole file
+ *    is sent (allowed by RFC 9110)
+ * e.g. "curl -C - -O http://<ip>/sd/burst.m5a" resumes a download.
+ *
+ * The file is read in blocks of FILE_SERVER_BUFFER_SIZE bytes (one
+ * sequential SD read per block, into a buffer in PSRAM that is allocated
+ * by the first download and kept), and sent in slices of
+ * FILE_SERVER_SLICE_SIZE bytes from file_server_service(), so loop()
+ * keeps running during the download.
+ *
+ * A file that is being downloaded is not evicted or recycled by the
+ * retention manager (retention.h); a download that starts while captures
+ * are evicted is answered with 503 and Retry-After.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef FILE_SERVER_H
+#define FILE_SERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "WiFi.h"
+
+// number of simultaneous downloads
+#define FILE_SERVER_CLIENTS 2
+// read buffer per download
+#ifndef FILE_SERVER_BUFFER_SIZE
+#define FILE_SERVER_BUFFER_SIZE 32768
+#endif
+// bytes sent to one client per call of file_server_service()
+#define FILE_SERVER_SLICE_SIZE 16384
+// drop a client that takes no data for this time
+#define FILE_SERVER_TIMEOUT_MS 10000
+#define FILE_SERVER_PATH_LEN 64
+
+struct file_server_stats_t {
+  uint32_t requests;
+  // answered with 206 (resumed downloads) / 416 / 304
+  uint32_t ranges;
+  uint32_t not_satisfiable;
+  uint32_t not_modified;
+  uint64_t bytes;
+  // read speed of the file system for the last download
+  uint32_t read_kbps;
+};
+
+extern file_server_stats_t file_server_stats;
+
+// mount the SPIFFS for GET /spiffs/... (the SD card is mounted by M5.begin())
+void file_server_begin();
+// answer a file request; range, if_range, if_none_match: header values ("" = none)
+// return value: true if the connection was taken over (data follows)
+bool file_server_request(WiFiClient &client, fs::FS &fs, const char *path, const char *range,
+                         const char *if_range, const char *if_none_match);
+// send the next slices (call from loop())
+void file_server_service();
+// true if the file is being downloaded; a file being downloaded is not evicted
+// (retention.h), also called from the storage task
+// (request paths are normalized: "//cap/./x.bmp" is "/cap/x.bmp", the case is ignored)
+bool file_server_busy(fs::FS &fs, const char *path);
+// no new downloads while the storage task chooses and evicts captures (503, retry)
+void file_server_pause(bool pause);
+// status as JSON object (for GET /api/files)
+size_t file_server_status_json(char *buf, size_t size);
+
+#endif
@@ -0,0 +1,238 @@
+/******************************************************************************
+ * file_writer.cpp
+ * Block-buffered file writes for the M5Stack Screen-Capture firmware.
+ * See file_writer.h for a description of the interface.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "file_writer.h"
+#include "logger.h"
+
+FileWriter file_writer;
+file_writer_stats_t file_writer_stats;
+
+
+FileWriter::FileWriter(size_t block_size){
+  // the buffer is allocated on the first use (not during static init)
+  buffer = NULL;
+  size = (block_size + FILE_WRITER_SECTOR_SIZE - 1) / FILE_WRITER_SECTOR_SIZE * FILE_WRITER_SECTOR_SIZE;
+  used = 0;
+  limit = size;
+  file = NULL;
+  write_error = false;
+  written = 0;
+  writes = 0;
+  time_us = 0;
+}
+
+
+bool FileWriter::set_block_size(size_t block_size){
+  block_size = (block_size + FILE_WRITER_SECTOR_SIZE - 1) / FILE_WRITER_SECTOR_SIZE * FILE_WRITER_SECTOR_SIZE;
+  if(block_size == 0 || used > 0)
+    return false;
+  if(block_size != size){
+    free(buffer);
+    buffer = NULL;
+    size = block_size;
+  }
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          begin
+* Description:            start writing to a file
+*                         The first block ends at the next block boundary of the file.
+***************************************************************************************/
+void FileWriter::begin(File &new_file){
+  if(!buffer){
+    // blocks of 16 kB and more are taken from the PSRAM
+    if(psramFound())
+      buffer = (uint8_t *) ps_malloc(size);
+    if(!buffer)
+      buffer = (uint8_t *) malloc(size);
+    if(!buffer)
+      logger_write(LOG_CAPTURE, LOG_WARN, "no memory for a %u byte write buffer", (unsigned)size);
+  }
+  file = &new_file;
+  used = 0;
+  limit = size - file->position() % size;
+  write_error = false;
+  written = 0;
+  writes = 0;
+  time_us = 0;
+}
+
+
+bool FileWriter::write_file(const uint8_t *data, size_t len){
+  if(write_error || len == 0)
+    return !write_error;
+  unsigned long start = micros();
+  size_t n = file->write(data, len);
+  time_us += micros() - start;
+  writes++;
+  written += n;
+  if(n != len)
+    write_error = true;
+  return !write_error;
+}
+
+
+bool FileWriter::flush_buffer(){
+  bool ok = write_file(buffer, used);
+  used = 0;
+  limit = size;
+  return ok;
+}
+
+
+size_t FileWriter::write(uint8_t c){
+  return write(&c, 1);
+}
+
+
+/***************************************************************************************
+* Function name:          write
+* Description:            add data to the buffer, full blocks are written to the file
+* return value:           number of bytes accepted
+***************************************************************************************/
+size_t FileWriter::write(const uint8_t *data, size_t len){
+  if(!file || write_error)
+    return 0;
+  if(!buffer)
+    return write_file(data, len) ? len : 0;
+  size_t done = 0;
+  while(done < len && !write_error){
+    if(used == 0 && len - done >= limit){
+      // whole blocks directly from the caller's data
+      size_t n = (len - done - limit) / size * size + limit;
+      write_file(data + done, n);
+      done += n;
+      limit = size;
+      continue;
+    }
+    size_t n = min(len - done, limit - used);
+    memcpy(buffer + used, data + done, n);
+    used += n;
+    done += n;
+    if(used == limit)
+      flush_buffer();
+  }
+  return write_error ? 0 : len;
+}
+
+
+bool FileWriter::end(){
+  if(file && buffer && used > 0)
+    flush_buffer();
+  file = NULL;
+  return !write_error;
+}
+
+
+/***************************************************************************************
+* Function name:          file_writer_open
+* Description:            open a file for a write of known size without cluster
+*                         allocations during the write:
+*                         - an existing file of the same size is overwritten in place
+*                         - otherwise the file is created and expanded to the full size
+*                           (seek behind the end and write the last byte)
+* return value:           the file positioned at 0, or an invalid File on error
+***************************************************************************************/
+File file_writer_open(fs::FS &fs, const char *path, size_t size){
+  if(fs.exists(path)){
+    File file = fs.open(path, "r+");
+    if(file && file.size() == size && file.seek(0)){
+      file_writer_stats.recycled++;
+      return file;
+    }
+    file.close();
+  }
+  File file = fs.open(path, FILE_WRITE);
+  if(!file || size == 0)
+    return file;
+  if(file.seek(size - 1) && file.write((uint8_t)0) == 1 && file.seek(0)){
+    file_writer_stats.preallocated++;
+  } else {
+    // not supported by the file system: the file grows with the writes
+    file.seek(0);
+  }
+  return file;
+}
+
+
+/***************************************************************************************
+* Function name:          capture_file_ms
+* Description:            time to write one file of the size of a BMP capture in ms
+***************************************************************************************/
+static unsigned long capture_file_ms(fs::FS &fs, const char *path, bool preallocate, FileWriter &writer){
+  const size_t file_size = 54 + 320*3*240;
+  uint8_t row[960];
+  memset(row, 0x55, sizeof(row));
+  unsigned long start = micros();
+  File file = preallocate ? file_writer_open(fs, path, file_size) : fs.open(path, FILE_WRITE);
+  if(!file)
+    return 0;
+  writer.begin(file);
+  writer.write(row, 54);
+  for(int y=0; y<240; y++)
+    writer.write(row, sizeof(row));
+  writer.end();
+  file.close();
+  return (micros() - start + 500) / 1000;
+}
+
+
+/***************************************************************************************
+* Function name:          file_writer_benchmark
+* Description:            write FILE_WRITER_BENCHMARK_BYTES in rows of 960 bytes (one BMP
+*                         row) with each block size and log the speed in MB/s
+*                         (including the close, when the file system writes the FAT)
+***************************************************************************************/
+void file_writer_benchmark(fs::FS &fs, const char *path){
+  static const size_t block_sizes[] = { 0, 4096, 16384, 32768 };
+  const size_t row_size = 960;
+  uint8_t row[row_size];
+  for(size_t i=0; i<row_size; i++)
+    row[i] = i;
+  FileWriter writer;
+  for(size_t b=0; b<sizeof(block_sizes)/sizeof(block_sizes[0]); b++){
+    File file = fs.open(path, FILE_WRITE);
+    if(!file){
+      logger_write(LOG_CAPTURE, LOG_ERR, "benchmark: unable to open %s", path);
+      return;
+    }
+    unsigned long start = micros();
+    bool ok = true;
+    if(block_sizes[b] == 0){
+      // unbuffered rows, as before
+      for(size_t n=0; n<FILE_WRITER_BENCHMARK_BYTES && ok; n+=row_size)
+        ok = file.write(row, row_size) == row_size;
+    } else {
+      writer.set_block_size(block_sizes[b]);
+      writer.begin(file);
+      for(size_t n=0; n<FILE_WRITER_BENCHMARK_BYTES && ok; n+=row_size)
+        ok = writer.write(row, row_size) == row_size;
+      ok = writer.end() && ok;
+    }
+    file.close();
+    unsigned long us = micros() - start;
+    float mb_per_s = (FILE_WRITER_BENCHMARK_BYTES / (1024.0f*1024.0f)) / (us / 1000000.0f);
+    if(block_sizes[b] == 0)
+      logger_write(LOG_CAPTURE, LOG_INFO, "SD write, unbuffered rows: %.2f MB/s%s", mb_per_s, ok ? "" : " (failed)");
+    else
+      logger_write(LOG_CAPTURE, LOG_INFO, "SD write, %u kB blocks: %.2f MB/s (%u writes)%s",
+                   (unsigned)(block_sizes[b] / 1024), mb_per_s, (unsigned)writer.file_writes(),
+                   ok ? "" : " (failed)");
+  }
+  // one capture file: new and growing, new and preallocated, recycled
+  writer.set_block_size(FILE_WRITER_BLOCK_SIZE);
+  fs.remove(path);
+  unsigned long growing_ms = capture_file_ms(fs, path, false, writer);
+  fs.remove(path);
+  unsigned long preallocated_ms = capture_file_ms(fs, path, true, writer);
+  unsigned long recycled_ms = capture_file_ms(fs, path, true, writer);
+  logger_write(LOG_CAPTURE, LOG_INFO, "capture file: growing %u ms, preallocated %u ms, recycled %u ms",
+               (unsigned)growing_ms, (unsigned)preallocated_ms, (unsigned)recycled_ms);
+  fs.remove(path);
+}
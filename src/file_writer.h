@@ -0,0 +1,102 @@
+/******************************************************************************
+ * file_writer.h
+ * Block-buffered file writes for the M5Stack Screen-Capture firmware.
+ *
+ * The captures used to write every image row (960 bytes) with its own
+ * file.write(), plus a separate 54 byte header. These writes do not match
+ * the 512 byte sectors and the clusters of the FAT file system, so the SD
+ * driver has to read, merge and write partial sectors.
+ *
+ * The writer collects the data in a buffer of FILE_WRITER_BLOCK_SIZE bytes
+ * (a multiple of 512, in PSRAM if available) and writes full blocks only.
+ * The blocks are aligned to the file offset: a file that is opened for
+ * appending gets a shorter first block, all later blocks start at a
+ * multiple of the block size. Writes that are larger than a block go to
+ * the file directly, in whole blocks, without copying.
+ *
+ * example:
+ *   File file = SD.open("/screen.bmp", FILE_WRITE);
+ *   file_writer.begin(file);
+ *   file_writer.write(header, 54);
+ *   ...
+ *   bool ok = file_writer.end();
+ *   file.close();
+ *
+ * Preallocation: file_writer_open() opens a file of known size so that the
+ * writes never have to allocate clusters. An existing file of the same
+ * size is overwritten in place ("r+", the clusters are recycled); a new
+ * file is expanded to its full size before the first write (one cluster
+ * allocation for the whole file). Either way the capture is a purely
+ * sequential overwrite with a predictable duration.
+ *
+ * Build with -DFILE_WRITER_BENCHMARK to log the sustained write speed to
+ * the SD card for 4, 16 and 32 kB blocks (and unbuffered rows) and the
+ * time of one capture file (growing, preallocated, recycled) at startup.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef FILE_WRITER_H
+#define FILE_WRITER_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+#define FILE_WRITER_SECTOR_SIZE 512
+#ifndef FILE_WRITER_BLOCK_SIZE
+#define FILE_WRITER_BLOCK_SIZE 16384
+#endif
+// amount of data written per block size by the benchmark
+#define FILE_WRITER_BENCHMARK_BYTES (1024*1024)
+
+class FileWriter : public Print {
+  public:
+    FileWriter(size_t block_size = FILE_WRITER_BLOCK_SIZE);
+    // change the block size (rounded up to whole sectors), only between files
+    bool set_block_size(size_t block_size);
+    size_t block_size() { return size; }
+    // start writing at the current position of the file
+    void begin(File &file);
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t len) override;
+    using Print::write;
+    // write the rest of the buffer
+    // return value: true if all data was written since begin()
+    bool end();
+    bool ok() { return !write_error; }
+    // statistics of the current / last file
+    size_t bytes_written() { return written; }
+    uint32_t file_writes() { return writes; }
+    unsigned long write_us() { return time_us; }
+
+  private:
+    bool write_file(const uint8_t *data, size_t len);
+    bool flush_buffer();
+    uint8_t *buffer;
+    size_t size;
+    size_t used;
+    // size of the current block (shorter for the first block of an unaligned file)
+    size_t limit;
+    File *file;
+    bool write_error;
+    size_t written;
+    uint32_t writes;
+    unsigned long time_us;
+};
+
+// writer for the captures of loop() (the storage task has its own one)
+extern FileWriter file_writer;
+
+struct file_writer_stats_t {
+  // files overwritten in place / expanded before writing
+  uint32_t recycled;
+  uint32_t preallocated;
+};
+extern file_writer_stats_t file_writer_stats;
+
+// open a file for writing that will have the given size (positioned at 0)
+File file_writer_open(fs::FS &fs, const char *path, size_t size);
+
+// log the sustained write speed for the different block sizes
+void file_writer_benchmark(fs::FS &fs, const char *path = "/bench.tmp");
+
+#endif
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * frame.cpp
+ * Fixed-rate frame scheduler for the M5Stack Screen-Capture firmware.
+ * See frame.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "frame.h"
+#include "logger.h"
+
+frame_stats_t frame_stats;
+static uint8_t fps = FRAME_DEFAULT_FPS;
+static frame_skip_t skip_policy = FRAME_SKIP_DROP;
+static uint32_t period_us = 1000000 / FRAME_DEFAULT_FPS;
+// start time of the next frame on the time grid
+static unsigned long deadline_us;
+// start of the current frame (0 = no frame running)
+static unsigned long frame_start_us = 0;
+// start of the frame before the current one
+static unsigned long last_start_us = 0;
+static float dt = 0;
+static unsigned long next_stats_ms;
+static uint32_t stats_frames = 0;
+// time slept in frame_idle() and time spent for frames in the stats interval
+static unsigned long stats_start_us;
+static uint32_t stats_idle_us = 0;
+static uint32_t stats_render_us = 0;
+
+
+void frame_begin(uint8_t frames_per_second, frame_skip_t policy){
+  skip_policy = policy;
+  frame_set_fps(frames_per_second);
+  memset(&frame_stats, 0, sizeof(frame_stats));
+  deadline_us = micros();
+  last_start_us = deadline_us;
+  stats_start_us = deadline_us;
+  next_stats_ms = millis() + FRAME_STATS_INTERVAL_MS;
+}
+
+
+void frame_set_fps(uint8_t frames_per_second){
+  if(frames_per_second == 0)
+    frames_per_second = 1;
+  fps = frames_per_second;
+  period_us = 1000000 / fps;
+}
+
+
+uint8_t frame_fps(){
+  return fps;
+}
+
+
+float frame_dt(){
+  return dt;
+}
+
+
+/***************************************************************************************
+* Function name:          frame_start
+* Description:            start the next frame if it is due
+*                         A loop that is late by one or more frame periods draws only
+*                         one frame; the missed ones are counted as skipped.
+* return value:           true if the frame has to be drawn now
+***************************************************************************************/
+bool frame_start(){
+  unsigned long now = micros();
+  long late = (long)(now - deadline_us);
+  if(late < 0)
+    return false;
+  uint32_t missed = late / period_us;
+  if(missed > 0){
+    frame_stats.skipped += missed;
+    if(skip_policy == FRAME_SKIP_RESYNC){
+      deadline_us = now;
+      late = 0;
+    } else {
+      deadline_us += missed * period_us;
+      late -= missed * period_us;
+    }
+  }
+  deadline_us += period_us;
+  if((uint32_t)late > frame_stats.late_max_us)
+    frame_stats.late_max_us = late;
+  // moving average over 16 frames
+  frame_stats.jitter_us += ((long)late - (long)frame_stats.jitter_us) / 16;
+  frame_start_us = now;
+  dt = min((now - last_start_us) / 1000000.0f, 0.1f);
+  last_start_us = now;
+  return true;
+}
+
+
+long frame_budget_left_us(){
+  if(frame_start_us == 0)
+    return 0;
+  long budget = period_us * FRAME_BUDGET_PERCENT / 100;
+  return budget - (long)(micros() - frame_start_us);
+}
+
+
+long frame_idle_left_us(){
+  return (long)(deadline_us - micros());
+}
+
+
+/***************************************************************************************
+* Function name:          frame_end
+* Description:            finish the current frame and update the statistics
+***************************************************************************************/
+void frame_end(){
+  if(frame_start_us == 0)
+    return;
+  uint32_t render_us = micros() - frame_start_us;
+  if(frame_budget_left_us() < 0)
+    frame_stats.over_budget++;
+  frame_start_us = 0;
+  frame_stats.frames++;
+  stats_frames++;
+  if(render_us > frame_stats.render_max_us)
+    frame_stats.render_max_us = render_us;
+  frame_stats.render_avg_us += ((long)render_us - (long)frame_stats.render_avg_us) / 16;
+  stats_render_us += render_us;
+  unsigned long now_ms = millis();
+  if((long)(now_ms - next_stats_ms) >= 0){
+    unsigned long now_us = micros();
+    float elapsed_us = now_us - stats_start_us;
+    frame_stats.fps = stats_frames * 1000000.0f / elapsed_us;
+    frame_stats.cpu_percent = 100.0f - stats_idle_us * 100.0f / elapsed_us;
+    frame_stats.render_percent = stats_render_us * 100.0f / elapsed_us;
+    stats_frames = 0;
+    stats_idle_us = 0;
+    stats_render_us = 0;
+    stats_start_us = now_us;
+    next_stats_ms = now_ms + FRAME_STATS_INTERVAL_MS;
+    logger_write(LOG_SYS, LOG_INFO, "frames: %.1f/%u fps, cpu %.1f%%, render %.1f%%, %u skipped, "
+                 "%u over budget, jitter %u us, late max %u us, render %u/%u us",
+                 frame_stats.fps, (unsigned)fps, frame_stats.cpu_percent, frame_stats.render_percent,
+                 (unsigned)frame_stats.skipped, (unsigned)frame_stats.over_budget,
+                 (unsigned)frame_stats.jitter_us, (unsigned)frame_stats.late_max_us,
+                 (unsigned)frame_stats.render_avg_us, (unsigned)frame_stats.render_max_us);
+    frame_stats.late_max_us = 0;
+    frame_stats.render_max_us = 0;
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          frame_idle
+* Description:            sleep until the next frame is due, at most FRAME_IDLE_MAX_MS
+*                         (replaces the fixed delay at the end of loop())
+***************************************************************************************/
+void frame_idle(){
+  unsigned long start = micros();
+  long wait_us = (long)(deadline_us - start);
+  if(wait_us >= 1000)
+    delay(min(wait_us / 1000, (long)FRAME_IDLE_MAX_MS));
+  else
+    yield();
+  stats_idle_us += micros() - start;
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * frame.h
+ * Fixed-rate frame scheduler for the M5Stack Screen-Capture firmware.
+ *
+ * The frames are placed on a fixed time grid (1/fps). loop() asks with
+ * frame_start() whether the next frame is due, draws it and calls
+ * frame_end(). Between the frames, frame_idle() sleeps until the next
+ * frame, but never longer than FRAME_IDLE_MAX_MS, so the web server and
+ * the buttons are polled independently of the frame rate.
+ *
+ * Frame skip policy, if the loop was late by one or more frame periods:
+ *   FRAME_SKIP_DROP    the missed frames are dropped, the time grid stays
+ *   FRAME_SKIP_RESYNC  the time grid starts again with the late frame
+ * In both cases only one frame is drawn, never a burst of late frames.
+ *
+ * Statistics (frame_stats):
+ *   skipped      frames dropped because the loop was late
+ *   over_budget  frames that took longer than the render budget
+ *                (FRAME_BUDGET_PERCENT of the frame period)
+ *   late_max_us  largest delay of a frame start after its deadline
+ *   jitter_us    mean delay of the frame start (moving average)
+ *   cpu_percent  share of the time loop() did not sleep in frame_idle()
+ *   render_percent  share of the time spent between frame_start/frame_end
+ * Every FRAME_STATS_INTERVAL_MS the frame rate and the stats are logged.
+ * The frame rate is the upper limit (frame cap): a frame that has nothing
+ * to draw costs almost nothing, so the CPU usage shows the real cost of
+ * a frame rate and can be weighed against the network responsiveness.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <Arduino.h>
+
+#define FRAME_DEFAULT_FPS 30
+// share of the frame period that is planned for drawing
+#define FRAME_BUDGET_PERCENT 50
+// maximum sleep time between two loop() runs
+#define FRAME_IDLE_MAX_MS 5
+#define FRAME_STATS_INTERVAL_MS 10000
+
+enum frame_skip_t {
+  FRAME_SKIP_DROP,
+  FRAME_SKIP_RESYNC
+};
+
+struct frame_stats_t {
+  uint32_t frames;
+  uint32_t skipped;
+  uint32_t over_budget;
+  uint32_t late_max_us;
+  uint32_t jitter_us;
+  uint32_t render_avg_us;
+  uint32_t render_max_us;
+  // values of the last stats interval
+  float fps;
+  float cpu_percent;
+  float render_percent;
+};
+
+extern frame_stats_t frame_stats;
+
+void frame_begin(uint8_t fps, frame_skip_t policy = FRAME_SKIP_DROP);
+void frame_set_fps(uint8_t fps);
+uint8_t frame_fps();
+// true if the next frame is due (the frame is started)
+bool frame_start();
+void frame_end();
+// time between the start of the last two frames in seconds (max. 0.1)
+float frame_dt();
+// remaining render budget of the current frame (negative: over budget)
+long frame_budget_left_us();
+// time until the next frame is due (for work in the idle time, negative: late)
+long frame_idle_left_us();
+void frame_idle();
+
+#endif
@@ -0,0 +1,214 @@
+/******************************************************************************
+ * frame_hash.cpp
+ * Content hash of the screen for the M5Stack Screen-Capture firmware.
+ * See frame_hash.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "frame_hash.h"
+#include <M5Stack.h>
+#include "screen.h"
+
+#define PRIME64_1 0x9E3779B185EBCA87ULL
+#define PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME64_3 0x165667B19E3779F9ULL
+#define PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define PRIME64_5 0x27D4EB2F165667C5ULL
+
+frame_hash_stats_t frame_hash_stats;
+frame_dedup_t frame_dedup[DEDUP_TARGETS];
+
+static const char *target_names[DEDUP_TARGETS] = { "storage", "snapshot", "http" };
+// hash of the screen generation cached_generation
+static uint64_t cached_hash;
+static uint32_t cached_generation;
+static bool cached_valid = false;
+// rows of the screen for frame_hash_screen()
+static uint16_t *strip = NULL;
+
+
+static inline uint64_t rotl64(uint64_t x, int r){
+  return (x << r) | (x >> (64 - r));
+}
+
+
+// little endian reads, word loads if aligned (the ESP32 has no unaligned loads)
+static inline uint64_t read64(const uint8_t *p){
+  if(((uintptr_t)p & 3) == 0){
+    const uint32_t *w = (const uint32_t *) p;
+    return w[0] | ((uint64_t)w[1] << 32);
+  }
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+
+static inline uint32_t read32(const uint8_t *p){
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+
+static inline uint64_t round64(uint64_t acc, uint64_t input){
+  acc += input * PRIME64_2;
+  acc = rotl64(acc, 31);
+  return acc * PRIME64_1;
+}
+
+
+static inline uint64_t merge64(uint64_t acc, uint64_t val){
+  acc ^= round64(0, val);
+  return acc * PRIME64_1 + PRIME64_4;
+}
+
+
+/***************************************************************************************
+* Function name:          frame_hash64
+* Description:            XXH64 of a memory block (same values as the reference code)
+***************************************************************************************/
+uint64_t frame_hash64(const void *data, size_t len, uint64_t seed){
+  const uint8_t *p = (const uint8_t *) data;
+  const uint8_t *end = p + len;
+  uint64_t h;
+  if(len >= 32){
+    const uint8_t *limit = end - 32;
+    uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+    uint64_t v2 = seed + PRIME64_2;
+    uint64_t v3 = seed;
+    uint64_t v4 = seed - PRIME64_1;
+    do {
+      v1 = round64(v1, read64(p));
+      v2 = round64(v2, read64(p + 8));
+      v3 = round64(v3, read64(p + 16));
+      v4 = round64(v4, read64(p + 24));
+      p += 32;
+    } while(p <= limit);
+    h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+    h = merge64(h, v1);
+    h = merge64(h, v2);
+    h = merge64(h, v3);
+    h = merge64(h, v4);
+  } else {
+    h = seed + PRIME64_5;
+  }
+  h += (uint64_t) len;
+  while(p + 8 <= end){
+    h ^= round64(0, read64(p));
+    h = rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+    p += 8;
+  }
+  if(p + 4 <= end){
+    h ^= (uint64_t) read32(p) * PRIME64_1;
+    h = rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+    p += 4;
+  }
+  while(p < end){
+    h ^= (*p++) * PRIME64_5;
+    h = rotl64(h, 11) * PRIME64_1;
+  }
+  h ^= h >> 33;
+  h *= PRIME64_2;
+  h ^= h >> 29;
+  h *= PRIME64_3;
+  h ^= h >> 32;
+  return h;
+}
+
+
+/***************************************************************************************
+* Function name:          hash_screen
+* Description:            read the screen strip by strip and hash every strip after it
+*                         has been read, the hash of a strip is the seed of the next one
+*                         pixels = NULL: the strips are read into the strip buffer
+***************************************************************************************/
+static uint64_t hash_screen(uint16_t *pixels){
+  unsigned long start = micros();
+  int width = M5.Lcd.width();
+  int height = M5.Lcd.height();
+  uint32_t generation = screen_generation;
+  uint64_t hash = 0;
+  for(int y=0; y<height; y+=FRAME_HASH_STRIP_ROWS){
+    int rows = min(FRAME_HASH_STRIP_ROWS, height - y);
+    uint16_t *dst = pixels ? pixels + y*width : strip;
+    screen_read_rgb565(0, y, width, rows, dst);
+    hash = frame_hash64(dst, width * rows * sizeof(uint16_t), hash);
+  }
+  frame_hash_stats.hash_us = micros() - start;
+  frame_hash_stats.hashed++;
+  cached_hash = hash;
+  cached_generation = generation;
+  cached_valid = true;
+  return hash;
+}
+
+
+uint64_t frame_hash_capture(uint16_t *pixels){
+  return hash_screen(pixels);
+}
+
+
+bool frame_hash_current(){
+  return cached_valid && cached_generation == screen_generation;
+}
+
+
+uint64_t frame_hash_screen(){
+  if(frame_hash_current()){
+    frame_hash_stats.cached++;
+    return cached_hash;
+  }
+  if(!strip){
+    strip = (uint16_t *) malloc(M5.Lcd.width() * FRAME_HASH_STRIP_ROWS * sizeof(uint16_t));
+    // no memory: every screen generation is a new frame
+    if(!strip)
+      return screen_generation;
+  }
+  return hash_screen(NULL);
+}
+
+
+void frame_hash_etag(uint64_t hash, char *buf, size_t size){
+  snprintf(buf, size, "\"%08x%08x\"", (unsigned)(hash >> 32), (unsigned)hash);
+}
+
+
+bool frame_dedup_check(frame_target_t target, uint64_t hash){
+  frame_dedup_t &t = frame_dedup[target];
+  bool hit = t.valid && t.hash == hash;
+  t.hash = hash;
+  t.valid = true;
+  frame_dedup_count(target, hit);
+  return hit;
+}
+
+
+void frame_dedup_count(frame_target_t target, bool hit){
+  if(hit)
+    frame_dedup[target].hits++;
+  else
+    frame_dedup[target].misses++;
+}
+
+
+void frame_dedup_forget(frame_target_t target){
+  frame_dedup[target].valid = false;
+}
+
+
+size_t frame_hash_status_json(char *buf, size_t size){
+  int n = snprintf(buf, size, "{\"hashed\":%u,\"cached\":%u,\"hash_us\":%u",
+                   (unsigned)frame_hash_stats.hashed, (unsigned)frame_hash_stats.cached,
+                   (unsigned)frame_hash_stats.hash_us);
+  for(int i=0; i<DEDUP_TARGETS && n >= 0 && (size_t)n < size; i++){
+    frame_dedup_t &t = frame_dedup[i];
+    uint32_t total = t.hits + t.misses;
+    n += snprintf(buf + n, size - n, ",\"%s\":{\"hits\":%u,\"misses\":%u,\"hit_rate\":%.1f}",
+                  target_names[i], (unsigned)t.hits, (unsigned)t.misses,
+                  total ? 100.0 * t.hits / total : 0.0);
+  }
+  if(n >= 0 && (size_t)n < size)
+    n += snprintf(buf + n, size - n, "}");
+  return n < 0 ? 0 : min((size_t)n, size - 1);
+}
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * frame_hash.h
+ * Content hash of the screen for the M5Stack Screen-Capture firmware.
+ *
+ * A capture of a screen that did not change since the last capture is
+ * not worth encoding: the SD card gets the same 230 kB file again and a
+ * polling client downloads the same image again. Every frame gets a
+ * 64-bit hash (XXH64 algorithm) of its RGB565 pixels:
+ *  - the screen is hashed in strips of FRAME_HASH_STRIP_ROWS rows, each
+ *    strip right after it has been read (while it is in the cache), so
+ *    the hash costs no extra pass when the frame is copied anyway
+ *  - the hash of the current screen is kept until the screen generation
+ *    changes, hashing an unchanged screen costs nothing
+ *  - the hash is independent of screen_generation: a needle that moves
+ *    away and back gives the same hash again
+ *
+ * Each target (the capture files, the screenshot snapshot, the HTTP
+ * clients) keeps the hash of its last frame. frame_dedup_check() compares
+ * a new frame with it and counts the hits, GET /api/dedup reports the hit
+ * rates.
+ *
+ * example:
+ *   uint64_t hash = frame_hash_screen();
+ *   if(frame_dedup_check(DEDUP_STORAGE, hash))
+ *     return;  // same frame as the last capture
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef FRAME_HASH_H
+#define FRAME_HASH_H
+
+#include <Arduino.h>
+
+// rows per strip (strip buffer: width * rows * 2 bytes)
+#define FRAME_HASH_STRIP_ROWS 8
+// quoted hash for the ETag header: "0123456789abcdef"
+#define FRAME_HASH_ETAG_LEN 20
+
+enum frame_target_t {
+  // last capture queued for the SD card
+  DEDUP_STORAGE,
+  // snapshot of the screenshot requests (encoded once per frame)
+  DEDUP_SNAPSHOT,
+  // conditional requests (If-None-Match) answered with 304 Not Modified
+  DEDUP_HTTP,
+  DEDUP_TARGETS
+};
+
+struct frame_dedup_t {
+  uint64_t hash;
+  bool valid;
+  // frames that were skipped / frames that were new
+  uint32_t hits;
+  uint32_t misses;
+};
+
+struct frame_hash_stats_t {
+  // hashes calculated and hashes taken from the cache (screen unchanged)
+  uint32_t hashed;
+  uint32_t cached;
+  // time of the last hash of the full screen
+  uint32_t hash_us;
+};
+
+extern frame_hash_stats_t frame_hash_stats;
+extern frame_dedup_t frame_dedup[DEDUP_TARGETS];
+
+// 64-bit hash of a memory block (XXH64)
+uint64_t frame_hash64(const void *data, size_t len, uint64_t seed);
+// read the screen into pixels (width * height RGB565 values) and hash it on the way
+uint64_t frame_hash_capture(uint16_t *pixels);
+// hash of the current screen (calculated once per screen generation)
+uint64_t frame_hash_screen();
+// true if frame_hash_screen() knows the hash of the current screen already
+bool frame_hash_current();
+// hash as quoted ETag value
+void frame_hash_etag(uint64_t hash, char *buf, size_t size);
+// true if the hash is the same as the last frame of the target (a hit),
+// otherwise the hash is remembered as the last frame
+bool frame_dedup_check(frame_target_t target, uint64_t hash);
+// count a hit or miss that was decided elsewhere (e.g. by the client's ETag)
+void frame_dedup_count(frame_target_t target, bool hit);
+// the last frame of the target is gone (e.g. the file was not written)
+void frame_dedup_forget(frame_target_t target);
+// hit rates as JSON object (for GET /api/dedup)
+size_t frame_hash_status_json(char *buf, size_t size);
+
+#endif
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * gauge_bg.cpp
+ * Streaming decoder for the compressed gauge background image.
+ * See gauge_bg.h for a description and tools/compress_gauge.py for the
+ * data format.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "gauge_bg.h"
+#include <M5Stack.h>
+#include "gauge_rle.h"
+#include "logger.h"
+
+#define GAUGE_RLE_ESCAPE 0xFF
+// rows per pushImage() call in gauge_bg_push_rect()
+#define GAUGE_BG_STRIP_ROWS 8
+
+
+static inline uint16_t read_color(const uint8_t *&p){
+  uint8_t index = pgm_read_byte(p++);
+  if(index != GAUGE_RLE_ESCAPE)
+    return pgm_read_word(&gauge_rle_palette[index]);
+  uint16_t color = pgm_read_byte(p) | (pgm_read_byte(p+1) << 8);
+  p += 2;
+  return color;
+}
+
+
+/***************************************************************************************
+* Function name:          gauge_bg_decode_row
+* Description:            decode a part of one row of the background image
+*                         Runs in front of x are skipped without decoding the colors.
+***************************************************************************************/
+void gauge_bg_decode_row(int y, int x, int w, uint16_t *out, bool swap){
+  const uint8_t *p = gauge_rle_data + pgm_read_dword(&gauge_rle_rows[y]);
+  int pos = 0;
+  int end = x + w;
+  while(pos < end){
+    uint8_t token = pgm_read_byte(p++);
+    if(token < 0x80){
+      // run of identical pixels
+      int count = token + 1;
+      if(pos + count <= x){
+        // skip the color
+        p += (pgm_read_byte(p) == GAUGE_RLE_ESCAPE) ? 3 : 1;
+        pos += count;
+        continue;
+      }
+      uint16_t color = read_color(p);
+      if(swap)
+        color = (color >> 8) | (color << 8);
+      int from = max(pos, x);
+      int to = min(pos + count, end);
+      for(int i=from; i<to; i++)
+        out[i - x] = color;
+      pos += count;
+    } else {
+      // literal pixels
+      int count = token - 0x7F;
+      for(int i=0; i<count; i++, pos++){
+        uint16_t color = read_color(p);
+        if(pos >= x && pos < end)
+          out[pos - x] = swap ? (color >> 8) | (color << 8) : color;
+      }
+    }
+  }
+}
+
+
+void gauge_bg_decode_rect(int x, int y, int w, int h, uint16_t *out, int stride, bool swap){
+  for(int row=0; row<h; row++)
+    gauge_bg_decode_row(y + row, x, w, out + row*stride, swap);
+}
+
+
+/***************************************************************************************
+* Function name:          gauge_bg_push_rect
+* Description:            draw a rectangle of the background on the LCD
+*                         The rectangle is decoded in strips of a few rows, each strip
+*                         is sent with one pushImage() call. The optional overlay
+*                         function draws into the strip before it is sent, so the
+*                         LCD shows every pixel only once.
+***************************************************************************************/
+void gauge_bg_push_rect(int x, int y, int w, int h, gauge_bg_overlay_t overlay){
+  static uint16_t strip[GAUGE_BG_WIDTH * GAUGE_BG_STRIP_ROWS];
+  for(int row=0; row<h; row+=GAUGE_BG_STRIP_ROWS){
+    int n = min(GAUGE_BG_STRIP_ROWS, h - row);
+    gauge_bg_decode_rect(x, y + row, w, n, strip, w, false);
+    if(overlay)
+      overlay(strip, x, y + row, w, n);
+    M5.Lcd.pushImage(x, y + row, w, n, strip);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          gauge_bg_benchmark
+* Description:            log the throughput of the decoder and of reading the raw
+*                         image from the flash (only with -DGAUGE_BG_BENCHMARK)
+***************************************************************************************/
+#ifdef GAUGE_BG_BENCHMARK
+#include "gauge.h"
+
+void gauge_bg_benchmark(){
+  static uint16_t row[GAUGE_BG_WIDTH];
+  const int rounds = 10;
+  uint32_t checksum = 0;
+  unsigned long start = micros();
+  for(int r=0; r<rounds; r++){
+    for(int y=0; y<GAUGE_BG_HEIGHT; y++){
+      gauge_bg_decode_row(y, 0, GAUGE_BG_WIDTH, row, true);
+      checksum += row[y];
+    }
+  }
+  unsigned long decode_us = micros() - start;
+  start = micros();
+  for(int r=0; r<rounds; r++){
+    for(int y=0; y<GAUGE_BG_HEIGHT; y++){
+      memcpy_P(row, gauge_pic + y*GAUGE_BG_WIDTH, sizeof(row));
+      checksum += row[y];
+    }
+  }
+  unsigned long raw_us = micros() - start;
+  // bytes of RGB565 output per microsecond = MB/s
+  uint32_t bytes = rounds * GAUGE_BG_WIDTH * GAUGE_BG_HEIGHT * 2;
+  logger_fast(LOG_SYS, LOG_INFO, "background decode: %d kB/ms, raw flash read: %d kB/ms (%d)",
+              bytes / decode_us, bytes / raw_us, checksum & 1);
+}
+#else
+void gauge_bg_benchmark(){
+}
+#endif
@@ -0,0 +1,34 @@
+/******************************************************************************
+ * gauge_bg.h
+ * Streaming decoder for the compressed gauge background image.
+ *
+ * The background is stored as palette + run-length data (gauge_rle.h,
+ * 21.5 kB instead of 153.6 kB for the raw RGB565 array in gauge.h).
+ * Every row can be decoded on its own, so any rectangle of the image
+ * can be produced without decoding the rest of the image.
+ *
+ * Build with -DGAUGE_BG_BENCHMARK to log the decode throughput compared
+ * with reading the raw image from the flash at startup.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef GAUGE_BG_H
+#define GAUGE_BG_H
+
+#include <Arduino.h>
+
+#define GAUGE_BG_WIDTH 320
+#define GAUGE_BG_HEIGHT 240
+
+// decode w pixels of row y starting at x
+// swap = true: pixels in LCD byte order (e.g. for the canvas buffer)
+void gauge_bg_decode_row(int y, int x, int w, uint16_t *out, bool swap);
+// decode a rectangle into a buffer with the given row stride (in pixels)
+void gauge_bg_decode_rect(int x, int y, int w, int h, uint16_t *out, int stride, bool swap);
+// called for every strip before it is sent, to draw on top of the background
+typedef void (*gauge_bg_overlay_t)(uint16_t *pixels, int x, int y, int w, int h);
+// draw a rectangle of the background directly on the LCD (strip by strip)
+void gauge_bg_push_rect(int x, int y, int w, int h, gauge_bg_overlay_t overlay = NULL);
+void gauge_bg_benchmark();
+
+#endif
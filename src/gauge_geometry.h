@@ -0,0 +1,170 @@
+/******************************************************************************
+ * gauge_geometry.h
+ * Integer-only geometry of the gauge needle.
+ *
+ * The sine and cosine of all needle angles (0.1% steps) and the rotation
+ * matrices for the +4.5 / -4.5 deg triangle corners are calculated by the
+ * compiler (constexpr) and stored as fixed-point numbers in the flash.
+ * At runtime, the needle endpoints are calculated with a few integer
+ * multiplications, without any float or trigonometric function.
+ *
+ * The results are identical to the former float calculation:
+ *   angle = (239.0-((val/100)*298)) * DEG2RAD;
+ *   x = roundf(r * cos(angle)); y = roundf(-r * sin(angle));
+ * for all 1001 table values (checked against the float version).
+ *
+ * 0%   = 239 deg
+ * 100% = -59 deg
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef GAUGE_GEOMETRY_H
+#define GAUGE_GEOMETRY_H
+
+#include <stdint.h>
+
+// number of steps between 0% and 100% (0.1% resolution)
+#define GAUGE_STEPS 1000
+// fixed-point format of the tables: Q14 (1.0 = 16384)
+#define GAUGE_Q 14
+
+namespace gauge_geometry {
+
+constexpr double pi = 3.14159265358979323846;
+
+// Taylor series, precise to the last bit of a double for |x| <= pi
+constexpr double taylor_sin(double x){
+  while(x > pi) x -= 2*pi;
+  while(x < -pi) x += 2*pi;
+  double term = x;
+  double sum = x;
+  for(int n=1; n<12; n++){
+    term *= -x*x / ((2*n) * (2*n+1));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double taylor_cos(double x){
+  return taylor_sin(x + pi/2);
+}
+
+constexpr int16_t to_fixed(double v){
+  return (int16_t)(v * (1 << GAUGE_Q) + (v >= 0 ? 0.5 : -0.5));
+}
+
+struct trig_table_t {
+  int16_t sin[GAUGE_STEPS+1];
+  int16_t cos[GAUGE_STEPS+1];
+};
+
+constexpr trig_table_t make_trig_table(){
+  trig_table_t t{};
+  for(int i=0; i<=GAUGE_STEPS; i++){
+    double angle = (239.0 - i * (298.0 / GAUGE_STEPS)) * (pi / 180);
+    t.sin[i] = to_fixed(taylor_sin(angle));
+    t.cos[i] = to_fixed(taylor_cos(angle));
+  }
+  return t;
+}
+
+constexpr trig_table_t trig = make_trig_table();
+// rotation by 4.5 deg for the corners of the arrow triangle
+constexpr int32_t rot_cos = to_fixed(taylor_cos(4.5 * pi / 180));
+constexpr int32_t rot_sin = to_fixed(taylor_sin(4.5 * pi / 180));
+
+// round a fixed-point value to an integer (half away from zero, like roundf)
+inline int round_fixed(int32_t v){
+  const int32_t half = 1 << (GAUGE_Q - 1);
+  return v >= 0 ? (int)((v + half) >> GAUGE_Q) : -(int)((-v + half) >> GAUGE_Q);
+}
+
+} // namespace gauge_geometry
+
+
+struct gauge_needle_t {
+  // tip of the arrow
+  int16_t x2, y2;
+  // the two other corners of the arrow triangle
+  int16_t x3, y3, x4, y4;
+};
+
+// the same corners as fixed-point numbers (sub-pixel positions)
+struct gauge_needle_fixed_t {
+  int32_t x2, y2;
+  int32_t x3, y3, x4, y4;
+};
+
+/***************************************************************************************
+* Function name:          gauge_index
+* Description:            table index of a gauge value (0..100 -> 0..GAUGE_STEPS)
+***************************************************************************************/
+inline int gauge_index(float val){
+  int index = (int)(val * (GAUGE_STEPS / 100) + 0.5f);
+  if(index < 0) index = 0;
+  if(index > GAUGE_STEPS) index = GAUGE_STEPS;
+  return index;
+}
+
+/***************************************************************************************
+* Function name:          gauge_tip
+* Description:            endpoint of a line with the given length from (x0,y0)
+*                         pointing to the gauge value with the given index
+***************************************************************************************/
+inline void gauge_tip(int index, int length, int x0, int y0, int &x, int &y){
+  x = x0 + gauge_geometry::round_fixed(length * gauge_geometry::trig.cos[index]);
+  y = y0 - gauge_geometry::round_fixed(length * gauge_geometry::trig.sin[index]);
+}
+
+/***************************************************************************************
+* Function name:          gauge_arrow
+* Description:            corners of the arrow triangle (tip at the given length, base
+*                         at the center (x0,y0) rotated by -4.5 and +4.5 deg around the tip)
+***************************************************************************************/
+inline void gauge_arrow(int index, int length, int x0, int y0, gauge_needle_t &n){
+  using namespace gauge_geometry;
+  int x2, y2;
+  gauge_tip(index, length, x0, y0, x2, y2);
+  // vector from the tip to the center
+  int32_t dx = x0 - x2;
+  int32_t dy = y0 - y2;
+  n.x2 = x2;
+  n.y2 = y2;
+  // rotated by -4.5 deg
+  n.x3 = x2 + round_fixed(dx * rot_cos - dy * rot_sin);
+  n.y3 = y2 + round_fixed(dx * rot_sin + dy * rot_cos);
+  // rotated by +4.5 deg
+  n.x4 = x2 + round_fixed(dx * rot_cos + dy * rot_sin);
+  n.y4 = y2 + round_fixed(-dx * rot_sin + dy * rot_cos);
+}
+
+/***************************************************************************************
+* Function name:          gauge_tip_fixed
+* Description:            like gauge_tip(), but the start point (x0,y0) and the result
+*                         are fixed-point numbers with the given number of fractional bits
+*                         (used for anti-aliased drawing)
+***************************************************************************************/
+inline void gauge_tip_fixed(int index, int length, int32_t x0, int32_t y0, int bits,
+                            int32_t &x, int32_t &y){
+  using namespace gauge_geometry;
+  // Q14 -> Q(bits)
+  x = x0 + round_fixed((length * trig.cos[index]) << bits);
+  y = y0 - round_fixed((length * trig.sin[index]) << bits);
+}
+
+inline void gauge_arrow_fixed(int index, int length, int32_t x0, int32_t y0, int bits,
+                              gauge_needle_fixed_t &n){
+  using namespace gauge_geometry;
+  int32_t x2, y2;
+  gauge_tip_fixed(index, length, x0, y0, bits, x2, y2);
+  int32_t dx = x0 - x2;
+  int32_t dy = y0 - y2;
+  n.x2 = x2;
+  n.y2 = y2;
+  n.x3 = x2 + round_fixed(dx * rot_cos - dy * rot_sin);
+  n.y3 = y2 + round_fixed(dx * rot_sin + dy * rot_cos);
+  n.x4 = x2 + round_fixed(dx * rot_cos + dy * rot_sin);
+  n.y4 = y2 + round_fixed(-dx * rot_sin + dy * rot_cos);
+}
+
+#endif
@@ -0,0 +1,1310 @@
+// Generated by  : tools/compress_gauge.py from gauge.h
+// Dimensions    : 320x240 pixels
+// Size          : 21564 Bytes (raw: 153600 Bytes)
+// Format        : palette + run-length, see tools/compress_gauge.py
+
+#include <pgmspace.h>
+
+#define GAUGE_RLE_WIDTH 320
+#define GAUGE_RLE_HEIGHT 240
+
+const unsigned short gauge_rle_palette[255] PROGMEM ={
+0xFFFF, 0x3A6A, 0x39C7, 0x3A8A, 0xFFDF, 0x3249, 0x39A6, 0xF7DE, 0x3A49, 0x31A6, 0xF800, 0x3229, 0xF7FF, 0x39E7, 0x3186, 0xF7DF, 
+0x2965, 0x428A, 0xF7BE, 0x42AB, 0x2945, 0x3A08, 0x5B4D, 0x4ACB, 0x530C, 0xEF9E, 0xE75D, 0xDF1C, 0x6BCF, 0x7410, 0x638E, 0x9514, 
+0x9D35, 0x4AEC, 0x73F0, 0x7C51, 0xA596, 0x8CD3, 0xEFBE, 0x532D, 0x9D55, 0x8492, 0x39A7, 0xE77D, 0x2124, 0x6BAF, 0xE73C, 0x3A69, 
+0xEF7D, 0x3A29, 0xC659, 0xADB7, 0xB5F7, 0xADD7, 0x39C6, 0xEFBF, 0xCE9A, 0xD6DB, 0xA576, 0xD6FB, 0x8CB3, 0x7C31, 0xBE59, 0xEFDF, 
+0xE71C, 0xBE18, 0xB5F8, 0x8472, 0x5B6E, 0xF79E, 0x4208, 0x4228, 0xDF3C, 0x3A28, 0xB5D7, 0xD6BA, 0x94F4, 0x5B6D, 0xCEBB, 0xE79E, 
+0xBE38, 0xBE39, 0xDEFB, 0x528A, 0xCEDB, 0xC679, 0xB618, 0x3208, 0xF7BF, 0xDF3D, 0xDF5D, 0xCEBA, 0x6BF0, 0xC638, 0x39E8, 0x3A4A, 
+0x5B2D, 0x4A49, 0xADB6, 0xC69A, 0x636E, 0xEF5D, 0x4A69, 0x4AEB, 0xAD96, 0xC67A, 0xCE79, 0x5AEB, 0x9D14, 0xD69A, 0x63AF, 0x94D3, 
+0x7430, 0x42AA, 0xDEDB, 0xD71C, 0xD6FC, 0x52EC, 0x2104, 0x6BEF, 0xE73D, 0xE77E, 0x738E, 0xA555, 0x42CB, 0x8410, 0x94B2, 0xB5B6, 
+0x532C, 0x2A08, 0x8C51, 0x6B6D, 0xBDF7, 0xBDD7, 0xEF7E, 0x52AA, 0x8C71, 0x5ACB, 0xB596, 0xA534, 0x4AAB, 0x9D34, 0xC639, 0x4B0C, 
+0x9CF3, 0x9492, 0xBDF8, 0x8430, 0x9CD3, 0x7C71, 0xA575, 0x630C, 0xA514, 0x7BCF, 0x8451, 0x8471, 0xA556, 0x426A, 0x4249, 0xCE59, 
+0x73AE, 0x7BEF, 0x7C72, 0x73CF, 0x84B2, 0x73EF, 0x428B, 0x8CB2, 0xDEFC, 0x8CF3, 0xD6BB, 0x8CF4, 0x9925, 0x6B4D, 0xAD75, 0x7431, 
+0x63AE, 0x8C92, 0x632C, 0x94F3, 0x9D75, 0x6B8E, 0xCE7A, 0xAD55, 0x9535, 0xE7BE, 0x79A6, 0xFFDE, 0x5B4E, 0xD73C, 0x9145, 0x534D, 
+0xA535, 0x84B3, 0x29E8, 0xB638, 0x9534, 0xC618, 0x18E3, 0xC6BA, 0x7C10, 0xC65A, 0xDF7D, 0xC0C3, 0xE820, 0xFFBF, 0xAD97, 0xADF7, 
+0x4ACC, 0x7C30, 0xB5B7, 0xA5B7, 0x9D76, 0x61E8, 0x6BAE, 0x3228, 0x634D, 0x94B3, 0x7BF0, 0x31C7, 0x7C52, 0xEFFF, 0xCE9B, 0xA5B6, 
+0xBE19, 0xB639, 0x9D15, 0xBE7A, 0xAD76, 0x7451, 0x5B0C, 0xCEFB, 0xA104, 0x5A08, 0xD861, 0xB8C3, 0x18C3, 0xEF9F, 0x94D4, 0xBE79, 
+0x530D, 0x326A, 0xFFBE, 0x3269, 0xB5D8, 0xEF9D, 0x8C93, 0x8C72, 0xEF5C, 0x3185, 0x8965, 0xD062, 0xF020, 0x3209, 0xCEDA, 
+};
+
+const unsigned int gauge_rle_rows[240] PROGMEM ={
+0, 26, 58, 97, 163, 231, 312, 395, 464, 526, 589, 640, 
+712, 792, 887, 955, 1030, 1093, 1163, 1223, 1316, 1423, 1548, 1661, 
+1775, 1891, 2010, 2113, 2221, 2333, 2455, 2569, 2680, 2789, 2893, 2998, 
+3090, 3184, 3272, 3366, 3464, 3567, 3672, 3764, 3858, 3942, 4030, 4121, 
+4212, 4308, 4404, 4507, 4607, 4708, 4809, 4903, 4998, 5100, 5187, 5280, 
+5345, 5394, 5456, 5530, 5617, 5713, 5816, 5923, 6033, 6144, 6242, 6334, 
+6438, 6533, 6642, 6746, 6853, 6964, 7074, 7175, 7273, 7372, 7466, 7550, 
+7629, 7705, 7779, 7850, 7917, 7984, 8059, 8127, 8199, 8279, 8369, 8458, 
+8545, 8627, 8714, 8805, 8887, 8957, 9024, 9091, 9158, 9230, 9301, 9370, 
+9440, 9508, 9569, 9634, 9697, 9767, 9834, 9901, 9973, 10058, 10150, 10264, 
+10371, 10474, 10579, 10656, 10726, 10797, 10869, 10935, 11002, 11060, 11123, 11186, 
+11249, 11317, 11386, 11458, 11526, 11592, 11663, 11737, 11815, 11900, 11982, 12069, 
+12157, 12250, 12336, 12412, 12490, 12556, 12623, 12701, 12770, 12844, 12916, 12997, 
+13076, 13163, 13258, 13353, 13453, 13553, 13663, 13779, 13899, 14014, 14128, 14235, 
+14327, 14420, 14514, 14621, 14735, 14872, 14998, 15139, 15267, 15385, 15483, 15565, 
+15657, 15756, 15857, 15962, 16062, 16159, 16228, 16305, 16390, 16462, 16534, 16623, 
+16723, 16813, 16903, 16991, 17093, 17187, 17285, 17391, 17492, 17585, 17677, 17767, 
+17853, 17936, 18015, 18081, 18148, 18200, 18255, 18316, 18370, 18431, 18491, 18556, 
+18623, 18686, 18755, 18826, 18905, 18966, 19023, 19078, 19139, 19213, 19281, 19365, 
+19440, 19501, 19545, 19596, 19645, 19709, 19795, 19874, 19942, 19993, 20038, 20072, 
+};
+
+const unsigned char gauge_rle_data[20094] PROGMEM ={
+0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x17, 0x00, 0x80, 0x04, 0x0C, 0x00, 0x80, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x18, 0x00, 0x25, 0x00, 0x80, 0x07, 0x3E, 0x00, 
+0x80, 0x07, 0x31, 0x00, 0x82, 0x04, 0x00, 0x04, 0x05, 0x00, 0x01, 0x04, 0x80, 0x00, 0x01, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x18, 0x00, 0x25, 0x00, 0x80, 0x07, 0x3E, 0x00, 
+0x80, 0x07, 0x27, 0x00, 0x85, 0x04, 0x00, 0xBB, 0x04, 0x00, 0x04, 0x03, 0x00, 0x80, 0x04, 0x0F, 
+0x00, 0x80, 0x04, 0x02, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x10, 
+0x00, 0x2D, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x15, 0x00, 0x01, 0x04, 0x04, 0x00, 0x01, 
+0x04, 0x96, 0x00, 0x07, 0x00, 0xBB, 0x00, 0x12, 0x00, 0xBB, 0x52, 0x65, 0x40, 0x4B, 0x52, 0x30, 
+0x72, 0x4B, 0x6A, 0x2E, 0x40, 0x9F, 0x6A, 0x40, 0x4B, 0x01, 0x30, 0x01, 0x45, 0x82, 0x04, 0x00, 
+0x04, 0x04, 0x00, 0x02, 0x04, 0x80, 0x12, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 
+0x07, 0x08, 0x00, 0x35, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x0D, 0x00, 0x01, 0x04, 0x05, 
+0x00, 0x85, 0x12, 0x2E, 0x6D, 0x4B, 0xC5, 0x88, 0x01, 0x82, 0x9B, 0x97, 0x46, 0x53, 0x47, 0x10, 
+0x66, 0x0D, 0x66, 0xC6, 0x47, 0x02, 0x47, 0x2C, 0x46, 0x14, 0x66, 0x47, 0x89, 0x53, 0x83, 0xFF, 
+0x8D, 0x73, 0x7D, 0xA0, 0x7E, 0x7F, 0x6D, 0x12, 0x40, 0x07, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 
+0x07, 0x3E, 0x00, 0x80, 0x07, 0x05, 0x00, 0x38, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x06, 
+0x00, 0x01, 0x04, 0x04, 0x00, 0x8A, 0x2E, 0x4B, 0x8A, 0x4B, 0x7E, 0x6B, 0x61, 0x14, 0x61, 0x14, 
+0x2C, 0x01, 0x10, 0x88, 0x09, 0x14, 0xFF, 0xA7, 0x31, 0x0E, 0x02, 0x0E, 0x02, 0x09, 0x02, 0x02, 
+0x09, 0x80, 0x0D, 0x01, 0x02, 0x8D, 0x0E, 0x09, 0x14, 0x02, 0x14, 0x09, 0x14, 0x0E, 0x14, 0x10, 
+0x53, 0x0D, 0x66, 0x7A, 0x01, 0x90, 0x82, 0x84, 0x72, 0x30, 0x05, 0x00, 0x80, 0x04, 0x3E, 0x00, 
+0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x01, 0x00, 0x3C, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 
+0x01, 0x04, 0x81, 0x00, 0x04, 0x01, 0x00, 0x92, 0x12, 0x00, 0x6A, 0x12, 0x90, 0x8B, 0xFF, 0x8D, 
+0x73, 0x61, 0x53, 0x0D, 0x02, 0x0E, 0x2C, 0x0E, 0x2C, 0x02, 0x0E, 0x02, 0x09, 0x01, 0x02, 0x80, 
+0x0D, 0x03, 0x02, 0x80, 0x0D, 0x08, 0x02, 0x90, 0x09, 0x0D, 0x09, 0x02, 0x10, 0x02, 0x10, 0x14, 
+0x2C, 0x10, 0x46, 0x53, 0x88, 0xAD, 0x91, 0x5D, 0xFF, 0xFC, 0xE6, 0x01, 0x00, 0x81, 0xCD, 0x00, 
+0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x81, 0x07, 0x00, 0x3D, 0x00, 0x80, 0x07, 0x39, 
+0x00, 0x01, 0x04, 0x01, 0x00, 0x80, 0x04, 0x02, 0x00, 0x8D, 0x04, 0x30, 0x92, 0x82, 0x7D, 0x66, 
+0x61, 0x14, 0x09, 0x2C, 0x02, 0x10, 0x02, 0x0E, 0x16, 0x02, 0x80, 0x09, 0x02, 0x02, 0x01, 0x09, 
+0x03, 0x02, 0x82, 0x0D, 0x02, 0x09, 0x01, 0x0E, 0x87, 0x10, 0x14, 0x0E, 0x46, 0x97, 0x8B, 0x9F, 
+0x65, 0x01, 0x00, 0x81, 0x04, 0x0F, 0x05, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x37, 0x00, 
+0x06, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x2F, 0x00, 0x82, 0x04, 0x12, 0x04, 0x02, 0x00, 
+0x88, 0x2E, 0x98, 0x9F, 0x6B, 0xA1, 0x46, 0x76, 0x09, 0x2C, 0x02, 0x09, 0x2B, 0x02, 0x81, 0x0D, 
+0x02, 0x01, 0x0E, 0x86, 0x10, 0x09, 0xFF, 0x28, 0x4A, 0xA0, 0x8A, 0x6D, 0x45, 0x02, 0x00, 0x81, 
+0x04, 0x00, 0x01, 0x04, 0x80, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x34, 0x00, 0x09, 0x00, 
+0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x29, 0x00, 0x01, 0x04, 0x8D, 0x00, 0x04, 0x00, 0x04, 0x9F, 
+0x40, 0x98, 0x61, 0x02, 0x10, 0x14, 0x09, 0x10, 0x0D, 0x2D, 0x02, 0x80, 0x09, 0x01, 0x02, 0x80, 
+0x09, 0x02, 0x02, 0x81, 0x0D, 0x09, 0x01, 0x0E, 0x8B, 0x10, 0x02, 0x66, 0x93, 0x84, 0x4B, 0xBB, 
+0x00, 0xCD, 0xFF, 0x9E, 0xFF, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x35, 0x00, 0x08, 0x00, 0x80, 
+0x07, 0x3E, 0x00, 0x80, 0x07, 0x27, 0x00, 0x02, 0x04, 0x01, 0x00, 0x86, 0x45, 0x65, 0x4B, 0x94, 
+0x53, 0x0D, 0x02, 0x01, 0x0E, 0x3A, 0x02, 0x81, 0x09, 0x02, 0x01, 0x0D, 0x81, 0x09, 0x0E, 0x01, 
+0x10, 0x83, 0x02, 0x7A, 0x4B, 0x12, 0x01, 0x00, 0x02, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x33, 0x00, 
+0x0A, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x25, 0x00, 0x80, 0x04, 0x01, 0x00, 0x88, 0x12, 
+0x52, 0x7E, 0x61, 0x53, 0x09, 0x2C, 0x02, 0x0E, 0x17, 0x02, 0x81, 0x2A, 0x02, 0x01, 0x06, 0x03, 
+0x02, 0x81, 0x06, 0x02, 0x01, 0x06, 0x02, 0x02, 0x82, 0x36, 0x02, 0x06, 0x14, 0x02, 0x80, 0x09, 
+0x02, 0x02, 0x01, 0x0D, 0x88, 0x10, 0x09, 0x66, 0x89, 0xFF, 0xF4, 0xA4, 0x6D, 0x2E, 0x04, 0x00, 
+0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x31, 0x00, 0x0C, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 
+0x1F, 0x00, 0x01, 0x04, 0x02, 0x00, 0x80, 0x40, 0x01, 0x98, 0x85, 0x89, 0x76, 0x10, 0x09, 0x0E, 
+0x0D, 0x13, 0x02, 0x81, 0x06, 0x02, 0x02, 0x06, 0x01, 0x02, 0x80, 0x06, 0x02, 0x02, 0x82, 0x06, 
+0x02, 0x06, 0x01, 0x02, 0x8A, 0x2A, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x2A, 0x02, 0x06, 
+0x15, 0x02, 0x80, 0x09, 0x02, 0x02, 0x8A, 0x0E, 0x10, 0x14, 0x02, 0x47, 0x85, 0x45, 0x00, 0x04, 
+0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x2F, 0x00, 0x0E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 
+0x1B, 0x00, 0x81, 0x04, 0x12, 0x02, 0x00, 0x82, 0x12, 0x94, 0x0D, 0x01, 0x10, 0x82, 0x14, 0x02, 
+0x0D, 0x0E, 0x02, 0x81, 0x36, 0x02, 0x03, 0x06, 0x81, 0x02, 0x06, 0x01, 0x02, 0x86, 0x15, 0x01, 
+0x49, 0x01, 0x08, 0x01, 0x08, 0x02, 0x01, 0x82, 0x08, 0x01, 0x08, 0x02, 0x01, 0x81, 0x08, 0x01, 
+0x03, 0x08, 0x82, 0x15, 0x02, 0x49, 0x01, 0x02, 0x81, 0x06, 0x02, 0x01, 0x06, 0x02, 0x02, 0x80, 
+0x06, 0x13, 0x02, 0x86, 0x2C, 0x0D, 0xFF, 0xAB, 0x5A, 0xA1, 0x6A, 0x00, 0x04, 0x01, 0x00, 0x80, 
+0x04, 0x3E, 0x00, 0x80, 0x07, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x17, 
+0x00, 0x80, 0x04, 0x01, 0x00, 0x84, 0x2E, 0x00, 0x8A, 0x66, 0x0E, 0x01, 0x09, 0x0F, 0x02, 0x02, 
+0x06, 0x02, 0x02, 0x01, 0x15, 0x83, 0x49, 0x15, 0x01, 0x03, 0x1C, 0x01, 0x82, 0x08, 0x31, 0x15, 
+0x03, 0x02, 0x80, 0x06, 0x01, 0x02, 0x80, 0x06, 0x12, 0x02, 0x83, 0xEC, 0x89, 0x91, 0x85, 0x01, 
+0x00, 0x82, 0x04, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x3E, 
+0x00, 0x80, 0x07, 0x13, 0x00, 0x80, 0x04, 0x01, 0x00, 0x81, 0x40, 0x88, 0x01, 0x6B, 0x01, 0x0E, 
+0x01, 0x09, 0x0B, 0x02, 0x82, 0x36, 0x06, 0x02, 0x01, 0x06, 0x01, 0x02, 0x82, 0x08, 0x31, 0x08, 
+0x01, 0x01, 0x80, 0x03, 0x24, 0x01, 0x83, 0x03, 0x01, 0x31, 0x15, 0x01, 0x02, 0x83, 0x36, 0x06, 
+0x02, 0x06, 0x0F, 0x02, 0x01, 0x09, 0x84, 0x2C, 0x0D, 0x98, 0x41, 0x12, 0x04, 0x00, 0x01, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x25, 0x00, 0x18, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x0C, 0x00, 
+0x01, 0x04, 0x86, 0x00, 0x12, 0x8B, 0xB2, 0x02, 0x14, 0x0E, 0x01, 0x09, 0x0D, 0x02, 0x80, 0x06, 
+0x01, 0x02, 0x81, 0x0D, 0x08, 0x31, 0x01, 0x82, 0x08, 0x31, 0x15, 0x01, 0x02, 0x01, 0x06, 0x81, 
+0x02, 0x06, 0x0E, 0x02, 0x85, 0x0E, 0x10, 0x09, 0x6F, 0x9F, 0x45, 0x03, 0x00, 0x80, 0x04, 0x3E, 
+0x00, 0x80, 0x07, 0x25, 0x00, 0x18, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x0A, 0x00, 0x01, 
+0x04, 0x01, 0x00, 0x84, 0x84, 0x7A, 0x47, 0x14, 0x10, 0x0C, 0x02, 0x02, 0x06, 0x81, 0x02, 0x0D, 
+0x01, 0x08, 0x01, 0x03, 0x36, 0x01, 0x82, 0x08, 0x31, 0x0D, 0x01, 0x02, 0x80, 0x06, 0x01, 0x02, 
+0x80, 0x06, 0x0B, 0x02, 0x80, 0x0D, 0x01, 0x10, 0x83, 0x46, 0x99, 0x6A, 0x45, 0x01, 0x00, 0x80, 
+0x04, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x22, 0x00, 0x1B, 0x00, 0x80, 0x07, 0x3E, 
+0x00, 0x80, 0x07, 0x06, 0x00, 0x80, 0x04, 0x01, 0x00, 0x84, 0x4B, 0x93, 0x53, 0x0E, 0x14, 0x0A, 
+0x02, 0x01, 0x06, 0x84, 0x02, 0x06, 0x02, 0x5E, 0x49, 0x40, 0x01, 0x84, 0x08, 0x49, 0x0D, 0x02, 
+0x06, 0x0A, 0x02, 0x80, 0x09, 0x02, 0x02, 0x84, 0x0E, 0x10, 0x0D, 0xA1, 0x6A, 0x01, 0x00, 0x80, 
+0x04, 0x3E, 0x00, 0x80, 0x07, 0x24, 0x00, 0x19, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x06, 
+0x00, 0x80, 0x04, 0x01, 0x00, 0x86, 0x65, 0x94, 0x6B, 0x09, 0x14, 0x09, 0x0D, 0x07, 0x02, 0x81, 
+0x36, 0x02, 0x01, 0x06, 0x84, 0x2A, 0x02, 0x15, 0x01, 0x03, 0x0E, 0x01, 0x02, 0x03, 0x80, 0x01, 
+0x04, 0x05, 0x81, 0x0B, 0x05, 0x01, 0x08, 0x01, 0x01, 0x8B, 0x03, 0x05, 0x03, 0x01, 0x03, 0x01, 
+0x13, 0x01, 0x03, 0x05, 0x5F, 0x08, 0x06, 0x05, 0x80, 0x01, 0x03, 0x03, 0x0F, 0x01, 0x81, 0x15, 
+0x02, 0x01, 0x06, 0x0E, 0x02, 0x83, 0x10, 0x47, 0x8A, 0x2E, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 
+0x80, 0x07, 0x22, 0x00, 0x1B, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x02, 0x00, 0x01, 0x04, 
+0x86, 0x00, 0x04, 0xAE, 0xAD, 0x0D, 0x14, 0x0E, 0x08, 0x02, 0x01, 0x06, 0x83, 0x02, 0x06, 0x02, 
+0x15, 0x01, 0x01, 0x80, 0x03, 0x10, 0x01, 0xA5, 0x0B, 0xFD, 0x0B, 0x01, 0x15, 0x67, 0x27, 0x16, 
+0x70, 0xD6, 0x1F, 0x22, 0xCE, 0x9A, 0x42, 0xB3, 0x33, 0x28, 0x62, 0x28, 0xFE, 0x28, 0x56, 0x1F, 
+0x20, 0x3C, 0x4A, 0x77, 0x29, 0x43, 0x23, 0xBC, 0x21, 0x8C, 0x11, 0x08, 0x57, 0x0B, 0x01, 0x05, 
+0x81, 0x01, 0x03, 0x01, 0x01, 0x80, 0x03, 0x0B, 0x01, 0x85, 0x08, 0x49, 0x02, 0x06, 0x02, 0x06, 
+0x0A, 0x02, 0x85, 0x09, 0x0E, 0x09, 0xB2, 0x84, 0x30, 0x3E, 0x00, 0x80, 0x07, 0x23, 0x00, 0x1A, 
+0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x82, 0x5D, 0xA0, 
+0x61, 0x01, 0x10, 0x08, 0x02, 0x01, 0x06, 0x01, 0x02, 0x82, 0x0D, 0x15, 0x2F, 0x0B, 0x01, 0x01, 
+0x03, 0x01, 0x01, 0x81, 0x08, 0x05, 0x01, 0x01, 0x8D, 0x13, 0x1C, 0x16, 0x25, 0x95, 0xB4, 0x35, 
+0xCF, 0xC7, 0x63, 0x2B, 0x48, 0x0F, 0x58, 0x01, 0x00, 0x81, 0x0C, 0x00, 0x01, 0x0C, 0x81, 0xFF, 
+0xDE, 0xEF, 0x0C, 0x01, 0x00, 0x01, 0x0C, 0x82, 0x0F, 0x26, 0x37, 0x01, 0x2B, 0x86, 0x5B, 0x3B, 
+0x34, 0x33, 0x68, 0x6C, 0x6F, 0x01, 0x60, 0x82, 0x21, 0x11, 0x0B, 0x01, 0x05, 0x82, 0x11, 0x01, 
+0x03, 0x0B, 0x01, 0x81, 0x03, 0x15, 0x01, 0x02, 0x81, 0x36, 0x06, 0x09, 0x02, 0x87, 0x0D, 0x0E, 
+0x10, 0x0D, 0xB2, 0x6D, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x20, 0x00, 0x1D, 0x00, 0x80, 0x07, 
+0x3D, 0x00, 0x80, 0x04, 0x01, 0x00, 0x84, 0x52, 0x82, 0x53, 0x0E, 0x14, 0x09, 0x02, 0x80, 0x06, 
+0x02, 0x02, 0x82, 0x08, 0x01, 0x03, 0x0C, 0x01, 0x8C, 0x05, 0x0B, 0x01, 0x13, 0x17, 0x23, 0x95, 
+0xA2, 0x35, 0x4A, 0x54, 0x48, 0x4F, 0x01, 0x0C, 0x03, 0x00, 0x87, 0x12, 0x0C, 0x1A, 0x26, 0x73, 
+0x48, 0x38, 0x3B, 0x01, 0x0F, 0x82, 0x48, 0x39, 0x5B, 0x01, 0x1B, 0x01, 0x19, 0x01, 0x0F, 0x03, 
+0x00, 0x8C, 0x0C, 0x00, 0x0F, 0x1B, 0xA8, 0x92, 0x33, 0x43, 0x1C, 0x77, 0x60, 0x11, 0x01, 0x01, 
+0x05, 0x81, 0x01, 0x03, 0x0A, 0x01, 0x81, 0x03, 0x01, 0x02, 0x02, 0x80, 0x2A, 0x0B, 0x02, 0x84, 
+0x14, 0x66, 0x90, 0x2E, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x1D, 0x00, 0x20, 0x00, 0x80, 
+0x07, 0x38, 0x00, 0x01, 0x04, 0x87, 0x00, 0x30, 0x90, 0x6B, 0x02, 0x14, 0x09, 0x0D, 0x07, 0x02, 
+0x01, 0x06, 0x01, 0x02, 0x80, 0x31, 0x0D, 0x01, 0x8B, 0x05, 0x0B, 0x71, 0x17, 0x1D, 0x4C, 0x29, 
+0x34, 0x32, 0x73, 0x0F, 0x04, 0x01, 0x00, 0x01, 0x0F, 0x94, 0x2B, 0x39, 0x5B, 0x34, 0x41, 0x4C, 
+0x7B, 0x29, 0x23, 0x1D, 0x1C, 0x2D, 0x16, 0x9A, 0x55, 0x00, 0x38, 0xA3, 0x1E, 0xB5, 0xC8, 0x02, 
+0x9A, 0x86, 0x8D, 0xA9, 0xCF, 0x35, 0x3B, 0x4E, 0x1A, 0x01, 0x0C, 0x02, 0x00, 0x8A, 0x58, 0x1B, 
+0x4E, 0x56, 0xA9, 0xAF, 0x1C, 0x21, 0x11, 0x0B, 0x05, 0x0C, 0x01, 0x83, 0x08, 0x49, 0x06, 0x2A, 
+0x0A, 0x02, 0x01, 0x09, 0x83, 0x14, 0x7A, 0x6A, 0x12, 0x3E, 0x00, 0x80, 0x07, 0x1E, 0x00, 0x1F, 
+0x00, 0x80, 0x07, 0x3B, 0x00, 0x84, 0x7F, 0xAD, 0x46, 0x14, 0x0E, 0x08, 0x02, 0x02, 0x06, 0x82, 
+0x15, 0x08, 0x03, 0x0C, 0x01, 0x88, 0x05, 0x01, 0x44, 0x23, 0x3D, 0x28, 0x5B, 0x39, 0x26, 0x02, 
+0x00, 0x8B, 0x37, 0x52, 0xAA, 0x62, 0x96, 0x9B, 0x1D, 0x1C, 0x13, 0x21, 0x08, 0x01, 0x04, 0x05, 
+0x88, 0x01, 0x05, 0x80, 0x55, 0x00, 0x96, 0x17, 0x05, 0x01, 0x01, 0x05, 0x9D, 0xFF, 0xC7, 0x29, 
+0x08, 0x05, 0x08, 0x01, 0x17, 0x11, 0x64, 0x22, 0x29, 0x28, 0x33, 0x4E, 0xAA, 0x86, 0x0F, 0x00, 
+0x0C, 0x0F, 0x48, 0x74, 0x35, 0x1D, 0x22, 0x16, 0x01, 0x05, 0x5F, 0x01, 0x03, 0x09, 0x01, 0x81, 
+0x08, 0x5E, 0x01, 0x06, 0x09, 0x02, 0x80, 0x0D, 0x01, 0x0E, 0x81, 0x47, 0x88, 0x3E, 0x00, 0x80, 
+0x07, 0x1E, 0x00, 0x1F, 0x00, 0x80, 0x07, 0x34, 0x00, 0x02, 0x04, 0x02, 0x00, 0x81, 0x6A, 0x61, 
+0x01, 0x10, 0x09, 0x02, 0x01, 0x06, 0x80, 0x0D, 0x0C, 0x01, 0x88, 0x05, 0x08, 0x01, 0x16, 0xBC, 
+0x29, 0x56, 0x32, 0x19, 0x02, 0x00, 0x8A, 0x58, 0x52, 0x4A, 0x20, 0xFF, 0x31, 0x84, 0xC8, 0xFF, 
+0xEC, 0x5A, 0x67, 0x08, 0xD7, 0x2F, 0x02, 0x01, 0x01, 0x03, 0x04, 0x01, 0x88, 0x03, 0x5F, 0x4D, 
+0x3E, 0x00, 0x4A, 0x13, 0x01, 0x03, 0x09, 0x01, 0x8A, 0x05, 0x0B, 0x01, 0x13, 0x03, 0x1E, 0xFF, 
+0x52, 0x84, 0x33, 0xE0, 0x37, 0xED, 0x01, 0x0C, 0x88, 0x00, 0x0F, 0x73, 0xE1, 0x95, 0xBF, 0x27, 
+0x01, 0x0B, 0x0A, 0x01, 0x84, 0x03, 0x01, 0x15, 0x02, 0x06, 0x0A, 0x02, 0x01, 0x10, 0x84, 0x91, 
+0x2E, 0x00, 0x12, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x19, 0x00, 0x24, 0x00, 0x80, 0x07, 0x34, 0x00, 
+0x84, 0x6A, 0x97, 0x10, 0x09, 0x0D, 0x07, 0x02, 0x01, 0x06, 0x81, 0x02, 0x15, 0x0B, 0x01, 0x01, 
+0x05, 0x85, 0x21, 0x23, 0xEE, 0xE2, 0xAA, 0x19, 0x01, 0x00, 0x87, 0x0C, 0x1A, 0x5B, 0x2B, 0x00, 
+0x32, 0xFF, 0x2C, 0x5B, 0x08, 0x11, 0x01, 0x86, 0x08, 0xBF, 0x5B, 0x00, 0x7B, 0x18, 0x08, 0x0F, 
+0x01, 0x88, 0x05, 0x01, 0x0B, 0xD8, 0xB6, 0x00, 0xFF, 0x1D, 0xDF, 0x41, 0x1B, 0x02, 0x0C, 0x87, 
+0xFF, 0xDE, 0xEF, 0x54, 0xEF, 0x20, 0x1C, 0x67, 0x05, 0x08, 0x0A, 0x01, 0x81, 0x08, 0x02, 0x02, 
+0x06, 0x08, 0x02, 0x01, 0x09, 0x84, 0xAD, 0x6A, 0x12, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x18, 
+0x00, 0x25, 0x00, 0x80, 0x07, 0x2E, 0x00, 0x80, 0x04, 0x01, 0x00, 0x84, 0x2E, 0xA1, 0x09, 0x0E, 
+0x09, 0x07, 0x02, 0x02, 0x06, 0x82, 0x49, 0x01, 0x03, 0x0B, 0x01, 0x84, 0xD0, 0x22, 0x32, 0xFF, 
+0x19, 0xC6, 0x2E, 0x01, 0x00, 0x8B, 0x12, 0x5B, 0xFF, 0x58, 0xBE, 0xA4, 0xD1, 0xFF, 0x6D, 0x63, 
+0x42, 0x00, 0x41, 0x22, 0x01, 0x03, 0x10, 0x01, 0x86, 0x08, 0x16, 0x3E, 0x00, 0xC9, 0x21, 0x05, 
+0x10, 0x01, 0x94, 0x03, 0x08, 0xA3, 0x1A, 0x00, 0xD2, 0x8C, 0xA5, 0x28, 0x3E, 0xBD, 0x0C, 0x00, 
+0x0C, 0x2B, 0x56, 0x7B, 0x1D, 0x67, 0x05, 0x08, 0x09, 0x01, 0x83, 0x03, 0x08, 0x02, 0x06, 0x09, 
+0x02, 0x01, 0x0E, 0x82, 0x46, 0x91, 0x30, 0x3E, 0x00, 0x80, 0x07, 0x19, 0x00, 0x24, 0x00, 0x80, 
+0x07, 0x2C, 0x00, 0x01, 0x04, 0x01, 0x00, 0x83, 0x04, 0x7E, 0x47, 0x10, 0x01, 0x09, 0x06, 0x02, 
+0x02, 0x06, 0x82, 0x0D, 0x31, 0x03, 0x09, 0x01, 0x8D, 0x57, 0x08, 0x2D, 0x22, 0x9C, 0xFF, 0x5E, 
+0xEF, 0x45, 0x00, 0x04, 0x78, 0x33, 0xA9, 0x1D, 0x05, 0x01, 0x01, 0x85, 0x2F, 0x1F, 0x0C, 0x86, 
+0x1C, 0x08, 0x11, 0x01, 0x86, 0x05, 0x27, 0x4E, 0x00, 0x3A, 0xF0, 0x05, 0x11, 0x01, 0x8C, 0x05, 
+0xD9, 0x0F, 0x78, 0xB3, 0x57, 0x9D, 0x57, 0x01, 0x2D, 0xAB, 0x35, 0x1A, 0x01, 0x0C, 0x86, 0x0F, 
+0x59, 0x3A, 0x24, 0xB0, 0x11, 0x08, 0x09, 0x01, 0x83, 0x03, 0x5E, 0x02, 0x06, 0x08, 0x02, 0x86, 
+0x0D, 0x10, 0x0E, 0x83, 0x8A, 0x00, 0x0F, 0x3E, 0x00, 0x80, 0x07, 0x16, 0x00, 0x27, 0x00, 0x80, 
+0x07, 0x28, 0x00, 0x81, 0x04, 0x12, 0x01, 0x00, 0x82, 0x45, 0x90, 0x14, 0x01, 0x09, 0x07, 0x02, 
+0x01, 0x06, 0x83, 0x02, 0x31, 0x01, 0x03, 0x06, 0x01, 0x87, 0x03, 0x01, 0x05, 0x01, 0x3D, 0x3C, 
+0x68, 0x45, 0x01, 0x00, 0x8F, 0x2E, 0xFF, 0x5A, 0xCE, 0x20, 0x2D, 0x80, 0x01, 0x08, 0x11, 0x01, 
+0x03, 0x05, 0x29, 0x1A, 0x04, 0x9C, 0x11, 0x11, 0x01, 0x86, 0x05, 0x16, 0x50, 0x00, 0x3E, 0x17, 
+0x05, 0x11, 0x01, 0x8F, 0x17, 0x9C, 0x00, 0xA8, 0x1E, 0xF1, 0x13, 0x03, 0x01, 0x08, 0x0B, 0x13, 
+0x1C, 0x3A, 0x32, 0x1A, 0x01, 0x0C, 0x87, 0x4F, 0x42, 0xA2, 0x22, 0x01, 0x05, 0x01, 0x03, 0x06, 
+0x01, 0x83, 0x03, 0x01, 0x5E, 0x02, 0x01, 0x2A, 0x08, 0x02, 0x85, 0x0E, 0x47, 0x4B, 0x12, 0x00, 
+0x0F, 0x3E, 0x00, 0x80, 0x07, 0x14, 0x00, 0x29, 0x00, 0x80, 0x07, 0x26, 0x00, 0x86, 0x04, 0x00, 
+0x04, 0x52, 0xAE, 0x47, 0x10, 0x07, 0x02, 0x01, 0x06, 0x83, 0x02, 0x0D, 0x01, 0x03, 0x06, 0x01, 
+0x87, 0x11, 0x01, 0x81, 0x11, 0x3D, 0x33, 0x92, 0x65, 0x01, 0x00, 0x84, 0xFF, 0x1D, 0xE7, 0x68, 
+0xD9, 0x18, 0x08, 0x07, 0x01, 0x85, 0x4D, 0x69, 0x00, 0x41, 0x60, 0x05, 0x10, 0x01, 0x86, 0x05, 
+0x75, 0x4E, 0x0C, 0x24, 0x18, 0x05, 0x10, 0x01, 0x87, 0x05, 0x18, 0x54, 0x00, 0x34, 0x17, 0x01, 
+0x7C, 0x01, 0x01, 0x01, 0x03, 0x8E, 0x01, 0x0B, 0x01, 0x17, 0x3C, 0x41, 0x48, 0x0C, 0x00, 0x19, 
+0xBD, 0x20, 0x1C, 0x11, 0x0B, 0x08, 0x01, 0x83, 0x03, 0x08, 0x02, 0x06, 0x08, 0x02, 0x01, 0x09, 
+0x81, 0x46, 0x94, 0x3E, 0x00, 0x80, 0x07, 0x16, 0x00, 0x27, 0x00, 0x80, 0x07, 0x27, 0x00, 0x01, 
+0x04, 0x84, 0x00, 0x5D, 0x89, 0x2C, 0x10, 0x06, 0x02, 0x01, 0x06, 0x01, 0x02, 0x81, 0x49, 0x03, 
+0x06, 0x01, 0x87, 0x03, 0x11, 0x08, 0x31, 0x2D, 0x92, 0x8E, 0x78, 0x01, 0x00, 0x84, 0x78, 0xC0, 
+0xDA, 0x75, 0x05, 0x08, 0x01, 0x87, 0x03, 0x13, 0x42, 0x00, 0x69, 0x22, 0x05, 0x03, 0x0F, 0x01, 
+0x86, 0x05, 0x16, 0x3E, 0x00, 0x51, 0x17, 0x05, 0x10, 0x01, 0x84, 0x05, 0xAF, 0x37, 0x0C, 0x3A, 
+0x07, 0x01, 0x80, 0x03, 0x02, 0x01, 0x8B, 0x17, 0x22, 0x24, 0x59, 0x26, 0x00, 0x19, 0x55, 0x6C, 
+0x16, 0x08, 0x05, 0x08, 0x01, 0x81, 0x03, 0x15, 0x09, 0x02, 0x84, 0x0D, 0x2C, 0xFF, 0x8A, 0x4A, 
+0x7E, 0x30, 0x3E, 0x00, 0x80, 0x07, 0x14, 0x00, 0x29, 0x00, 0x80, 0x07, 0x24, 0x00, 0x80, 0x04, 
+0x01, 0x00, 0x82, 0x6D, 0x66, 0x2C, 0x07, 0x02, 0x80, 0x06, 0x02, 0x02, 0x81, 0x31, 0x03, 0x08, 
+0x01, 0x8C, 0x57, 0x16, 0x51, 0x4E, 0x78, 0x00, 0x04, 0xFF, 0x1D, 0xE7, 0xC0, 0xB5, 0x17, 0x01, 
+0x03, 0x0A, 0x01, 0x84, 0x11, 0x25, 0x0C, 0x4F, 0x1D, 0x11, 0x01, 0x86, 0x05, 0x27, 0x3B, 0x0C, 
+0x24, 0x18, 0x05, 0x10, 0x01, 0x86, 0x03, 0xAB, 0x37, 0x73, 0x29, 0x05, 0x03, 0x09, 0x01, 0x85, 
+0x03, 0x05, 0x01, 0x1E, 0x25, 0x3B, 0x01, 0x00, 0x84, 0x26, 0x50, 0x1F, 0x21, 0x05, 0x08, 0x01, 
+0x81, 0x03, 0x0D, 0x01, 0x06, 0x09, 0x02, 0x82, 0x14, 0xA1, 0x38, 0x01, 0x00, 0x01, 0x04, 0x3E, 
+0x00, 0x80, 0x07, 0x0F, 0x00, 0x2E, 0x00, 0x80, 0x07, 0x20, 0x00, 0x83, 0x2E, 0x98, 0x83, 0x0E, 
+0x07, 0x02, 0x80, 0x2A, 0x01, 0x02, 0x80, 0x15, 0x07, 0x01, 0x8E, 0x03, 0x01, 0x05, 0x21, 0x24, 
+0x54, 0x59, 0x00, 0xCD, 0x40, 0x68, 0xB5, 0x11, 0x01, 0x03, 0x0C, 0x01, 0x85, 0x05, 0xA2, 0x73, 
+0x00, 0x35, 0x11, 0x10, 0x01, 0x86, 0x05, 0x16, 0x32, 0x0C, 0x3E, 0xA6, 0x05, 0x0F, 0x01, 0x87, 
+0x5F, 0x7C, 0xD3, 0x0C, 0x54, 0x16, 0x05, 0x03, 0x0B, 0x01, 0x8C, 0x03, 0xF1, 0x2F, 0x2D, 0x96, 
+0x69, 0x0C, 0x00, 0x19, 0x33, 0x4C, 0x75, 0x05, 0x09, 0x01, 0x82, 0x02, 0x06, 0x2A, 0x07, 0x02, 
+0x01, 0x0E, 0x81, 0x66, 0x52, 0x02, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x0F, 0x00, 0x2E, 0x00, 0x80, 
+0x07, 0x20, 0x00, 0x83, 0xB7, 0x09, 0x2C, 0x0E, 0x06, 0x02, 0x02, 0x06, 0x81, 0x15, 0x03, 0x06, 
+0x01, 0x8D, 0x03, 0x57, 0x8C, 0x6F, 0x38, 0x74, 0x12, 0x00, 0xA8, 0xD2, 0xFF, 0xD0, 0x73, 0x8C, 
+0x01, 0x03, 0x0E, 0x01, 0x86, 0x08, 0x16, 0x3E, 0x2B, 0x28, 0x18, 0x05, 0x0F, 0x01, 0x86, 0x05, 
+0x60, 0x4E, 0x00, 0x3A, 0x27, 0x05, 0x0F, 0x01, 0x85, 0x05, 0x27, 0xFF, 0xBB, 0xC6, 0x37, 0xFF, 
+0xD8, 0xAD, 0x17, 0x11, 0x01, 0x8A, 0x08, 0xD6, 0x68, 0x39, 0x00, 0x26, 0x1A, 0x24, 0x9B, 0x17, 
+0x05, 0x08, 0x01, 0x82, 0x15, 0x02, 0x06, 0x07, 0x02, 0x85, 0x09, 0x0E, 0x53, 0x8B, 0x00, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x0F, 0x00, 0x2E, 0x00, 0x80, 0x07, 0x1E, 0x00, 0x84, 0x04, 0x98, 0x47, 
+0x10, 0x0D, 0x05, 0x02, 0x02, 0x06, 0x81, 0x0D, 0x08, 0x09, 0x01, 0x83, 0xD6, 0x51, 0x4E, 0x19, 
+0x01, 0x00, 0x82, 0x86, 0x6C, 0x8C, 0x13, 0x01, 0x80, 0x5F, 0x01, 0x29, 0x81, 0x16, 0x11, 0x10, 
+0x01, 0x86, 0x05, 0x16, 0x51, 0x0C, 0x41, 0xD0, 0x05, 0x10, 0x01, 0x84, 0x08, 0x1E, 0xC1, 0xAF, 
+0x05, 0x12, 0x01, 0x89, 0x05, 0x13, 0xD2, 0x19, 0x0C, 0x00, 0x37, 0x63, 0x4C, 0xF0, 0x09, 0x01, 
+0x80, 0x08, 0x0A, 0x02, 0x84, 0x14, 0xB2, 0x6D, 0xF2, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 
+0x0C, 0x00, 0x31, 0x00, 0x80, 0x07, 0x1A, 0x00, 0x84, 0x4B, 0x6B, 0x02, 0x0E, 0x09, 0x07, 0x02, 
+0x81, 0x06, 0x0D, 0x09, 0x01, 0x86, 0x17, 0x20, 0x55, 0x48, 0x00, 0x86, 0xFF, 0x1D, 0xDF, 0x01, 
+0x19, 0x81, 0x42, 0x13, 0x15, 0x01, 0x80, 0x08, 0x12, 0x01, 0x86, 0x05, 0x18, 0x74, 0x00, 0x28, 
+0x27, 0x08, 0x12, 0x01, 0x80, 0x08, 0x15, 0x01, 0x8B, 0xFF, 0x2C, 0x5B, 0x5D, 0x0F, 0xA8, 0x4E, 
+0xED, 0x00, 0x79, 0x33, 0xFF, 0x93, 0x84, 0x8C, 0x05, 0x08, 0x01, 0x80, 0x02, 0x01, 0x06, 0x06, 
+0x02, 0x83, 0x0E, 0x09, 0x53, 0x7F, 0x02, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x0B, 0x00, 
+0x32, 0x00, 0x80, 0x07, 0x16, 0x00, 0x85, 0x04, 0x00, 0x04, 0x8B, 0x09, 0x0E, 0x06, 0x02, 0x80, 
+0x2A, 0x01, 0x06, 0x80, 0x0D, 0x06, 0x01, 0x80, 0x03, 0x01, 0x01, 0x8D, 0x22, 0x24, 0x69, 0x0F, 
+0x04, 0x39, 0x3A, 0xA3, 0x8E, 0x0F, 0x39, 0x20, 0x05, 0x03, 0x27, 0x01, 0x86, 0x05, 0x16, 0x51, 
+0x00, 0x50, 0x17, 0x08, 0x28, 0x01, 0x81, 0x11, 0x3A, 0x01, 0x00, 0x89, 0x92, 0x16, 0xE2, 0x4B, 
+0x00, 0x0F, 0x74, 0xB1, 0x1E, 0x0B, 0x08, 0x01, 0x81, 0x02, 0x06, 0x07, 0x02, 0x83, 0x0D, 0xC6, 
+0xB2, 0x8A, 0x3E, 0x00, 0x80, 0x07, 0x0E, 0x00, 0x2F, 0x00, 0x80, 0x07, 0x1A, 0x00, 0x83, 0x0F, 
+0xA0, 0x2C, 0x0E, 0x06, 0x02, 0x83, 0x36, 0x06, 0x02, 0x15, 0x06, 0x01, 0x92, 0x03, 0x05, 0x13, 
+0x43, 0x3A, 0x2E, 0x00, 0x45, 0x5D, 0xA3, 0x01, 0x81, 0xC1, 0x74, 0x0C, 0xE3, 0x44, 0x05, 0x03, 
+0x26, 0x01, 0x86, 0x05, 0x8F, 0x54, 0x00, 0x3A, 0x18, 0x08, 0x28, 0x01, 0x84, 0x1E, 0x4E, 0x00, 
+0x38, 0xA3, 0x01, 0x05, 0x88, 0x2D, 0x42, 0x78, 0x00, 0x1A, 0x8E, 0xDA, 0x03, 0x05, 0x07, 0x01, 
+0x83, 0x0D, 0x02, 0x06, 0x36, 0x05, 0x02, 0x01, 0x09, 0x81, 0x14, 0x4B, 0x01, 0x00, 0x80, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x0A, 0x00, 0x33, 0x00, 0x80, 0x07, 0x15, 0x00, 0x82, 0x52, 0x8A, 0x66, 
+0x08, 0x02, 0x83, 0x06, 0x02, 0x08, 0x03, 0x05, 0x01, 0x84, 0x03, 0x0B, 0x67, 0x23, 0x32, 0x01, 
+0x00, 0x8B, 0x1B, 0x6F, 0x18, 0x11, 0x01, 0x05, 0x08, 0xE1, 0x26, 0x59, 0x33, 0x0B, 0x27, 0x01, 
+0x86, 0x05, 0x16, 0x3E, 0x0C, 0x42, 0x21, 0x05, 0x27, 0x01, 0x85, 0x67, 0x28, 0x0F, 0x58, 0xB1, 
+0x0B, 0x01, 0x03, 0x8B, 0x0B, 0x17, 0x43, 0x39, 0x0C, 0x00, 0x32, 0x4A, 0x18, 0x05, 0x11, 0x03, 
+0x04, 0x01, 0x81, 0x03, 0x08, 0x01, 0x02, 0x80, 0x36, 0x06, 0x02, 0x85, 0x10, 0x97, 0x85, 0x00, 
+0x12, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x09, 0x00, 0x34, 0x00, 0x80, 0x07, 0x11, 0x00, 0x85, 0x04, 
+0x00, 0x12, 0xA1, 0x10, 0x2C, 0x09, 0x02, 0x80, 0x08, 0x07, 0x01, 0x83, 0x0B, 0x8F, 0x25, 0x19, 
+0x01, 0x00, 0x83, 0x92, 0x2D, 0x11, 0x01, 0x01, 0xF3, 0x87, 0x01, 0x05, 0x1C, 0xFF, 0xDB, 0xC6, 
+0x00, 0xB6, 0x1D, 0x05, 0x26, 0x01, 0x86, 0x05, 0x27, 0x3B, 0x00, 0xD4, 0x18, 0x05, 0x26, 0x01, 
+0x93, 0x08, 0x25, 0x1A, 0x00, 0x38, 0x64, 0x01, 0x03, 0x01, 0x03, 0x08, 0x31, 0x22, 0x96, 0x26, 
+0x00, 0x19, 0x6C, 0x1D, 0x05, 0x01, 0x03, 0x80, 0x11, 0x03, 0x01, 0x83, 0x03, 0x31, 0x02, 0x06, 
+0x07, 0x02, 0x83, 0x10, 0x02, 0x84, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x08, 0x00, 0x35, 
+0x00, 0x80, 0x07, 0x11, 0x00, 0x84, 0x2E, 0x94, 0x02, 0x09, 0x0D, 0x05, 0x02, 0x01, 0x06, 0x82, 
+0xDB, 0x08, 0x03, 0x04, 0x01, 0x84, 0x03, 0x05, 0x01, 0x1F, 0x4E, 0x01, 0x00, 0x83, 0x1B, 0x6F, 
+0x27, 0x03, 0x05, 0x01, 0x85, 0x05, 0x35, 0x79, 0x19, 0xF4, 0x8C, 0x26, 0x01, 0x86, 0x08, 0x8F, 
+0xCF, 0xFF, 0x3D, 0xD7, 0x24, 0x7C, 0x08, 0x26, 0x01, 0x86, 0x60, 0x24, 0x0C, 0x5A, 0x22, 0x05, 
+0x03, 0x01, 0x01, 0x80, 0x11, 0x01, 0x03, 0x88, 0x01, 0x21, 0x28, 0x38, 0x00, 0x86, 0x32, 0x2D, 
+0x08, 0x06, 0x01, 0x81, 0x03, 0x08, 0x01, 0x06, 0x06, 0x02, 0x86, 0x09, 0x0E, 0x97, 0x6A, 0x12, 
+0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x07, 0x00, 0x36, 0x00, 0x80, 0x07, 0x0D, 0x00, 0x80, 0x04, 
+0x01, 0x00, 0x82, 0x8A, 0x02, 0x14, 0x09, 0x02, 0x80, 0x08, 0x05, 0x01, 0x89, 0x03, 0x05, 0x21, 
+0x3A, 0x38, 0x58, 0x0F, 0x92, 0x9A, 0x17, 0x07, 0x01, 0x87, 0x05, 0x16, 0x38, 0x00, 0xAA, 0xD9, 
+0x0B, 0x03, 0x25, 0x01, 0x83, 0x11, 0x27, 0x1C, 0x27, 0x27, 0x01, 0x85, 0x05, 0x28, 0x4F, 0x0C, 
+0x69, 0x17, 0x08, 0x01, 0x89, 0x03, 0x70, 0x4E, 0x12, 0x00, 0x32, 0xE4, 0x31, 0x9D, 0x11, 0x05, 
+0x01, 0x80, 0x08, 0x01, 0x06, 0x06, 0x02, 0x85, 0x0E, 0x10, 0x53, 0x8A, 0x00, 0x04, 0x3E, 0x00, 
+0x80, 0x07, 0x07, 0x00, 0x36, 0x00, 0x80, 0x07, 0x0C, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0x94, 
+0x46, 0x10, 0x06, 0x02, 0x01, 0x06, 0x81, 0x02, 0x08, 0x06, 0x01, 0x89, 0x05, 0x1E, 0x3C, 0x38, 
+0x00, 0x1A, 0x4A, 0x2D, 0x05, 0x03, 0x08, 0x01, 0x86, 0xFF, 0x29, 0x2A, 0x1F, 0x2E, 0x58, 0x8E, 
+0x18, 0x05, 0x4F, 0x01, 0x88, 0x03, 0x05, 0x16, 0x3E, 0x00, 0xC7, 0x5C, 0x0B, 0x03, 0x08, 0x01, 
+0x88, 0x05, 0x1E, 0x3A, 0xFF, 0x9F, 0xF7, 0x00, 0x78, 0x43, 0x60, 0x05, 0x06, 0x01, 0x83, 0x08, 
+0x02, 0x06, 0x2A, 0x05, 0x02, 0x85, 0x0D, 0x76, 0xA1, 0x40, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 
+0x06, 0x00, 0x37, 0x00, 0x80, 0x07, 0x0A, 0x00, 0x01, 0x04, 0x82, 0x12, 0x6D, 0x87, 0x01, 0x09, 
+0x05, 0x02, 0x01, 0x06, 0x81, 0x02, 0x08, 0x06, 0x01, 0x89, 0x05, 0x4D, 0x4C, 0x19, 0x00, 0x1A, 
+0x3A, 0x7C, 0x01, 0x03, 0x0A, 0x01, 0x85, 0x13, 0x8E, 0x04, 0xA8, 0x3A, 0x0B, 0x51, 0x01, 0x80, 
+0xB8, 0x01, 0x0C, 0x80, 0x42, 0x0D, 0x01, 0x88, 0x21, 0x7B, 0x39, 0x00, 0x1A, 0x4A, 0x60, 0x05, 
+0x03, 0x05, 0x01, 0x80, 0x08, 0x01, 0x02, 0x80, 0x06, 0x04, 0x02, 0x83, 0x0D, 0x10, 0x0D, 0x7E, 
+0x3E, 0x00, 0x80, 0x07, 0x08, 0x00, 0x35, 0x00, 0x80, 0x07, 0x0C, 0x00, 0x85, 0x04, 0x00, 0x6D, 
+0x47, 0xFF, 0x44, 0x21, 0x09, 0x08, 0x02, 0x80, 0x08, 0x05, 0x01, 0x88, 0x03, 0x05, 0x70, 0x55, 
+0x19, 0x00, 0x39, 0x23, 0x2F, 0x09, 0x01, 0x01, 0x05, 0x01, 0x01, 0x87, 0x0B, 0xFF, 0x52, 0x84, 
+0x74, 0x00, 0xC9, 0x2D, 0x57, 0x11, 0x4D, 0x01, 0x85, 0x05, 0x3D, 0x59, 0x00, 0x32, 0x1E, 0x0F, 
+0x01, 0x87, 0x43, 0x78, 0x00, 0x19, 0x62, 0x2D, 0x0B, 0x03, 0x05, 0x01, 0x82, 0x08, 0x0D, 0x06, 
+0x05, 0x02, 0x84, 0x0D, 0x14, 0x46, 0x7D, 0x2E, 0x3E, 0x00, 0x80, 0x07, 0x06, 0x00, 0x37, 0x00, 
+0x80, 0x07, 0x09, 0x00, 0x01, 0x04, 0x83, 0x72, 0x83, 0x10, 0x0D, 0x05, 0x02, 0x01, 0x06, 0x82, 
+0x36, 0x2F, 0x03, 0x06, 0x01, 0x86, 0x43, 0x35, 0x1A, 0x00, 0x50, 0x23, 0x71, 0x0F, 0x01, 0x84, 
+0x08, 0x42, 0x19, 0x1A, 0x4A, 0x1E, 0x01, 0x05, 0x00, 0x04, 0x01, 0x86, 0x03, 0x20, 0x2E, 0x04, 
+0x2E, 0x20, 0x03, 0x1E, 0x01, 0x85, 0x71, 0x20, 0x26, 0x1A, 0x3D, 0x0B, 0x0F, 0x01, 0x82, 0x13, 
+0xD1, 0x55, 0x01, 0x00, 0x82, 0x4A, 0x23, 0x0B, 0x05, 0x01, 0x81, 0x03, 0x49, 0x09, 0x02, 0x82, 
+0x14, 0x84, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x05, 0x00, 0x38, 0x00, 0x80, 0x07, 0x0A, 0x00, 0x82, 
+0x90, 0x10, 0x0E, 0x08, 0x02, 0x81, 0x2F, 0x03, 0x04, 0x01, 0x83, 0x05, 0x01, 0x64, 0x33, 0x01, 
+0x0F, 0x83, 0x32, 0x23, 0x08, 0x03, 0x0E, 0x01, 0x88, 0x03, 0x0B, 0x2D, 0x4E, 0x00, 0xB6, 0x23, 
+0xC2, 0x03, 0x1B, 0x01, 0x05, 0x00, 0x04, 0x01, 0x80, 0x50, 0x04, 0x00, 0x80, 0x50, 0x1C, 0x01, 
+0x86, 0x03, 0x0B, 0x1F, 0x37, 0x00, 0x51, 0x80, 0x11, 0x01, 0x88, 0x05, 0xD1, 0x50, 0x0F, 0x12, 
+0x54, 0x1E, 0x2F, 0x03, 0x05, 0x01, 0x80, 0x08, 0x08, 0x02, 0x82, 0x2C, 0x97, 0x52, 0x3E, 0x00, 
+0x80, 0x07, 0x05, 0x00, 0x38, 0x00, 0x80, 0x07, 0x08, 0x00, 0x84, 0x12, 0xA1, 0x46, 0x09, 0x0D, 
+0x07, 0x02, 0x81, 0x08, 0x03, 0x05, 0x01, 0x82, 0x57, 0x25, 0x69, 0x01, 0x0C, 0x83, 0x41, 0x1E, 
+0xD7, 0x03, 0x11, 0x01, 0x87, 0x0B, 0x24, 0x1A, 0x19, 0x3E, 0x11, 0x05, 0x03, 0x1A, 0x01, 0x01, 
+0x00, 0x07, 0x01, 0x88, 0x22, 0x00, 0x12, 0x22, 0x11, 0x22, 0x12, 0x00, 0x5C, 0x1B, 0x01, 0x86, 
+0x05, 0x27, 0x33, 0x0C, 0x3B, 0x22, 0x05, 0x12, 0x01, 0x87, 0x03, 0x16, 0x32, 0x0F, 0x00, 0x42, 
+0x25, 0x05, 0x06, 0x01, 0x80, 0x31, 0x01, 0x06, 0x06, 0x02, 0x82, 0x2C, 0x99, 0x5D, 0x3E, 0x00, 
+0x80, 0x07, 0x04, 0x00, 0x39, 0x00, 0x80, 0x07, 0x05, 0x00, 0x85, 0x04, 0x00, 0x72, 0x47, 0x0E, 
+0x09, 0x05, 0x02, 0x82, 0x06, 0x02, 0x2F, 0x06, 0x01, 0x88, 0x11, 0x43, 0x50, 0x3F, 0x0F, 0x68, 
+0xB5, 0x11, 0x03, 0x13, 0x01, 0x85, 0x21, 0x69, 0x00, 0x4E, 0xB3, 0x81, 0x1B, 0x01, 0x01, 0x00, 
+0x07, 0x01, 0x82, 0x34, 0x00, 0x1F, 0x02, 0x01, 0x82, 0x1F, 0x00, 0x34, 0x1C, 0x01, 0x84, 0x3A, 
+0x19, 0x0F, 0x35, 0x21, 0x14, 0x01, 0x82, 0xF3, 0x2D, 0x62, 0x01, 0x00, 0x83, 0x32, 0x1C, 0x01, 
+0x03, 0x05, 0x01, 0x82, 0x2F, 0x2A, 0x06, 0x05, 0x02, 0x01, 0x09, 0x81, 0x53, 0x04, 0x3E, 0x00, 
+0x80, 0x07, 0x03, 0x00, 0x3A, 0x00, 0x80, 0x07, 0x05, 0x00, 0x82, 0x4B, 0x83, 0x14, 0x06, 0x02, 
+0x83, 0x06, 0x02, 0x5E, 0x03, 0x05, 0x01, 0x88, 0x0B, 0x44, 0x42, 0x0C, 0x00, 0x3B, 0xA5, 0x31, 
+0x03, 0x14, 0x01, 0x85, 0xFF, 0xC7, 0x29, 0x25, 0x1B, 0x0F, 0x69, 0xBF, 0x1B, 0x01, 0x01, 0x00, 
+0x83, 0x1B, 0x0F, 0x4B, 0x2D, 0x03, 0x01, 0x82, 0x40, 0x00, 0x4D, 0x02, 0x01, 0x82, 0x4D, 0x00, 
+0x1B, 0x1A, 0x01, 0x87, 0x08, 0x4D, 0x69, 0x00, 0x38, 0x1D, 0x0B, 0x03, 0x13, 0x01, 0x88, 0xA6, 
+0x08, 0x6F, 0x5A, 0x0C, 0x37, 0x69, 0x1C, 0x0B, 0x05, 0x01, 0x83, 0x03, 0x5E, 0x06, 0x2A, 0x05, 
+0x02, 0x82, 0x09, 0x0E, 0x90, 0x3E, 0x00, 0x80, 0x07, 0x03, 0x00, 0x3A, 0x00, 0x80, 0x07, 0x04, 
+0x00, 0x83, 0x2E, 0xA0, 0x10, 0x09, 0x06, 0x02, 0x81, 0x06, 0x0D, 0x07, 0x01, 0x89, 0x43, 0xFF, 
+0x99, 0xC6, 0x00, 0x0C, 0x00, 0x30, 0x96, 0x60, 0x31, 0x03, 0x14, 0x01, 0x84, 0x03, 0x3E, 0x04, 
+0x63, 0x29, 0x1B, 0x01, 0x04, 0x00, 0x81, 0x04, 0x44, 0x02, 0x01, 0x82, 0x12, 0x00, 0x13, 0x02, 
+0x01, 0x82, 0x13, 0x00, 0x12, 0x1B, 0x01, 0x84, 0x43, 0x4F, 0x0F, 0x25, 0x11, 0x14, 0x01, 0x8B, 
+0x03, 0x5F, 0x1E, 0x41, 0x00, 0x3F, 0x37, 0x00, 0x33, 0x23, 0x0B, 0x03, 0x05, 0x01, 0x01, 0x02, 
+0x80, 0x06, 0x04, 0x02, 0x01, 0x09, 0x81, 0x46, 0x40, 0x3E, 0x00, 0x80, 0x07, 0x02, 0x00, 0x3B, 
+0x00, 0x80, 0x07, 0x01, 0x00, 0x84, 0x04, 0x45, 0x7D, 0x10, 0x09, 0x08, 0x02, 0x06, 0x01, 0x8B, 
+0x08, 0x2D, 0x62, 0x0F, 0x19, 0x50, 0x3B, 0x00, 0x2B, 0x1F, 0xA3, 0x0B, 0x14, 0x01, 0x84, 0x0B, 
+0x1D, 0x35, 0xD3, 0x21, 0x1B, 0x01, 0x86, 0x92, 0x16, 0x71, 0x1C, 0x40, 0x00, 0x50, 0x02, 0x01, 
+0x01, 0x00, 0x04, 0x01, 0x81, 0x00, 0x04, 0x1A, 0x01, 0x85, 0x05, 0x16, 0x9C, 0xE2, 0x6E, 0x08, 
+0x13, 0x01, 0x8D, 0x03, 0x0B, 0x23, 0x55, 0x00, 0x26, 0x34, 0x56, 0x00, 0x37, 0x32, 0x16, 0x08, 
+0x03, 0x05, 0x01, 0x80, 0x0D, 0x01, 0x06, 0x04, 0x02, 0x85, 0x09, 0x0E, 0x99, 0x12, 0x00, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x3D, 0x00, 0x84, 0x04, 0x00, 0xFF, 0xDA, 0xDE, 0x47, 0x0E, 0x05, 0x02, 
+0x01, 0x06, 0x80, 0x0D, 0x06, 0x01, 0x82, 0x05, 0xB0, 0x35, 0x01, 0x00, 0x88, 0x55, 0xFF, 0xEC, 
+0x5A, 0x9B, 0x38, 0x00, 0x30, 0x3A, 0x80, 0x08, 0x15, 0x01, 0x81, 0x8F, 0x05, 0x20, 0x01, 0x82, 
+0x6E, 0x00, 0x30, 0x02, 0x01, 0x82, 0x12, 0x00, 0x13, 0x02, 0x01, 0x82, 0x13, 0x00, 0x12, 0x1B, 
+0x01, 0x01, 0x05, 0x80, 0x17, 0x14, 0x01, 0x86, 0x03, 0x05, 0x23, 0x41, 0x0F, 0x19, 0x28, 0x01, 
+0x18, 0x86, 0x54, 0x12, 0x0C, 0x24, 0x16, 0x0B, 0x03, 0x05, 0x01, 0x81, 0x0D, 0x06, 0x05, 0x02, 
+0x01, 0x09, 0x83, 0x94, 0x52, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3B, 0x00, 0x84, 0x04, 0x00, 
+0xFF, 0x1B, 0xE7, 0x89, 0x14, 0x08, 0x02, 0x80, 0x08, 0x05, 0x01, 0x8F, 0x05, 0x1C, 0x24, 0x4F, 
+0x0C, 0x34, 0x16, 0x11, 0xA6, 0xD1, 0x39, 0x00, 0x1A, 0x6C, 0x64, 0x0B, 0x37, 0x01, 0x82, 0x13, 
+0x00, 0x04, 0x02, 0x01, 0x82, 0x40, 0x00, 0x4D, 0x02, 0x01, 0x82, 0x4D, 0x00, 0x1B, 0x32, 0x01, 
+0x90, 0x03, 0x57, 0x1E, 0xFF, 0x19, 0xB6, 0x00, 0xFF, 0x9F, 0xF7, 0x42, 0x1E, 0x01, 0x0B, 0x44, 
+0x34, 0x00, 0x26, 0x6C, 0xB0, 0x08, 0x05, 0x01, 0x82, 0x08, 0x02, 0x06, 0x05, 0x02, 0x82, 0x0E, 
+0x02, 0x7A, 0x3E, 0x00, 0x81, 0x07, 0x00, 0x3A, 0x00, 0x01, 0x04, 0x01, 0x00, 0x82, 0x7E, 0x0E, 
+0x09, 0x05, 0x02, 0x01, 0x06, 0x80, 0x15, 0x06, 0x01, 0x87, 0x17, 0xAB, 0x4F, 0x0C, 0x55, 0x1D, 
+0x13, 0x11, 0x01, 0x01, 0x86, 0x1D, 0x63, 0x0C, 0x37, 0x6F, 0x1D, 0x03, 0x36, 0x01, 0x82, 0x1C, 
+0x00, 0x30, 0x02, 0x01, 0x82, 0x34, 0x00, 0x1F, 0x02, 0x01, 0x82, 0x1F, 0x00, 0x34, 0x33, 0x01, 
+0x8F, 0xDC, 0xFF, 0x9B, 0xC6, 0x00, 0x04, 0x9C, 0x18, 0x0B, 0x01, 0x03, 0x01, 0x77, 0x32, 0x00, 
+0x1A, 0x62, 0x67, 0x06, 0x01, 0x80, 0x49, 0x01, 0x02, 0x80, 0x06, 0x03, 0x02, 0x85, 0x0D, 0x14, 
+0x66, 0x7F, 0x00, 0x04, 0x3D, 0x00, 0x81, 0x00, 0x07, 0x39, 0x00, 0x84, 0x04, 0x00, 0x85, 0x0D, 
+0x09, 0x06, 0x02, 0x82, 0x06, 0x49, 0x03, 0x03, 0x01, 0x88, 0x03, 0x05, 0x18, 0x24, 0x2B, 0x00, 
+0x4E, 0x1C, 0x0B, 0x02, 0x01, 0x87, 0x03, 0x01, 0x43, 0x69, 0x00, 0x2B, 0x33, 0x13, 0x31, 0x01, 
+0x81, 0x32, 0x1C, 0x01, 0x13, 0x83, 0x1D, 0x1A, 0x00, 0x4A, 0x02, 0x01, 0x88, 0x22, 0x00, 0x12, 
+0x5C, 0x03, 0x5C, 0x12, 0x00, 0x22, 0x31, 0x01, 0x88, 0x08, 0x6E, 0x24, 0x04, 0x86, 0xE2, 0x16, 
+0x01, 0x03, 0x03, 0x01, 0x86, 0x77, 0x59, 0x00, 0x3B, 0xB1, 0x8C, 0xF1, 0x04, 0x01, 0x83, 0x03, 
+0x15, 0x02, 0x06, 0x04, 0x02, 0x83, 0x09, 0x10, 0x83, 0x30, 0x3E, 0x00, 0x80, 0x07, 0x3B, 0x00, 
+0x82, 0x45, 0x83, 0x2C, 0x06, 0x02, 0x81, 0x06, 0x36, 0x06, 0x01, 0x87, 0x0B, 0x70, 0x4E, 0x00, 
+0x39, 0xA7, 0x11, 0x03, 0x02, 0x01, 0x87, 0x08, 0x2F, 0x11, 0x6E, 0x54, 0x19, 0x4A, 0x21, 0x31, 
+0x01, 0x05, 0x00, 0x81, 0x30, 0x8F, 0x03, 0x01, 0x80, 0x8E, 0x04, 0x00, 0x80, 0x5D, 0x33, 0x01, 
+0x85, 0xD0, 0x69, 0x0F, 0x69, 0x16, 0x08, 0x03, 0x01, 0x01, 0x03, 0x86, 0x11, 0x43, 0x74, 0x00, 
+0x39, 0xA5, 0x13, 0x06, 0x01, 0x01, 0x02, 0x80, 0x06, 0x04, 0x02, 0x84, 0x10, 0x46, 0x98, 0x00, 
+0x04, 0x3C, 0x00, 0x01, 0x00, 0x80, 0x07, 0x36, 0x00, 0x01, 0x04, 0x82, 0x00, 0x82, 0x09, 0x08, 
+0x02, 0x80, 0x08, 0x03, 0x01, 0x89, 0x03, 0x01, 0x0B, 0x29, 0x4E, 0x00, 0x19, 0x1F, 0x0B, 0x03, 
+0x03, 0x01, 0x80, 0x05, 0x01, 0x01, 0x83, 0x0B, 0x95, 0xC1, 0x4D, 0x32, 0x01, 0x86, 0x1C, 0x5D, 
+0x19, 0x04, 0x1A, 0x62, 0x21, 0x04, 0x01, 0x86, 0x03, 0x20, 0x1A, 0x04, 0x1A, 0x20, 0x03, 0x33, 
+0x01, 0x84, 0x05, 0x22, 0x25, 0xD0, 0x08, 0x06, 0x01, 0x87, 0x03, 0x0B, 0x24, 0x1A, 0x00, 0x50, 
+0x1D, 0x05, 0x05, 0x01, 0x82, 0x31, 0x02, 0x06, 0x05, 0x02, 0x82, 0x14, 0x97, 0x52, 0x3D, 0x00, 
+0x81, 0x00, 0x07, 0x39, 0x00, 0x82, 0x9F, 0x0D, 0x10, 0x05, 0x02, 0x01, 0x06, 0x81, 0x5E, 0x03, 
+0x03, 0x01, 0x87, 0x03, 0xFF, 0xE8, 0x31, 0x16, 0x24, 0x04, 0x19, 0x6C, 0x17, 0x09, 0x01, 0x81, 
+0x08, 0x13, 0x7C, 0x01, 0x80, 0x0B, 0x0A, 0x01, 0x81, 0x60, 0x24, 0x01, 0x0C, 0x81, 0x96, 0x2D, 
+0x05, 0x01, 0x83, 0x03, 0x0D, 0x02, 0x06, 0x04, 0x02, 0x84, 0x0E, 0x02, 0x82, 0x00, 0x04, 0x3B, 
+0x00, 0x02, 0x00, 0x80, 0x07, 0x36, 0x00, 0x82, 0x65, 0x99, 0x0E, 0x07, 0x02, 0x80, 0x0D, 0x05, 
+0x01, 0x86, 0x2F, 0x17, 0x3A, 0x12, 0x00, 0x56, 0x27, 0x7F, 0x01, 0x16, 0x01, 0x85, 0x1C, 0x42, 
+0x00, 0x2B, 0x28, 0x13, 0x05, 0x01, 0x82, 0x08, 0x02, 0x06, 0x05, 0x02, 0x82, 0x14, 0x87, 0x5D, 
+0x3C, 0x00, 0x01, 0x00, 0x80, 0x07, 0x37, 0x00, 0x83, 0x94, 0x76, 0x0E, 0x09, 0x04, 0x02, 0x01, 
+0x06, 0x81, 0x08, 0x03, 0x04, 0x01, 0x86, 0x08, 0x22, 0x39, 0x00, 0x32, 0x44, 0x05, 0x47, 0x01, 
+0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x48, 0x01, 0x86, 0xA5, 0x73, 0x00, 0x38, 0x20, 0x57, 0x03, 
+0x03, 0x01, 0x81, 0x03, 0x08, 0x01, 0x06, 0x04, 0x02, 0x83, 0x09, 0x0E, 0xA0, 0x04, 0x3B, 0x00, 
+0x02, 0x00, 0x80, 0x07, 0x36, 0x00, 0x82, 0x99, 0x09, 0x0D, 0x04, 0x02, 0x82, 0x2A, 0x06, 0x15, 
+0x04, 0x01, 0x86, 0x03, 0x05, 0x43, 0x5B, 0x00, 0x79, 0x6F, 0x41, 0x01, 0x01, 0x03, 0x02, 0x01, 
+0x80, 0x08, 0x01, 0x05, 0x06, 0x0B, 0x01, 0x05, 0x80, 0x08, 0x01, 0x01, 0x02, 0x03, 0x40, 0x01, 
+0x87, 0x71, 0x23, 0x2B, 0x00, 0x51, 0x44, 0x2F, 0x03, 0x04, 0x01, 0x80, 0x15, 0x01, 0x06, 0x03, 
+0x02, 0x85, 0x0D, 0x14, 0x47, 0xAE, 0x00, 0x04, 0x39, 0x00, 0x04, 0x00, 0x80, 0x07, 0x32, 0x00, 
+0x83, 0x04, 0x91, 0xFF, 0x66, 0x29, 0x09, 0x05, 0x02, 0x82, 0x2A, 0x02, 0x03, 0x03, 0x01, 0x87, 
+0x03, 0x05, 0x21, 0x8D, 0x07, 0x19, 0x1F, 0x0B, 0x40, 0x01, 0x80, 0x05, 0x01, 0x0B, 0x97, 0x08, 
+0x03, 0x71, 0x18, 0x17, 0x1E, 0x18, 0x2D, 0x1C, 0x1D, 0x4D, 0x1C, 0x18, 0x44, 0x18, 0x21, 0x11, 
+0x08, 0x57, 0x81, 0x0B, 0x05, 0x01, 0x03, 0x3E, 0x01, 0x81, 0x11, 0x51, 0x01, 0x19, 0x83, 0x3A, 
+0x21, 0x5F, 0x03, 0x03, 0x01, 0x82, 0x03, 0x02, 0x06, 0x05, 0x02, 0x82, 0x10, 0xAD, 0x65, 0x3A, 
+0x00, 0x03, 0x00, 0x80, 0x07, 0x30, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0x52, 0x9E, 0x0E, 0x05, 
+0x02, 0x01, 0x06, 0x80, 0x49, 0x06, 0x01, 0x84, 0x62, 0x19, 0x00, 0x4E, 0x16, 0x3A, 0x01, 0x01, 
+0x03, 0x90, 0x01, 0x08, 0x05, 0x0B, 0x01, 0x16, 0xB0, 0x29, 0x8D, 0x9B, 0x41, 0x7B, 0x41, 0x50, 
+0x63, 0x5B, 0x4E, 0x01, 0x38, 0x8D, 0x32, 0x1B, 0x56, 0x51, 0x3A, 0x56, 0x70, 0x95, 0x70, 0x1C, 
+0x18, 0x2F, 0x81, 0x05, 0x02, 0x01, 0x80, 0x03, 0x3A, 0x01, 0x85, 0x16, 0xE3, 0x00, 0x59, 0x3D, 
+0x11, 0x05, 0x01, 0x80, 0x31, 0x01, 0x06, 0x04, 0x02, 0x84, 0x10, 0x0D, 0x94, 0x00, 0x04, 0x38, 
+0x00, 0x05, 0x00, 0x80, 0x07, 0x2E, 0x00, 0x84, 0x04, 0x12, 0x00, 0x91, 0x2C, 0x07, 0x02, 0x81, 
+0x15, 0x03, 0x04, 0x01, 0x86, 0x05, 0xA3, 0x32, 0x00, 0x5B, 0x1C, 0x0B, 0x38, 0x01, 0x81, 0x03, 
+0x08, 0x01, 0x0B, 0x8A, 0x05, 0x67, 0x3D, 0x1D, 0x32, 0x34, 0x50, 0x1B, 0x48, 0x0C, 0x0F, 0x01, 
+0x00, 0x84, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x02, 0x00, 0x80, 0x0C, 0x01, 0x00, 0x84, 0x0C, 0x0F, 
+0xF5, 0x1A, 0x3E, 0x01, 0x28, 0x87, 0x3C, 0x1D, 0x71, 0x03, 0x08, 0x05, 0x01, 0x03, 0x38, 0x01, 
+0x86, 0x05, 0x25, 0x39, 0x00, 0x55, 0x1E, 0x05, 0x04, 0x01, 0x82, 0x03, 0x49, 0x06, 0x05, 0x02, 
+0x84, 0x14, 0x6B, 0x4B, 0x00, 0x04, 0x37, 0x00, 0x06, 0x00, 0x80, 0x07, 0x2D, 0x00, 0x84, 0x04, 
+0x00, 0x72, 0x47, 0x0E, 0x05, 0x02, 0x82, 0x06, 0x02, 0x08, 0x05, 0x01, 0x85, 0x60, 0x42, 0x00, 
+0x58, 0x3A, 0x05, 0x39, 0x01, 0x89, 0x0B, 0x31, 0x16, 0x1E, 0x43, 0x56, 0x3E, 0x4F, 0x26, 0x0C, 
+0x01, 0x00, 0x81, 0x12, 0x19, 0x01, 0x1B, 0x84, 0x69, 0x50, 0x56, 0x34, 0x35, 0x01, 0x33, 0x83, 
+0xFF, 0xD8, 0xBD, 0xE0, 0xC9, 0x63, 0x01, 0x48, 0x81, 0x19, 0xCD, 0x01, 0x00, 0x89, 0xDD, 0x37, 
+0x4F, 0x51, 0x20, 0xFF, 0x56, 0x9D, 0x43, 0x80, 0x01, 0x05, 0x39, 0x01, 0x85, 0x11, 0x33, 0x3F, 
+0x37, 0x1F, 0x80, 0x05, 0x01, 0x82, 0x2F, 0x02, 0x06, 0x04, 0x02, 0x84, 0x0E, 0x09, 0x93, 0x00, 
+0x04, 0x37, 0x00, 0x06, 0x00, 0x80, 0x07, 0x2B, 0x00, 0x03, 0x04, 0x81, 0x91, 0x0E, 0x05, 0x02, 
+0x01, 0x06, 0x81, 0x15, 0x03, 0x04, 0x01, 0x85, 0x11, 0x9A, 0x59, 0x0C, 0x35, 0x18, 0x38, 0x01, 
+0x87, 0x08, 0x8C, 0xDC, 0xA9, 0x20, 0x39, 0x26, 0x0F, 0x01, 0x0C, 0x9A, 0x2B, 0x3B, 0x3E, 0x8D, 
+0x4C, 0xC8, 0xA3, 0x27, 0x18, 0x21, 0x17, 0x71, 0x11, 0x03, 0x01, 0xA6, 0x13, 0x11, 0x67, 0xFF, 
+0x4C, 0x53, 0x1C, 0x9B, 0x1F, 0x6C, 0xC9, 0xFF, 0x5E, 0xDF, 0x37, 0x01, 0x0C, 0x87, 0x37, 0x3F, 
+0x5A, 0xFF, 0xF8, 0xAD, 0x24, 0xAF, 0x71, 0x05, 0x38, 0x01, 0x85, 0x1C, 0xC3, 0x00, 0x59, 0x1D, 
+0x11, 0x04, 0x01, 0x82, 0x03, 0x15, 0x06, 0x05, 0x02, 0x84, 0x14, 0x53, 0x84, 0x00, 0x04, 0x36, 
+0x00, 0x07, 0x00, 0x80, 0x07, 0x2B, 0x00, 0x84, 0x04, 0x00, 0x98, 0x10, 0x0E, 0x05, 0x02, 0x81, 
+0x06, 0x02, 0x05, 0x01, 0x87, 0x08, 0x2D, 0xDE, 0x00, 0x1B, 0x23, 0x05, 0x03, 0x34, 0x01, 0x86, 
+0x08, 0x01, 0x13, 0xF6, 0x51, 0x41, 0x2E, 0x01, 0x00, 0x8A, 0x37, 0x74, 0x3E, 0x1F, 0x23, 0x1E, 
+0x17, 0x11, 0x05, 0x01, 0x0B, 0x01, 0x05, 0x80, 0x08, 0x06, 0x01, 0x8D, 0x08, 0x01, 0x5F, 0x0B, 
+0x03, 0x01, 0x11, 0xD0, 0x44, 0xA2, 0x35, 0x54, 0xFF, 0x3D, 0xD7, 0xFF, 0xBF, 0xE7, 0x01, 0x0C, 
+0x86, 0x3F, 0xE3, 0x25, 0x3C, 0x60, 0x05, 0x08, 0x35, 0x01, 0x86, 0x05, 0x25, 0x48, 0x00, 0x42, 
+0x64, 0x05, 0x05, 0x01, 0x81, 0x02, 0x06, 0x04, 0x02, 0x83, 0x09, 0x0E, 0xA0, 0x12, 0x37, 0x00, 
+0x06, 0x00, 0x80, 0x07, 0x2E, 0x00, 0x81, 0x7D, 0x10, 0x05, 0x02, 0x01, 0x06, 0x80, 0x15, 0x05, 
+0x01, 0x86, 0x13, 0x6C, 0x3F, 0x37, 0x20, 0x08, 0x11, 0x33, 0x01, 0x8E, 0x05, 0x08, 0x21, 0x16, 
+0xFF, 0x15, 0x95, 0x1B, 0x1A, 0x00, 0x12, 0x1B, 0x4A, 0x25, 0x1C, 0x13, 0x11, 0x02, 0x05, 0x80, 
+0x08, 0x14, 0x01, 0x8F, 0x05, 0x0B, 0x03, 0x17, 0x6E, 0xFF, 0x92, 0x7C, 0xE1, 0x4F, 0x00, 0x0C, 
+0xB9, 0x5A, 0x33, 0xBF, 0x18, 0x08, 0x33, 0x01, 0x87, 0x03, 0x01, 0x8C, 0x9C, 0x00, 0x04, 0x29, 
+0x17, 0x05, 0x01, 0x80, 0x15, 0x01, 0x06, 0x03, 0x02, 0x85, 0x0D, 0x14, 0x47, 0xB7, 0x00, 0x04, 
+0x35, 0x00, 0x08, 0x00, 0x80, 0x07, 0x2B, 0x00, 0x81, 0x98, 0x46, 0x07, 0x02, 0x81, 0x5E, 0x03, 
+0x03, 0x01, 0x88, 0x03, 0x57, 0x22, 0x5B, 0x37, 0x4F, 0x29, 0x60, 0x08, 0x32, 0x01, 0x84, 0x05, 
+0x18, 0x1E, 0x25, 0x59, 0x01, 0x00, 0x88, 0x30, 0x4E, 0x20, 0x1E, 0x18, 0x01, 0x0B, 0x01, 0x08, 
+0x1C, 0x01, 0x01, 0x0B, 0x83, 0x13, 0xE5, 0xEF, 0xFF, 0x7E, 0xDF, 0x01, 0x0C, 0x85, 0xDD, 0xC7, 
+0x56, 0x1C, 0x71, 0x05, 0x30, 0x01, 0x88, 0x03, 0x05, 0x01, 0x1D, 0xE0, 0x58, 0x00, 0x38, 0x2D, 
+0x05, 0x01, 0x82, 0x03, 0x15, 0x06, 0x05, 0x02, 0x82, 0x14, 0x6B, 0x40, 0x36, 0x00, 0x07, 0x00, 
+0x80, 0x07, 0x2C, 0x00, 0x81, 0x83, 0xC6, 0x05, 0x02, 0x82, 0x06, 0x36, 0x31, 0x03, 0x01, 0x84, 
+0x03, 0x01, 0x18, 0x41, 0x00, 0x01, 0x0C, 0x83, 0x54, 0x69, 0xA2, 0x17, 0x02, 0x01, 0x01, 0x03, 
+0x2A, 0x01, 0x84, 0x5F, 0x11, 0x1E, 0x29, 0x74, 0x01, 0x00, 0x86, 0x30, 0x34, 0x3C, 0x60, 0x08, 
+0x01, 0x05, 0x0A, 0x01, 0x80, 0x03, 0x16, 0x01, 0x01, 0x05, 0x8C, 0x03, 0x6E, 0x28, 0xBD, 0xDD, 
+0x0C, 0xDD, 0x4E, 0x3C, 0x22, 0x05, 0x01, 0x03, 0x2D, 0x01, 0x84, 0x0B, 0x6E, 0xB4, 0x50, 0x12, 
+0x01, 0x00, 0x84, 0xCD, 0x6F, 0x18, 0xF3, 0x03, 0x03, 0x01, 0x82, 0x08, 0x02, 0x06, 0x04, 0x02, 
+0x82, 0x10, 0x46, 0x84, 0x36, 0x00, 0x07, 0x00, 0x80, 0x07, 0x29, 0x00, 0x83, 0x04, 0x00, 0x30, 
+0x47, 0x07, 0x02, 0x81, 0x0D, 0x03, 0x04, 0x01, 0x8C, 0x05, 0x29, 0xA8, 0x0C, 0x54, 0xCA, 0x0C, 
+0x00, 0x63, 0xC1, 0xAF, 0x01, 0x05, 0x29, 0x01, 0x85, 0x03, 0x01, 0x05, 0x21, 0x22, 0x32, 0x01, 
+0x00, 0x83, 0x26, 0x41, 0x29, 0x80, 0x01, 0x05, 0x28, 0x01, 0x8B, 0x05, 0x57, 0x18, 0xA9, 0x3B, 
+0x0F, 0x00, 0x0F, 0xC9, 0x1C, 0x80, 0x05, 0x29, 0x01, 0x8D, 0x03, 0x01, 0x05, 0x18, 0x1F, 0x35, 
+0x5A, 0x00, 0x58, 0x39, 0xA8, 0x00, 0xA8, 0x2D, 0x05, 0x01, 0x82, 0x03, 0x5E, 0x06, 0x05, 0x02, 
+0x81, 0x0E, 0x7F, 0x36, 0x00, 0x07, 0x00, 0x80, 0x07, 0x29, 0x00, 0x85, 0x04, 0x45, 0x91, 0x09, 
+0x02, 0x09, 0x03, 0x02, 0x01, 0x06, 0x05, 0x01, 0x90, 0x05, 0x4D, 0x3E, 0x00, 0x2B, 0x25, 0x23, 
+0x35, 0x3F, 0x0C, 0x3F, 0xE3, 0x23, 0xFF, 0x8F, 0x63, 0x08, 0x05, 0x03, 0x26, 0x01, 0x84, 0x05, 
+0x01, 0x27, 0x20, 0x37, 0x01, 0x00, 0x84, 0x55, 0x3C, 0x16, 0x08, 0x0B, 0x2A, 0x01, 0x8B, 0x03, 
+0x01, 0x05, 0x08, 0x64, 0x6C, 0xAA, 0x04, 0x00, 0xA8, 0x33, 0x18, 0x01, 0x01, 0x80, 0x03, 0x26, 
+0x01, 0x84, 0x0B, 0x01, 0x25, 0x24, 0x39, 0x01, 0x00, 0x88, 0x5A, 0x4C, 0xE6, 0x6F, 0x30, 0x0C, 
+0x28, 0x16, 0x05, 0x04, 0x01, 0x82, 0x49, 0x02, 0x06, 0x03, 0x02, 0x83, 0x09, 0x0E, 0x97, 0x12, 
+0x35, 0x00, 0x08, 0x00, 0x80, 0x07, 0x27, 0x00, 0x84, 0xBB, 0x00, 0x52, 0x09, 0x14, 0x05, 0x02, 
+0x81, 0x2A, 0x06, 0x06, 0x01, 0x8F, 0x23, 0x2B, 0x0C, 0x68, 0x67, 0x01, 0x21, 0x1F, 0x3B, 0x3F, 
+0x0C, 0x59, 0x92, 0xC8, 0x18, 0x05, 0x24, 0x01, 0x84, 0x03, 0x0B, 0x17, 0x3A, 0x4E, 0x01, 0x00, 
+0x84, 0x1B, 0x1F, 0x1E, 0x03, 0x0B, 0x2E, 0x01, 0x8C, 0x03, 0x01, 0x0B, 0x11, 0x64, 0x68, 0x65, 
+0x00, 0x0C, 0x56, 0x28, 0x13, 0x05, 0x23, 0x01, 0x92, 0x03, 0x5F, 0x05, 0x1D, 0x9C, 0x55, 0x04, 
+0x00, 0x19, 0x24, 0x1E, 0x11, 0x01, 0x16, 0x4A, 0x00, 0x48, 0x5C, 0xA6, 0x05, 0x01, 0x01, 0x02, 
+0x80, 0x06, 0x03, 0x02, 0x82, 0x09, 0x0E, 0x7F, 0x35, 0x00, 0x08, 0x00, 0x80, 0x07, 0x29, 0x00, 
+0x82, 0x7F, 0x09, 0x0D, 0x06, 0x02, 0x80, 0x5E, 0x03, 0x01, 0x94, 0x03, 0x05, 0x1E, 0x68, 0x0C, 
+0x48, 0xD1, 0x05, 0x03, 0x01, 0x05, 0x18, 0x20, 0x1A, 0x0C, 0x00, 0x72, 0x8D, 0x23, 0x01, 0x05, 
+0x21, 0x01, 0x8B, 0x03, 0x81, 0x1C, 0x51, 0x3B, 0x00, 0x12, 0x34, 0x3D, 0x17, 0xD7, 0x5F, 0x33, 
+0x01, 0x83, 0x0B, 0x17, 0x3D, 0x8E, 0x01, 0x00, 0x83, 0x48, 0x4C, 0x1E, 0x05, 0x20, 0x01, 0x95, 
+0x03, 0x01, 0x0B, 0x16, 0x20, 0x41, 0x19, 0x00, 0x0F, 0x32, 0x22, 0x13, 0x01, 0x03, 0x31, 0x05, 
+0x25, 0x2E, 0x00, 0x62, 0x27, 0x05, 0x04, 0x01, 0x82, 0x15, 0x02, 0x06, 0x03, 0x02, 0x83, 0x09, 
+0x0E, 0x53, 0xCD, 0x34, 0x00, 0x09, 0x00, 0x80, 0x07, 0x24, 0x00, 0x01, 0x04, 0x83, 0x12, 0x30, 
+0x93, 0x10, 0x07, 0x02, 0x06, 0x01, 0x84, 0x28, 0x5A, 0x0C, 0x35, 0x21, 0x02, 0x01, 0x8C, 0x03, 
+0x01, 0x03, 0x1C, 0x3A, 0x86, 0x00, 0x0C, 0x5B, 0x29, 0x1D, 0x11, 0x08, 0x1D, 0x01, 0x8C, 0x03, 
+0x08, 0x31, 0x43, 0x33, 0x78, 0x00, 0x1B, 0x28, 0x16, 0x08, 0x05, 0x03, 0x36, 0x01, 0x88, 0x0B, 
+0x60, 0x3A, 0x1A, 0x00, 0x1A, 0x41, 0x1E, 0x05, 0x1F, 0x01, 0x84, 0x0B, 0x17, 0x6F, 0x33, 0x40, 
+0x01, 0x00, 0x82, 0xFF, 0xDC, 0xDE, 0xF7, 0x75, 0x01, 0x01, 0x80, 0x03, 0x02, 0x01, 0x86, 0x60, 
+0x34, 0x00, 0x1B, 0x77, 0x01, 0x03, 0x04, 0x01, 0x01, 0x02, 0x80, 0x06, 0x03, 0x02, 0x82, 0x09, 
+0x10, 0x7E, 0x34, 0x00, 0x09, 0x00, 0x80, 0x07, 0x27, 0x00, 0x83, 0xB7, 0x10, 0x0E, 0x09, 0x04, 
+0x02, 0x82, 0x06, 0x5E, 0x03, 0x02, 0x01, 0x87, 0x03, 0x05, 0x18, 0x24, 0x0C, 0x1B, 0x1C, 0x05, 
+0x04, 0x01, 0x8C, 0x03, 0x01, 0x17, 0x3C, 0x42, 0x19, 0x00, 0x19, 0x69, 0xA5, 0x77, 0x01, 0x08, 
+0x1C, 0x01, 0x88, 0x11, 0x5C, 0x34, 0x0C, 0x00, 0x5B, 0x29, 0x11, 0x0B, 0x39, 0x01, 0x88, 0x5F, 
+0x08, 0x13, 0xA2, 0xBD, 0x00, 0x0C, 0x62, 0x29, 0x1D, 0x01, 0x01, 0x08, 0x82, 0x29, 0x3A, 0x4B, 
+0x01, 0x00, 0x85, 0x65, 0x6C, 0x60, 0x11, 0x01, 0x03, 0x04, 0x01, 0x85, 0x08, 0x1F, 0x1B, 0x04, 
+0xD2, 0x13, 0x04, 0x01, 0x81, 0x03, 0x15, 0x05, 0x02, 0x01, 0x09, 0x81, 0x53, 0xFF, 0x7E, 0xF7, 
+0x33, 0x00, 0x0A, 0x00, 0x80, 0x07, 0x24, 0x00, 0x84, 0x04, 0x00, 0x7D, 0x10, 0x0D, 0x05, 0x02, 
+0x80, 0x06, 0x05, 0x01, 0x85, 0x05, 0x9B, 0x1A, 0x00, 0x41, 0x67, 0x09, 0x01, 0x88, 0xFF, 0x0D, 
+0x5B, 0x1F, 0x54, 0x3F, 0x0C, 0x48, 0x54, 0x95, 0x16, 0x1C, 0x01, 0x86, 0x1D, 0x39, 0x00, 0x0F, 
+0x41, 0x1E, 0x08, 0x3C, 0x01, 0x84, 0x03, 0x0B, 0x01, 0x77, 0x3E, 0x01, 0x0C, 0x82, 0x50, 0xC1, 
+0x03, 0x1B, 0x01, 0x88, 0x1D, 0x96, 0x32, 0x0F, 0x00, 0x45, 0x4A, 0xB5, 0x11, 0x07, 0x01, 0x87, 
+0x03, 0x01, 0x21, 0x55, 0x00, 0x6D, 0xD9, 0x0B, 0x05, 0x01, 0x81, 0x02, 0x06, 0x04, 0x02, 0x84, 
+0x10, 0xB2, 0x40, 0x00, 0x04, 0x31, 0x00, 0x0C, 0x00, 0x80, 0x07, 0x22, 0x00, 0x83, 0x04, 0x45, 
+0x47, 0x0E, 0x06, 0x02, 0x80, 0x0D, 0x05, 0x01, 0x86, 0x7C, 0x41, 0x0C, 0x1A, 0x23, 0x0B, 0x03, 
+0x09, 0x01, 0x8A, 0x11, 0xB0, 0xC4, 0x59, 0x3F, 0x00, 0xE7, 0xB8, 0x27, 0x05, 0x03, 0x17, 0x01, 
+0x88, 0x21, 0x28, 0xAA, 0x00, 0x4F, 0x28, 0x60, 0x01, 0x08, 0x3F, 0x01, 0x87, 0x81, 0x1E, 0x56, 
+0x07, 0x00, 0x5B, 0xAF, 0x11, 0x19, 0x01, 0x87, 0x1D, 0xC3, 0x2B, 0x00, 0x0F, 0xB6, 0xC8, 0x17, 
+0x0A, 0x01, 0x86, 0x03, 0x0B, 0x8D, 0xFF, 0x5C, 0xE7, 0x45, 0x62, 0x9D, 0x05, 0x01, 0x81, 0x15, 
+0x06, 0x05, 0x02, 0x82, 0x14, 0x8A, 0xF2, 0x32, 0x00, 0x0B, 0x00, 0x80, 0x07, 0x24, 0x00, 0x82, 
+0x5D, 0x10, 0x09, 0x04, 0x02, 0x01, 0x06, 0x80, 0x08, 0x03, 0x01, 0x86, 0x03, 0x0B, 0x29, 0x3B, 
+0x00, 0x4A, 0x75, 0x0E, 0x01, 0x86, 0x95, 0x24, 0xFF, 0xDE, 0xEF, 0x00, 0xB9, 0xFF, 0xCF, 0x63, 
+0x05, 0x17, 0x01, 0x88, 0x13, 0x3D, 0x63, 0x00, 0x1A, 0x20, 0x18, 0x05, 0x5F, 0x3F, 0x01, 0x89, 
+0x03, 0x05, 0x01, 0x17, 0x24, 0x12, 0x00, 0x3E, 0x28, 0x0B, 0x18, 0x01, 0x85, 0x70, 0x2E, 0x00, 
+0x48, 0x3C, 0x75, 0x0E, 0x01, 0x85, 0x67, 0x63, 0x00, 0x32, 0x43, 0x0B, 0x04, 0x01, 0x82, 0x08, 
+0x02, 0x06, 0x04, 0x02, 0x82, 0x14, 0xFF, 0xCB, 0x52, 0x52, 0x32, 0x00, 0x0B, 0x00, 0x80, 0x07, 
+0x24, 0x00, 0x81, 0x8B, 0x0E, 0x05, 0x02, 0x82, 0x06, 0x02, 0x2F, 0x04, 0x01, 0x85, 0x71, 0x62, 
+0x00, 0x12, 0x6F, 0x05, 0x0D, 0x01, 0x86, 0x03, 0x05, 0x17, 0xC4, 0x55, 0xB8, 0x67, 0x16, 0x01, 
+0x88, 0x5F, 0x13, 0x25, 0x59, 0x00, 0x2B, 0xC4, 0x13, 0x0B, 0x44, 0x01, 0x87, 0xFD, 0x18, 0x8D, 
+0x0F, 0x0C, 0x54, 0xFF, 0xD0, 0x6B, 0x13, 0x17, 0x01, 0x86, 0x80, 0xB3, 0xB4, 0x16, 0x11, 0x01, 
+0x03, 0x0D, 0x01, 0x81, 0x03, 0xA4, 0x01, 0x12, 0x81, 0x6F, 0x03, 0x05, 0x01, 0x81, 0x0D, 0x06, 
+0x04, 0x02, 0x84, 0x0D, 0xC6, 0x85, 0x00, 0x04, 0x30, 0x00, 0x0D, 0x00, 0x80, 0x07, 0x1F, 0x00, 
+0x84, 0x04, 0x00, 0xC5, 0x0D, 0x09, 0x05, 0x02, 0x82, 0x2A, 0x15, 0x03, 0x02, 0x01, 0x86, 0x03, 
+0x0B, 0x2D, 0x38, 0x00, 0x32, 0x60, 0x12, 0x01, 0x81, 0x11, 0x8F, 0x17, 0x01, 0x86, 0x11, 0xF6, 
+0xB6, 0x00, 0x2B, 0xA9, 0x17, 0x47, 0x01, 0x86, 0x05, 0x17, 0x33, 0x19, 0x00, 0x3E, 0xE5, 0x18, 
+0x01, 0x82, 0x13, 0x11, 0x2F, 0x11, 0x01, 0x86, 0xB0, 0x54, 0x00, 0x4A, 0xB5, 0x0B, 0x03, 0x02, 
+0x01, 0x81, 0x03, 0x49, 0x07, 0x02, 0x82, 0xFF, 0xF3, 0xA4, 0x00, 0x04, 0x30, 0x00, 0x0D, 0x00, 
+0x80, 0x07, 0x21, 0x00, 0x82, 0x91, 0x2C, 0x09, 0x05, 0x02, 0x82, 0x06, 0x49, 0x03, 0x03, 0x01, 
+0x85, 0x08, 0xA4, 0x19, 0x0F, 0x3A, 0x08, 0x2B, 0x01, 0x87, 0x0B, 0x1E, 0xC9, 0x00, 0x1A, 0xC4, 
+0x17, 0x0B, 0x47, 0x01, 0x87, 0x5F, 0x05, 0x75, 0x96, 0x0F, 0x0C, 0xFF, 0xD7, 0xA5, 0xAB, 0x2C, 
+0x01, 0x86, 0x67, 0x28, 0x00, 0x78, 0xA3, 0x08, 0x03, 0x02, 0x01, 0x83, 0x03, 0x31, 0x06, 0x2A, 
+0x03, 0x02, 0x85, 0x0D, 0x76, 0xFF, 0x6E, 0x73, 0x72, 0x00, 0x04, 0x2F, 0x00, 0x0E, 0x00, 0x80, 
+0x07, 0x1D, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0xB2, 0x10, 0x0D, 0x06, 0x02, 0x80, 0x03, 0x03, 
+0x01, 0x86, 0x08, 0x8F, 0xFF, 0xD8, 0xAD, 0x00, 0x4F, 0x1D, 0x08, 0x2A, 0x01, 0x87, 0x2F, 0x23, 
+0xC9, 0x00, 0xED, 0x20, 0x17, 0x0B, 0x4A, 0x01, 0x86, 0x81, 0x80, 0x62, 0x0F, 0x26, 0xC3, 0x5C, 
+0x2A, 0x01, 0x86, 0x03, 0x05, 0x29, 0x1B, 0x04, 0x96, 0x9D, 0x04, 0x01, 0x82, 0x03, 0x0D, 0x06, 
+0x04, 0x02, 0x83, 0x0E, 0x09, 0x91, 0x04, 0x30, 0x00, 0x0D, 0x00, 0x80, 0x07, 0x1E, 0x00, 0x83, 
+0x04, 0x00, 0x40, 0x0D, 0x07, 0x02, 0x80, 0x31, 0x03, 0x01, 0x86, 0x03, 0x0B, 0xDC, 0x5A, 0x0C, 
+0xD4, 0x11, 0x29, 0x01, 0x88, 0x03, 0x57, 0x16, 0x20, 0x0F, 0x58, 0xCE, 0xF0, 0x08, 0x4A, 0x01, 
+0x89, 0x03, 0x01, 0x05, 0x16, 0xC3, 0x0F, 0x30, 0x1F, 0x18, 0x03, 0x2A, 0x01, 0x85, 0x18, 0x50, 
+0x00, 0x38, 0x23, 0x05, 0x04, 0x01, 0x82, 0x08, 0x06, 0x2A, 0x03, 0x02, 0x83, 0x0D, 0x76, 0xAD, 
+0x65, 0x30, 0x00, 0x0D, 0x00, 0x80, 0x07, 0x20, 0x00, 0x83, 0x8B, 0x10, 0x02, 0x09, 0x03, 0x02, 
+0x81, 0x06, 0x02, 0x05, 0x01, 0x85, 0x08, 0xFF, 0x93, 0x84, 0x3F, 0xB9, 0x95, 0x05, 0x2A, 0x01, 
+0x86, 0x21, 0x33, 0x79, 0x0C, 0x51, 0xBC, 0x05, 0x4C, 0x01, 0x88, 0x03, 0x05, 0x01, 0xFF, 0xCF, 
+0x63, 0xC7, 0x00, 0x48, 0x3D, 0xA6, 0x2A, 0x01, 0x86, 0x05, 0x24, 0xF5, 0x1A, 0xE2, 0x0B, 0x03, 
+0x04, 0x01, 0x06, 0x02, 0x82, 0x09, 0x53, 0x45, 0x30, 0x00, 0x0D, 0x00, 0x80, 0x07, 0x20, 0x00, 
+0x81, 0x93, 0x14, 0x05, 0x02, 0x81, 0x06, 0x02, 0x05, 0x01, 0x84, 0x27, 0xE3, 0x00, 0x73, 0x1E, 
+0x29, 0x01, 0x86, 0x13, 0x81, 0x1C, 0x4E, 0x00, 0x63, 0x2D, 0x51, 0x01, 0x87, 0x05, 0xFF, 0x92, 
+0x7C, 0x73, 0x00, 0x55, 0x70, 0x0B, 0x03, 0x28, 0x01, 0x86, 0x05, 0x44, 0x5A, 0x00, 0x9C, 0x18, 
+0x08, 0x04, 0x01, 0x06, 0x02, 0x84, 0x0E, 0x0D, 0x94, 0x00, 0x04, 0x2E, 0x00, 0x0F, 0x00, 0x80, 
+0x07, 0x1E, 0x00, 0x81, 0x87, 0x0E, 0x06, 0x02, 0x80, 0x15, 0x03, 0x01, 0x85, 0x03, 0x0B, 0x23, 
+0x2B, 0x0C, 0x33, 0x29, 0x01, 0x88, 0x03, 0x57, 0x1D, 0x69, 0x00, 0x79, 0x29, 0x11, 0x05, 0x50, 
+0x01, 0x87, 0x05, 0x03, 0x1F, 0x26, 0x0C, 0x24, 0xB0, 0x2F, 0x29, 0x01, 0x86, 0x21, 0xD3, 0x00, 
+0x74, 0xBC, 0x0B, 0x03, 0x03, 0x01, 0x80, 0x08, 0x06, 0x02, 0x82, 0x0E, 0x99, 0x12, 0x2F, 0x00, 
+0x0E, 0x00, 0x80, 0x07, 0x1C, 0x00, 0x85, 0x04, 0x00, 0x72, 0x09, 0x02, 0x09, 0x05, 0x02, 0x80, 
+0x31, 0x04, 0x01, 0x86, 0x0B, 0x3C, 0x3F, 0x2B, 0x23, 0x81, 0x03, 0x26, 0x01, 0x88, 0x03, 0x0B, 
+0x11, 0x6F, 0x26, 0x37, 0x24, 0x13, 0x05, 0x51, 0x01, 0x87, 0x03, 0x57, 0x44, 0x42, 0x0C, 0x19, 
+0x25, 0x13, 0x2A, 0x01, 0x84, 0xA4, 0x26, 0x58, 0x4C, 0x08, 0x04, 0x01, 0x82, 0x08, 0x36, 0x06, 
+0x04, 0x02, 0x81, 0x10, 0x7A, 0x01, 0x00, 0x80, 0x04, 0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 0x1C, 
+0x00, 0x83, 0x98, 0x10, 0x02, 0x09, 0x03, 0x02, 0x82, 0x06, 0x02, 0x2F, 0x03, 0x01, 0x85, 0x08, 
+0x60, 0x51, 0x00, 0x39, 0x27, 0x29, 0x01, 0x86, 0x08, 0x3C, 0x1B, 0x00, 0x69, 0x1E, 0x0B, 0x54, 
+0x01, 0x86, 0x05, 0x1D, 0x3B, 0x00, 0x3E, 0xA2, 0x05, 0x29, 0x01, 0x84, 0x5C, 0x5B, 0x0F, 0x42, 
+0x7C, 0x05, 0x01, 0x81, 0x02, 0x06, 0x05, 0x02, 0x83, 0x14, 0x5D, 0x00, 0x04, 0x2D, 0x00, 0x10, 
+0x00, 0x80, 0x07, 0x1C, 0x00, 0x81, 0x99, 0x14, 0x07, 0x02, 0x80, 0x03, 0x03, 0x01, 0x86, 0x05, 
+0x23, 0x2B, 0x0F, 0x68, 0x08, 0x03, 0x26, 0x01, 0x87, 0x03, 0x57, 0x18, 0x42, 0x00, 0x5A, 0x29, 
+0x03, 0x54, 0x01, 0x88, 0x03, 0x0B, 0x7C, 0xA9, 0x19, 0x00, 0x28, 0x4D, 0x05, 0x28, 0x01, 0x86, 
+0x03, 0x73, 0x00, 0x51, 0x22, 0x05, 0x03, 0x02, 0x01, 0x83, 0x03, 0x15, 0x02, 0x2A, 0x04, 0x02, 
+0x83, 0x10, 0x7E, 0x00, 0x04, 0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 0x19, 0x00, 0x80, 0x04, 0x01, 
+0x00, 0x81, 0x61, 0x09, 0x06, 0x02, 0x80, 0x49, 0x04, 0x01, 0x85, 0x08, 0x6C, 0x58, 0x1A, 0x3C, 
+0x81, 0x02, 0x01, 0x80, 0x03, 0x25, 0x01, 0x85, 0xA7, 0x26, 0x0C, 0x35, 0x13, 0x05, 0x56, 0x01, 
+0x86, 0x0B, 0xBF, 0xC3, 0x00, 0x3B, 0x25, 0x05, 0x24, 0x01, 0x80, 0x03, 0x02, 0x01, 0x85, 0xC2, 
+0xA4, 0x00, 0x3F, 0x22, 0x08, 0x04, 0x01, 0x82, 0x08, 0x36, 0x2A, 0x04, 0x02, 0x82, 0x14, 0x88, 
+0x30, 0x02, 0x00, 0x80, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x16, 0x00, 0x85, 0x04, 0x00, 
+0x5D, 0x0E, 0x02, 0x09, 0x03, 0x02, 0x81, 0x06, 0x02, 0x05, 0x01, 0x8A, 0x17, 0x68, 0x58, 0x19, 
+0xDA, 0xA3, 0xE6, 0x11, 0x2F, 0x0B, 0x05, 0x21, 0x01, 0x87, 0x03, 0x05, 0x1C, 0x5B, 0x00, 0x1B, 
+0x77, 0x08, 0x57, 0x01, 0x87, 0x05, 0x03, 0x70, 0x5A, 0x00, 0x24, 0xB0, 0x05, 0x21, 0x01, 0x80, 
+0x03, 0x02, 0x05, 0x86, 0x21, 0x27, 0xA7, 0xFF, 0xD6, 0xAD, 0x26, 0x0C, 0x33, 0x05, 0x01, 0x82, 
+0x03, 0x02, 0x06, 0x03, 0x02, 0x84, 0x0D, 0x14, 0x53, 0x30, 0x04, 0x01, 0x00, 0x80, 0x04, 0x2A, 
+0x00, 0x13, 0x00, 0x80, 0x07, 0x16, 0x00, 0x83, 0x04, 0x00, 0x7E, 0x14, 0x05, 0x02, 0x81, 0x06, 
+0x02, 0x04, 0x01, 0x8D, 0x05, 0x1C, 0x54, 0x00, 0x04, 0xFF, 0xDC, 0xDE, 0xFF, 0x7A, 0xD6, 0xE4, 
+0x22, 0x1C, 0x64, 0x21, 0x11, 0x08, 0x20, 0x01, 0x86, 0x08, 0x43, 0x79, 0x0F, 0x6F, 0x57, 0x08, 
+0x58, 0x01, 0x86, 0x0B, 0x8F, 0x33, 0x0C, 0x59, 0xA4, 0x05, 0x20, 0x01, 0x8D, 0x05, 0x01, 0xD0, 
+0xDC, 0x20, 0x1F, 0x55, 0x73, 0x19, 0x00, 0x0C, 0xE0, 0x6E, 0x05, 0x04, 0x01, 0x81, 0x02, 0x06, 
+0x04, 0x02, 0x84, 0x09, 0x53, 0x4B, 0x00, 0x04, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x07, 0x1A, 0x00, 
+0x81, 0x83, 0x10, 0x06, 0x02, 0x80, 0x0D, 0x03, 0x01, 0x83, 0x03, 0x0B, 0xA7, 0x0F, 0x01, 0x00, 
+0x80, 0x04, 0x01, 0x00, 0x86, 0x26, 0x3B, 0x63, 0x25, 0x5C, 0xA2, 0x03, 0x1E, 0x01, 0x87, 0x05, 
+0x2D, 0x39, 0x00, 0x1B, 0x16, 0x08, 0x03, 0x5A, 0x01, 0x85, 0x1D, 0x48, 0x00, 0x35, 0xB0, 0x5F, 
+0x1E, 0x01, 0x85, 0xA6, 0xAB, 0xEE, 0x56, 0x2B, 0x1A, 0x02, 0x00, 0x85, 0x1A, 0x79, 0x00, 0x38, 
+0x1D, 0x0B, 0x04, 0x01, 0x81, 0x15, 0x06, 0x04, 0x02, 0x84, 0x0E, 0x02, 0x7D, 0x00, 0x04, 0x2C, 
+0x00, 0x11, 0x00, 0x80, 0x07, 0x19, 0x00, 0x81, 0x30, 0x46, 0x07, 0x02, 0x80, 0x31, 0x04, 0x01, 
+0x87, 0x11, 0x4C, 0x26, 0x1A, 0x68, 0x8A, 0x32, 0x2B, 0x02, 0x0C, 0x83, 0xDD, 0xBD, 0xCF, 0x11, 
+0x1E, 0x01, 0x85, 0x05, 0x1F, 0x19, 0x0F, 0x4C, 0x0B, 0x5B, 0x01, 0x86, 0x0B, 0x8F, 0x24, 0x0F, 
+0x4F, 0x23, 0x08, 0x1E, 0x01, 0x81, 0x1E, 0x33, 0x02, 0x00, 0x89, 0x12, 0x2B, 0x41, 0x3A, 0x4C, 
+0x6C, 0x00, 0x26, 0x1D, 0x03, 0x05, 0x01, 0x81, 0x06, 0x36, 0x03, 0x02, 0x83, 0x0D, 0x2C, 0xA0, 
+0xF2, 0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 0x1A, 0x00, 0x82, 0x5D, 0x02, 0x0E, 0x04, 0x02, 0x01, 
+0x06, 0x80, 0x08, 0x03, 0x01, 0x8F, 0x08, 0x21, 0x3A, 0x00, 0x1B, 0x27, 0xC2, 0x31, 0x2D, 0x3C, 
+0x35, 0xE7, 0x4F, 0x3F, 0x24, 0x03, 0x1C, 0x01, 0x87, 0x03, 0x05, 0xBC, 0x56, 0x0C, 0x1B, 0x27, 
+0x0B, 0x5C, 0x01, 0x86, 0x05, 0x1D, 0x1B, 0x0C, 0x24, 0x18, 0x5F, 0x1D, 0x01, 0x8F, 0x13, 0x51, 
+0x79, 0xDE, 0x3A, 0x20, 0x1E, 0x18, 0x11, 0x0B, 0x1D, 0x3B, 0x00, 0x35, 0x8C, 0x05, 0x04, 0x01, 
+0x81, 0x06, 0x36, 0x04, 0x02, 0x81, 0x09, 0x53, 0x2E, 0x00, 0x0F, 0x00, 0x80, 0x07, 0x19, 0x00, 
+0x83, 0x04, 0x00, 0x52, 0x0D, 0x05, 0x02, 0x81, 0x06, 0x02, 0x04, 0x01, 0x8F, 0x05, 0xBC, 0x59, 
+0x00, 0x5D, 0x17, 0x03, 0x13, 0x03, 0xC2, 0x01, 0x44, 0xE5, 0xA4, 0x1C, 0x05, 0x1D, 0x01, 0x85, 
+0x08, 0x28, 0xB9, 0x0C, 0xB4, 0x03, 0x5D, 0x01, 0x87, 0x0B, 0x21, 0x33, 0x00, 0x1B, 0x1E, 0x05, 
+0x03, 0x1D, 0x01, 0x8E, 0x1C, 0x1D, 0x16, 0x7C, 0x0B, 0x05, 0x01, 0x11, 0x01, 0xFF, 0xAA, 0x4A, 
+0x5B, 0x00, 0x4A, 0x44, 0x05, 0x04, 0x01, 0x01, 0x02, 0x80, 0x36, 0x03, 0x02, 0x01, 0x09, 0x82, 
+0x5D, 0x00, 0x04, 0x2B, 0x00, 0x12, 0x00, 0x80, 0x07, 0x18, 0x00, 0x82, 0x7F, 0x10, 0x09, 0x05, 
+0x02, 0x81, 0x5E, 0x03, 0x02, 0x01, 0x86, 0x03, 0x05, 0x23, 0x3F, 0x0F, 0x7B, 0x0B, 0x02, 0x01, 
+0x01, 0x03, 0x01, 0x01, 0x80, 0x13, 0x1F, 0x01, 0x85, 0x17, 0x24, 0x0C, 0x73, 0x44, 0x05, 0x5D, 
+0x01, 0x86, 0x03, 0x0B, 0x29, 0x2B, 0x0F, 0x4A, 0x08, 0x1F, 0x01, 0x81, 0x05, 0x01, 0x01, 0x03, 
+0x04, 0x01, 0x85, 0x68, 0x00, 0x5B, 0x27, 0x05, 0x03, 0x02, 0x01, 0x82, 0x03, 0x49, 0x06, 0x04, 
+0x02, 0x01, 0x09, 0x80, 0x9F, 0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 0x1A, 0x00, 0x81, 0x94, 0x0E, 
+0x05, 0x02, 0x82, 0x06, 0x15, 0x03, 0x03, 0x01, 0x86, 0x08, 0x23, 0x26, 0x19, 0xA9, 0x0B, 0x03, 
+0x25, 0x01, 0x86, 0x05, 0xA3, 0x48, 0x00, 0xCF, 0x11, 0x5F, 0x5E, 0x01, 0x86, 0x05, 0x27, 0x69, 
+0x00, 0x32, 0x1D, 0x05, 0x25, 0x01, 0x86, 0x03, 0x01, 0x1F, 0x0C, 0x26, 0x9B, 0x2F, 0x03, 0x01, 
+0x82, 0x03, 0x31, 0x06, 0x05, 0x02, 0x83, 0x0E, 0x8A, 0x00, 0x04, 0x2B, 0x00, 0x12, 0x00, 0x80, 
+0x07, 0x17, 0x00, 0x82, 0x04, 0x89, 0x0E, 0x05, 0x02, 0x82, 0x06, 0x15, 0x03, 0x04, 0x01, 0x85, 
+0x8D, 0x00, 0x2B, 0x6E, 0x0B, 0x03, 0x25, 0x01, 0x84, 0x08, 0x20, 0x00, 0x0F, 0x29, 0x62, 0x01, 
+0x84, 0x1F, 0x26, 0x2E, 0xB3, 0x05, 0x25, 0x01, 0x85, 0x03, 0x0B, 0xA9, 0x1A, 0x19, 0xB4, 0x04, 
+0x01, 0x82, 0x03, 0x15, 0x06, 0x04, 0x02, 0x83, 0x09, 0xFF, 0x85, 0x29, 0x90, 0x04, 0x2C, 0x00, 
+0x11, 0x00, 0x80, 0x07, 0x16, 0x00, 0x83, 0x04, 0x00, 0x72, 0x14, 0x06, 0x02, 0x81, 0x06, 0x08, 
+0x04, 0x01, 0x85, 0x11, 0x50, 0x0C, 0xFE, 0x27, 0x05, 0x26, 0x01, 0x85, 0x16, 0x32, 0x0C, 0x39, 
+0x27, 0x05, 0x61, 0x01, 0x84, 0x6E, 0x5A, 0x0C, 0x8D, 0x18, 0x25, 0x01, 0x85, 0x03, 0x05, 0x4D, 
+0x4F, 0x00, 0x28, 0x05, 0x01, 0x80, 0x2F, 0x01, 0x06, 0x03, 0x02, 0x84, 0x0D, 0x2C, 0xAD, 0x12, 
+0x04, 0x2B, 0x00, 0x12, 0x00, 0x80, 0x07, 0x16, 0x00, 0x84, 0x04, 0x52, 0x66, 0x0E, 0x09, 0x03, 
+0x02, 0x81, 0x2A, 0x02, 0x05, 0x01, 0x84, 0xB5, 0xC7, 0x0C, 0x51, 0x03, 0x25, 0x01, 0x85, 0x03, 
+0x0B, 0x23, 0x54, 0x0F, 0x34, 0x62, 0x01, 0x86, 0x0B, 0x21, 0x51, 0x00, 0x5B, 0x16, 0x05, 0x26, 
+0x01, 0x85, 0x16, 0x50, 0x00, 0xE7, 0x8C, 0x08, 0x03, 0x01, 0x82, 0x03, 0x0D, 0x06, 0x04, 0x02, 
+0x82, 0x09, 0x6B, 0x04, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x07, 0x15, 0x00, 0x01, 0x04, 0x83, 0x00, 
+0x4B, 0x09, 0x0D, 0x04, 0x02, 0x82, 0x06, 0x0D, 0x03, 0x03, 0x01, 0x86, 0x08, 0x3D, 0x5A, 0x0C, 
+0xA9, 0x0B, 0x03, 0x25, 0x01, 0x81, 0x2F, 0xC4, 0x01, 0x37, 0x81, 0x9B, 0x08, 0x60, 0x01, 0x87, 
+0x03, 0x01, 0x08, 0xFF, 0x15, 0x95, 0x0F, 0x1A, 0xB8, 0x05, 0x26, 0x01, 0x84, 0x13, 0x3E, 0x0C, 
+0xEF, 0x1C, 0x04, 0x01, 0x80, 0x03, 0x06, 0x02, 0x82, 0x0E, 0x02, 0x84, 0x2C, 0x00, 0x11, 0x00, 
+0x80, 0x07, 0x15, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0x8A, 0x0E, 0x0D, 0x04, 0x02, 0x82, 0x06, 
+0x02, 0x03, 0x03, 0x01, 0x86, 0x05, 0x3C, 0x5A, 0x3F, 0xAB, 0x0B, 0x03, 0x24, 0x01, 0x86, 0x05, 
+0x21, 0x56, 0x0C, 0xBD, 0x16, 0x05, 0x62, 0x01, 0x85, 0x81, 0x1D, 0x79, 0x12, 0x28, 0x13, 0x26, 
+0x01, 0x85, 0x11, 0x28, 0x0C, 0x73, 0x1E, 0x05, 0x03, 0x01, 0x82, 0x03, 0x5E, 0x06, 0x05, 0x02, 
+0x81, 0x14, 0x52, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x07, 0x17, 0x00, 0x82, 0x04, 0x7E, 0xC6, 0x06, 
+0x02, 0x81, 0x0D, 0x03, 0x03, 0x01, 0x81, 0x05, 0x29, 0x01, 0x37, 0x82, 0x3C, 0x0B, 0x03, 0x24, 
+0x01, 0x86, 0x05, 0x2D, 0x63, 0x0C, 0x3E, 0x13, 0x05, 0x62, 0x01, 0x86, 0x05, 0x13, 0x54, 0x00, 
+0x33, 0xBF, 0x05, 0x24, 0x01, 0x86, 0x03, 0x0B, 0x1F, 0x26, 0x59, 0xB8, 0x05, 0x03, 0x01, 0x81, 
+0x03, 0x15, 0x07, 0x02, 0x82, 0x8A, 0x00, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x14, 0x00, 
+0x82, 0x12, 0x00, 0x94, 0x05, 0x02, 0x01, 0x06, 0x80, 0x08, 0x04, 0x01, 0x85, 0x9D, 0x96, 0x0C, 
+0xFF, 0x1D, 0xDF, 0xC8, 0x05, 0x25, 0x01, 0x85, 0x08, 0x29, 0x73, 0x0C, 0xB4, 0x2F, 0x63, 0x01, 
+0x87, 0x05, 0x17, 0x35, 0x00, 0x74, 0x44, 0x05, 0x03, 0x23, 0x01, 0x86, 0x03, 0x57, 0x3C, 0xB9, 
+0x19, 0x29, 0x05, 0x05, 0x01, 0x80, 0x06, 0x05, 0x02, 0x81, 0x14, 0x85, 0x01, 0x04, 0x2A, 0x00, 
+0x13, 0x00, 0x80, 0x07, 0x14, 0x00, 0x83, 0x04, 0x12, 0x99, 0x2C, 0x05, 0x02, 0x80, 0x36, 0x05, 
+0x01, 0x85, 0x17, 0x4A, 0x00, 0x78, 0xB5, 0x05, 0x26, 0x01, 0x84, 0xFF, 0x14, 0x8D, 0x0C, 0x3F, 
+0x70, 0x08, 0x64, 0x01, 0x85, 0x05, 0x28, 0x0F, 0x78, 0x4C, 0x08, 0x25, 0x01, 0x85, 0x05, 0xA5, 
+0x5A, 0x3F, 0x24, 0x08, 0x04, 0x01, 0x82, 0x08, 0x02, 0x06, 0x03, 0x02, 0x84, 0x0D, 0x10, 0x90, 
+0x00, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x13, 0x00, 0x01, 0x04, 0x82, 0x00, 0x83, 0x0E, 
+0x06, 0x02, 0x80, 0x31, 0x04, 0x01, 0x84, 0x17, 0x38, 0x00, 0x32, 0x75, 0x27, 0x01, 0x84, 0xCF, 
+0x0C, 0x48, 0x1E, 0x05, 0x64, 0x01, 0x85, 0x0B, 0x6E, 0x19, 0x0F, 0x43, 0x03, 0x26, 0x01, 0x84, 
+0xA5, 0x74, 0x3F, 0x24, 0x17, 0x05, 0x01, 0x80, 0x06, 0x05, 0x02, 0x82, 0x14, 0x8B, 0x04, 0x2B, 
+0x00, 0x12, 0x00, 0x80, 0x07, 0x14, 0x00, 0x80, 0x04, 0x01, 0x00, 0x81, 0x7D, 0x0E, 0x06, 0x02, 
+0x04, 0x01, 0x85, 0xF1, 0xD8, 0x32, 0x00, 0x4A, 0x17, 0x24, 0x01, 0x86, 0x03, 0x0B, 0x16, 0x34, 
+0x00, 0xFE, 0x17, 0x66, 0x01, 0x84, 0x16, 0x1B, 0x00, 0xF4, 0x05, 0x26, 0x01, 0x85, 0x16, 0x54, 
+0x0C, 0x28, 0x67, 0x08, 0x04, 0x01, 0x81, 0x2A, 0x06, 0x04, 0x02, 0x83, 0x0E, 0x99, 0x00, 0x04, 
+0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x13, 0x00, 0x01, 0x04, 0x82, 0x30, 0x66, 0x10, 0x04, 0x02, 
+0x81, 0x06, 0x02, 0x04, 0x01, 0x85, 0x05, 0x16, 0x38, 0x00, 0x41, 0x08, 0x24, 0x01, 0x85, 0x03, 
+0x0B, 0x16, 0xC7, 0x00, 0x34, 0x66, 0x01, 0x85, 0x0B, 0x17, 0x69, 0x00, 0x8E, 0x16, 0x26, 0x01, 
+0x85, 0x16, 0x32, 0x0C, 0x51, 0x16, 0x08, 0x04, 0x01, 0x06, 0x02, 0x82, 0x09, 0x53, 0x2E, 0x2B, 
+0x00, 0x12, 0x00, 0x80, 0x07, 0x14, 0x00, 0x85, 0x04, 0x00, 0x19, 0xB5, 0x0E, 0x09, 0x03, 0x02, 
+0x81, 0x2A, 0x06, 0x04, 0x01, 0x85, 0x05, 0x2D, 0x48, 0x00, 0x6C, 0x03, 0x25, 0x01, 0x84, 0x05, 
+0x77, 0x59, 0x0C, 0x28, 0x66, 0x01, 0x86, 0x03, 0x0B, 0x42, 0x00, 0x51, 0x16, 0x05, 0x26, 0x01, 
+0x84, 0x69, 0x00, 0x42, 0x44, 0x05, 0x04, 0x01, 0x81, 0x02, 0x06, 0x04, 0x02, 0x82, 0x10, 0x53, 
+0x30, 0x01, 0x00, 0x80, 0x04, 0x28, 0x00, 0x15, 0x00, 0x80, 0x07, 0x11, 0x00, 0x84, 0x04, 0x45, 
+0x40, 0x47, 0x0E, 0x04, 0x02, 0x81, 0x2A, 0x0D, 0x04, 0x01, 0x85, 0x05, 0xC8, 0x1B, 0x00, 0x20, 
+0x05, 0x25, 0x01, 0x85, 0x05, 0x95, 0xCA, 0x3F, 0x25, 0x0B, 0x67, 0x01, 0x84, 0x20, 0x00, 0x79, 
+0x22, 0x05, 0x25, 0x01, 0x85, 0x21, 0x42, 0x00, 0x63, 0x1E, 0x05, 0x04, 0x01, 0x81, 0x15, 0x06, 
+0x04, 0x02, 0x84, 0x0D, 0x02, 0x40, 0x00, 0x04, 0x29, 0x00, 0x14, 0x00, 0x80, 0x07, 0x14, 0x00, 
+0x82, 0x72, 0x46, 0x0E, 0x05, 0x02, 0x80, 0x36, 0x03, 0x01, 0x86, 0x03, 0x05, 0x9A, 0x58, 0x00, 
+0x43, 0x08, 0x25, 0x01, 0x85, 0x05, 0x8D, 0x0F, 0x37, 0x23, 0x08, 0x65, 0x01, 0x86, 0x03, 0x0B, 
+0x9C, 0x0C, 0xA8, 0x70, 0x05, 0x25, 0x01, 0x85, 0x03, 0xFF, 0x19, 0xB6, 0x00, 0x3E, 0x2D, 0x05, 
+0x04, 0x01, 0x81, 0x15, 0x2A, 0x04, 0x02, 0x82, 0x10, 0x47, 0x4B, 0x2B, 0x00, 0x12, 0x00, 0x80, 
+0x07, 0x13, 0x00, 0x01, 0x04, 0x83, 0x00, 0x30, 0x47, 0x09, 0x05, 0x02, 0x80, 0x15, 0x03, 0x01, 
+0x86, 0x03, 0x0B, 0x9A, 0x30, 0x0F, 0x7B, 0x0B, 0x25, 0x01, 0x86, 0x05, 0x1F, 0x58, 0x1A, 0x22, 
+0x0B, 0x11, 0x65, 0x01, 0x81, 0x08, 0xFF, 0x52, 0x84, 0x01, 0x0F, 0x81, 0x3D, 0x05, 0x25, 0x01, 
+0x86, 0x7C, 0x24, 0x0C, 0x54, 0x2D, 0x05, 0x03, 0x03, 0x01, 0x81, 0x08, 0x06, 0x06, 0x02, 0x82, 
+0x6A, 0x00, 0x04, 0x29, 0x00, 0x14, 0x00, 0x80, 0x07, 0x14, 0x00, 0x82, 0x5D, 0x10, 0x0D, 0x05, 
+0x02, 0x80, 0x0D, 0x03, 0x01, 0x86, 0x03, 0x0B, 0xFF, 0xD0, 0x73, 0x0F, 0x04, 0x1D, 0x08, 0x08, 
+0x03, 0x01, 0x01, 0x04, 0x03, 0x16, 0x01, 0x83, 0xEE, 0x0F, 0x59, 0x64, 0x67, 0x01, 0x85, 0x0B, 
+0x29, 0x19, 0x2B, 0x1F, 0x05, 0x14, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x03, 0x05, 0x01, 0x01, 
+0x03, 0x88, 0x01, 0x03, 0x2F, 0xCF, 0x0C, 0xC7, 0x1D, 0x0B, 0x03, 0x03, 0x01, 0x81, 0x15, 0x06, 
+0x04, 0x02, 0x84, 0x0E, 0x46, 0x85, 0x00, 0x04, 0x29, 0x00, 0x14, 0x00, 0x80, 0x07, 0x14, 0x00, 
+0x82, 0x72, 0x02, 0x09, 0x04, 0x02, 0x81, 0x06, 0x15, 0x03, 0x01, 0x86, 0x03, 0x0B, 0x6F, 0x19, 
+0x58, 0x4C, 0xC2, 0x08, 0x0B, 0x01, 0x05, 0x04, 0x0B, 0x81, 0x05, 0x08, 0x13, 0x01, 0x85, 0x05, 
+0x51, 0x0F, 0x74, 0x64, 0x05, 0x66, 0x01, 0x85, 0x08, 0x22, 0x0F, 0x00, 0x23, 0x0B, 0x14, 0x01, 
+0x01, 0x0B, 0x85, 0x81, 0x05, 0x0B, 0x08, 0x0B, 0x05, 0x01, 0x0B, 0x8D, 0x57, 0x5F, 0x0B, 0x05, 
+0x57, 0x05, 0x0B, 0x03, 0x20, 0x00, 0xBD, 0x4D, 0x0B, 0x03, 0x03, 0x01, 0x81, 0x5E, 0x2A, 0x05, 
+0x02, 0x81, 0x76, 0x6D, 0x2B, 0x00, 0x12, 0x00, 0x80, 0x07, 0x14, 0x00, 0x84, 0x04, 0x00, 0x6A, 
+0x02, 0x09, 0x05, 0x02, 0x80, 0x15, 0x03, 0x01, 0x82, 0x03, 0x0B, 0x3D, 0x01, 0x58, 0x94, 0x3A, 
+0x2D, 0x25, 0xA2, 0xAB, 0x43, 0x24, 0xFF, 0x8F, 0x63, 0x20, 0x1E, 0xFF, 0x93, 0x84, 0x3C, 0x62, 
+0x22, 0x24, 0x5C, 0xB8, 0x5C, 0x23, 0x27, 0x03, 0x12, 0x01, 0x84, 0x11, 0x62, 0x0C, 0x59, 0x27, 
+0x67, 0x01, 0x85, 0x0B, 0xC8, 0x65, 0x12, 0x9C, 0x05, 0x13, 0x01, 0x88, 0xBC, 0x1F, 0xC1, 0xB8, 
+0x25, 0x33, 0x3C, 0x28, 0xA7, 0x01, 0x3C, 0x84, 0x3A, 0x4C, 0x35, 0x3C, 0x20, 0x01, 0xA7, 0x86, 
+0x95, 0xFF, 0x58, 0xBE, 0x0C, 0x5B, 0x3D, 0x0B, 0x03, 0x03, 0x01, 0x81, 0x15, 0x06, 0x04, 0x02, 
+0x82, 0x09, 0x02, 0x84, 0x01, 0x04, 0x29, 0x00, 0x14, 0x00, 0x80, 0x07, 0x14, 0x00, 0x82, 0x52, 
+0x47, 0x0E, 0x04, 0x02, 0x81, 0x06, 0x49, 0x03, 0x01, 0x85, 0x03, 0x0B, 0x4C, 0x19, 0x00, 0x4F, 
+0x01, 0x2B, 0x89, 0x5A, 0x4F, 0x48, 0x1B, 0x78, 0x86, 0x1A, 0x37, 0x5A, 0x2B, 0x02, 0x59, 0x01, 
+0x5A, 0x82, 0x73, 0x1C, 0x11, 0x12, 0x01, 0x85, 0x9D, 0x56, 0x0C, 0x4E, 0x16, 0x05, 0x67, 0x01, 
+0x84, 0x22, 0x19, 0x00, 0x23, 0x08, 0x12, 0x01, 0x85, 0x11, 0xD3, 0x3F, 0x37, 0x3F, 0xB9, 0x01, 
+0x3F, 0x91, 0x0C, 0x0F, 0x0C, 0x0F, 0x0C, 0x0F, 0x0C, 0x37, 0x00, 0x37, 0x0C, 0x26, 0x0C, 0x3F, 
+0x33, 0x64, 0x0B, 0x03, 0x03, 0x01, 0x81, 0x49, 0x06, 0x04, 0x02, 0x01, 0x0D, 0x82, 0x72, 0x00, 
+0x04, 0x29, 0x00, 0x14, 0x00, 0x80, 0x07, 0x14, 0x00, 0x82, 0x52, 0x47, 0x09, 0x05, 0x02, 0x80, 
+0x0D, 0x04, 0x01, 0x81, 0x05, 0x29, 0x01, 0x0C, 0x01, 0x3F, 0x92, 0x0F, 0x00, 0x0C, 0x00, 0x04, 
+0x00, 0x0F, 0x0C, 0x0F, 0x00, 0x0F, 0x0C, 0x0F, 0x0C, 0x0F, 0x0C, 0x79, 0x25, 0x11, 0x12, 0x01, 
+0x84, 0x71, 0x28, 0x00, 0x39, 0x21, 0x67, 0x01, 0x85, 0x0B, 0x3D, 0x1A, 0x58, 0x28, 0x05, 0x12, 
+0x01, 0x8E, 0x71, 0xAB, 0xCA, 0xB9, 0x5A, 0x4F, 0xCA, 0x4F, 0x1A, 0x79, 0x2B, 0x86, 0x1A, 0x19, 
+0x59, 0x02, 0x1A, 0x01, 0x5A, 0x85, 0x2B, 0x42, 0x29, 0x2D, 0x0B, 0x03, 0x03, 0x01, 0x81, 0x15, 
+0x06, 0x04, 0x02, 0x83, 0x0E, 0x46, 0x6A, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x15, 0x00, 
+0x82, 0x52, 0x47, 0x09, 0x04, 0x02, 0x81, 0x06, 0x49, 0x03, 0x01, 0x94, 0x03, 0x0B, 0x25, 0x2B, 
+0x26, 0x56, 0x25, 0xC4, 0x1F, 0x20, 0xFF, 0x15, 0x95, 0x25, 0x6C, 0xA4, 0x4C, 0xA9, 0x1F, 0x6C, 
+0x1F, 0x4C, 0x25, 0x01, 0xAB, 0x81, 0xC1, 0x44, 0x13, 0x01, 0x85, 0x08, 0x41, 0x00, 0x54, 0x1E, 
+0x05, 0x66, 0x01, 0x85, 0x2F, 0xA5, 0x79, 0x0C, 0x3D, 0x08, 0x13, 0x01, 0x80, 0x80, 0x01, 0x1D, 
+0x95, 0x1C, 0x23, 0x1C, 0x9A, 0x1D, 0x3D, 0xA3, 0x22, 0x2D, 0x3D, 0x2D, 0xD1, 0x1C, 0x1D, 0x77, 
+0x22, 0x5C, 0x1B, 0x30, 0x1C, 0x0B, 0x03, 0x03, 0x01, 0x81, 0x08, 0x06, 0x05, 0x02, 0x81, 0x09, 
+0x6A, 0x2B, 0x00, 0x12, 0x00, 0x80, 0x07, 0x16, 0x00, 0x81, 0x6A, 0x14, 0x07, 0x02, 0x03, 0x01, 
+0x8D, 0x03, 0x0B, 0x3C, 0x3F, 0x0C, 0x70, 0x57, 0x08, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x02, 
+0x05, 0x81, 0x01, 0x05, 0x19, 0x01, 0x84, 0x11, 0x1F, 0x00, 0x48, 0x60, 0x67, 0x01, 0x85, 0x05, 
+0x23, 0x2B, 0x26, 0x3C, 0x05, 0x14, 0x01, 0x10, 0x05, 0x86, 0x0B, 0x4C, 0x00, 0x2B, 0x1C, 0x05, 
+0x03, 0x03, 0x01, 0x81, 0x15, 0x06, 0x04, 0x02, 0x84, 0x09, 0x0D, 0x85, 0x00, 0x04, 0x29, 0x00, 
+0x14, 0x00, 0x80, 0x07, 0x11, 0x00, 0x01, 0x04, 0x83, 0x00, 0x65, 0x46, 0x09, 0x04, 0x02, 0x81, 
+0x06, 0x15, 0x03, 0x01, 0x87, 0x03, 0x0B, 0x29, 0x2B, 0x0F, 0x28, 0x2F, 0x03, 0x24, 0x01, 0x85, 
+0x05, 0xF4, 0x00, 0x74, 0x1E, 0x0B, 0x67, 0x01, 0x84, 0x9A, 0x26, 0x37, 0x29, 0x05, 0x25, 0x01, 
+0x86, 0x5F, 0x8D, 0x0C, 0x1A, 0x1C, 0x05, 0x03, 0x03, 0x01, 0x81, 0x15, 0x36, 0x05, 0x02, 0x83, 
+0xEC, 0xC5, 0x00, 0x04, 0x29, 0x00, 0x14, 0x00, 0x80, 0x07, 0x11, 0x00, 0x01, 0x04, 0x83, 0x00, 
+0xFF, 0x99, 0xD6, 0x46, 0x09, 0x04, 0x02, 0x81, 0x06, 0x49, 0x03, 0x01, 0x85, 0x03, 0x0B, 0x22, 
+0x26, 0x0C, 0x23, 0x26, 0x01, 0x84, 0x05, 0x3C, 0x00, 0x4F, 0x64, 0x66, 0x01, 0x86, 0x11, 0x08, 
+0x6F, 0x12, 0x1A, 0x25, 0x05, 0x25, 0x01, 0x86, 0x08, 0x96, 0x00, 0x78, 0x1C, 0x05, 0x03, 0x03, 
+0x01, 0x81, 0x15, 0x06, 0x05, 0x02, 0x81, 0x0D, 0x84, 0x02, 0x04, 0x28, 0x00, 0x15, 0x00, 0x80, 
+0x07, 0x10, 0x00, 0x02, 0x04, 0x82, 0xFF, 0x3C, 0xEF, 0x61, 0xFF, 0x86, 0x29, 0x04, 0x02, 0x81, 
+0x06, 0x31, 0x04, 0x01, 0x85, 0x05, 0x43, 0x59, 0x0C, 0x28, 0x2F, 0x25, 0x01, 0x86, 0x05, 0xC0, 
+0x12, 0x19, 0x3D, 0x0B, 0x03, 0x65, 0x01, 0x85, 0x11, 0x6C, 0x00, 0x59, 0x44, 0x05, 0x26, 0x01, 
+0x84, 0x62, 0x00, 0x1B, 0x1E, 0x05, 0x04, 0x01, 0x80, 0x0D, 0x06, 0x02, 0x81, 0x09, 0x40, 0x01, 
+0x00, 0x01, 0x04, 0x27, 0x00, 0x16, 0x00, 0x80, 0x07, 0x10, 0x00, 0x84, 0x04, 0x00, 0x40, 0x87, 
+0x09, 0x05, 0x02, 0x80, 0x0D, 0x04, 0x01, 0x85, 0x05, 0x22, 0x1A, 0x0F, 0x25, 0x11, 0x25, 0x01, 
+0x85, 0x0B, 0x3D, 0x00, 0x0F, 0x23, 0x08, 0x66, 0x01, 0x85, 0x0B, 0x68, 0x00, 0xC7, 0x16, 0x05, 
+0x26, 0x01, 0x84, 0x35, 0x00, 0x39, 0x64, 0x05, 0x04, 0x01, 0x81, 0x0D, 0x2A, 0x04, 0x02, 0x82, 
+0x0E, 0x0D, 0x5D, 0x01, 0x04, 0x29, 0x00, 0x14, 0x00, 0x80, 0x07, 0x13, 0x00, 0x83, 0x45, 0xF2, 
+0x66, 0x0E, 0x04, 0x02, 0x81, 0x06, 0x02, 0x04, 0x01, 0x85, 0x05, 0x1D, 0x3B, 0x0C, 0x24, 0x08, 
+0x25, 0x01, 0x86, 0x05, 0x22, 0x2E, 0x00, 0x20, 0x0B, 0x03, 0x65, 0x01, 0x85, 0x71, 0x56, 0x0C, 
+0xFF, 0x99, 0xC6, 0x4D, 0x08, 0x26, 0x01, 0x84, 0x50, 0x00, 0x6D, 0x27, 0x05, 0x04, 0x01, 0x06, 
+0x02, 0x83, 0x0D, 0x61, 0x2E, 0x00, 0x01, 0x04, 0x28, 0x00, 0x15, 0x00, 0x80, 0x07, 0x13, 0x00, 
+0x82, 0xF8, 0xB2, 0x0E, 0x06, 0x02, 0x04, 0x01, 0x85, 0x05, 0x1E, 0x73, 0x0C, 0x3A, 0x7C, 0x26, 
+0x01, 0x85, 0x1E, 0x39, 0x00, 0x4A, 0x11, 0x08, 0x65, 0x01, 0x84, 0x21, 0x4E, 0x00, 0xC3, 0x17, 
+0x27, 0x01, 0x83, 0x63, 0x00, 0x32, 0x67, 0x05, 0x01, 0x01, 0x06, 0x04, 0x02, 0x83, 0x10, 0x53, 
+0x2E, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x14, 0x00, 0x84, 0x04, 0x00, 0xAD, 0x10, 0x2A, 
+0x03, 0x02, 0x82, 0x06, 0x02, 0x08, 0x04, 0x01, 0x84, 0x18, 0x63, 0x00, 0x34, 0x17, 0x26, 0x01, 
+0x84, 0x75, 0x55, 0x00, 0x8E, 0x13, 0x63, 0x01, 0x87, 0x08, 0x01, 0x0B, 0x1E, 0x4F, 0x0C, 0xB4, 
+0x03, 0x26, 0x01, 0x84, 0x67, 0x5B, 0x00, 0x92, 0x8C, 0x05, 0x01, 0x06, 0x02, 0x82, 0x09, 0x46, 
+0x2E, 0x2B, 0x00, 0x12, 0x00, 0x80, 0x07, 0x17, 0x00, 0x81, 0xAE, 0x0E, 0x05, 0x02, 0x80, 0x06, 
+0x05, 0x01, 0x85, 0x18, 0x3E, 0x0C, 0x51, 0x64, 0x05, 0x25, 0x01, 0x85, 0x21, 0x24, 0x00, 0x78, 
+0x21, 0x05, 0x64, 0x01, 0x85, 0x57, 0x3D, 0x26, 0x19, 0xB4, 0x08, 0x25, 0x01, 0x84, 0x05, 0x16, 
+0x3B, 0x00, 0x68, 0x05, 0x01, 0x82, 0x08, 0x02, 0x06, 0x04, 0x02, 0x83, 0x0E, 0x83, 0x00, 0x04, 
+0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x16, 0x00, 0x80, 0x8B, 0x02, 0x09, 0x04, 0x02, 0x80, 0x31, 
+0x04, 0x01, 0x85, 0x9D, 0x3E, 0x00, 0x63, 0x1E, 0x05, 0x25, 0x01, 0x85, 0x05, 0x28, 0x0F, 0x1A, 
+0x23, 0x0B, 0x63, 0x01, 0x86, 0x03, 0x0B, 0xAB, 0x00, 0x79, 0x1D, 0x05, 0x25, 0x01, 0x85, 0x05, 
+0x1C, 0x5A, 0x00, 0xC0, 0x05, 0x05, 0x01, 0x80, 0x36, 0x05, 0x02, 0x82, 0x0E, 0x87, 0x65, 0x2B, 
+0x00, 0x12, 0x00, 0x80, 0x07, 0x16, 0x00, 0x82, 0x12, 0x88, 0x10, 0x05, 0x02, 0x81, 0x06, 0x2F, 
+0x04, 0x01, 0x85, 0x13, 0xB4, 0x0C, 0x3B, 0x23, 0x05, 0x24, 0x01, 0x86, 0x03, 0x01, 0x16, 0x8E, 
+0x00, 0xAA, 0x18, 0x63, 0x01, 0x86, 0x05, 0x03, 0x25, 0x00, 0x19, 0x1C, 0x05, 0x24, 0x01, 0x86, 
+0x03, 0x0B, 0x29, 0x1B, 0x0F, 0x20, 0x13, 0x05, 0x01, 0x01, 0x06, 0x03, 0x02, 0x84, 0x0D, 0x2C, 
+0x7F, 0x00, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x16, 0x00, 0x82, 0x82, 0x76, 0x0D, 0x04, 
+0x02, 0x82, 0x06, 0x02, 0x03, 0x03, 0x01, 0x86, 0x05, 0x24, 0x0C, 0x48, 0x9B, 0x0B, 0x03, 0x24, 
+0x01, 0x86, 0x05, 0x1E, 0x4C, 0x00, 0x2B, 0x2D, 0x05, 0x63, 0x01, 0x84, 0x7C, 0x69, 0x00, 0x3E, 
+0x44, 0x25, 0x01, 0x86, 0x03, 0x0B, 0x29, 0x48, 0x58, 0x9C, 0x05, 0x03, 0x01, 0x81, 0x03, 0x5E, 
+0x05, 0x02, 0x84, 0x09, 0x02, 0x7F, 0x00, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x15, 0x00, 
+0x82, 0x04, 0x84, 0x2C, 0x05, 0x02, 0x82, 0x06, 0x0D, 0x03, 0x04, 0x01, 0x80, 0x1D, 0x01, 0x3F, 
+0x82, 0x3D, 0x0B, 0x03, 0x25, 0x01, 0x87, 0x21, 0x43, 0x58, 0x0F, 0x6C, 0x08, 0x01, 0x05, 0x5F, 
+0x01, 0x86, 0x03, 0xD7, 0x2D, 0x1B, 0x0C, 0x35, 0xA6, 0x25, 0x01, 0x82, 0x03, 0x0B, 0x1D, 0x01, 
+0x58, 0x80, 0x1D, 0x04, 0x01, 0x82, 0x03, 0x02, 0x06, 0x05, 0x02, 0x83, 0x10, 0x5D, 0x00, 0x04, 
+0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x14, 0x00, 0x85, 0x04, 0x00, 0x72, 0x66, 0x02, 0x09, 0x03, 
+0x02, 0x82, 0x06, 0x02, 0x03, 0x03, 0x01, 0x85, 0x08, 0x23, 0x73, 0x0F, 0x62, 0x08, 0x25, 0x01, 
+0x86, 0x03, 0x05, 0x1C, 0x1B, 0x0C, 0x51, 0x67, 0x62, 0x01, 0x85, 0x57, 0xA7, 0x26, 0x37, 0xAB, 
+0x81, 0x26, 0x01, 0x84, 0x03, 0xCE, 0x04, 0x52, 0x3D, 0x04, 0x01, 0x81, 0x03, 0x0D, 0x05, 0x02, 
+0x82, 0x09, 0x0D, 0x4B, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x07, 0x16, 0x00, 0x83, 0x04, 0x12, 0x4B, 
+0x2C, 0x07, 0x02, 0x04, 0x01, 0x87, 0x5F, 0x8F, 0xCA, 0x00, 0x96, 0x18, 0x05, 0x03, 0x25, 0x01, 
+0x86, 0x75, 0x3A, 0x00, 0x2E, 0x2D, 0x0B, 0x2F, 0x5F, 0x01, 0x86, 0x0B, 0x17, 0x62, 0x00, 0x73, 
+0x44, 0x2F, 0x26, 0x01, 0x84, 0x18, 0x7B, 0x00, 0x1B, 0x75, 0x04, 0x01, 0x80, 0x03, 0x06, 0x02, 
+0x84, 0x0E, 0x47, 0x6D, 0x00, 0x04, 0x2A, 0x00, 0x13, 0x00, 0x80, 0x07, 0x13, 0x00, 0x80, 0x04, 
+0x01, 0x00, 0x82, 0x2E, 0x47, 0x09, 0x05, 0x02, 0x81, 0x2A, 0x08, 0x04, 0x01, 0x86, 0x21, 0x34, 
+0x00, 0x5B, 0x18, 0x0B, 0x03, 0x25, 0x01, 0x84, 0x4D, 0x41, 0x86, 0x37, 0x25, 0x62, 0x01, 0x84, 
+0x4D, 0x1B, 0x0C, 0xFF, 0x96, 0x9D, 0x80, 0x25, 0x01, 0x86, 0x03, 0x05, 0x75, 0x38, 0x00, 0x4A, 
+0x75, 0x04, 0x01, 0x82, 0x08, 0x02, 0x06, 0x03, 0x02, 0x82, 0x0D, 0x10, 0xA0, 0x2D, 0x00, 0x10, 
+0x00, 0x80, 0x07, 0x16, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0x12, 0x89, 0x0E, 0x05, 0x02, 0x82, 
+0x06, 0x15, 0x03, 0x03, 0x01, 0x86, 0x03, 0xC3, 0x00, 0x38, 0x23, 0x0B, 0x03, 0x25, 0x01, 0x85, 
+0x08, 0x3A, 0x4E, 0x00, 0x63, 0x21, 0x60, 0x01, 0x85, 0x05, 0xA9, 0x19, 0x2B, 0xFF, 0x14, 0x8D, 
+0x05, 0x25, 0x01, 0x86, 0x03, 0x0B, 0x95, 0x52, 0x00, 0x68, 0x13, 0x03, 0x01, 0x82, 0x03, 0x15, 
+0x06, 0x05, 0x02, 0x82, 0x2C, 0x7D, 0x19, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x07, 0x16, 0x00, 0x01, 
+0x04, 0x82, 0x00, 0x7E, 0x2C, 0x06, 0x02, 0x81, 0x5E, 0x03, 0x03, 0x01, 0x86, 0x57, 0x8D, 0x00, 
+0x2B, 0x77, 0x0B, 0x03, 0x25, 0x01, 0x86, 0x08, 0x23, 0x9C, 0x0F, 0x79, 0x5C, 0x0B, 0x5D, 0x01, 
+0x87, 0x03, 0x05, 0x21, 0xFF, 0x59, 0xB6, 0x00, 0x38, 0x1D, 0x2F, 0x1F, 0x01, 0x80, 0x03, 0x04, 
+0x01, 0x87, 0x03, 0x0B, 0x9B, 0x2B, 0x0F, 0x20, 0x0B, 0x03, 0x02, 0x01, 0x81, 0x03, 0x15, 0x07, 
+0x02, 0x82, 0xE4, 0x00, 0x0F, 0x2B, 0x00, 0x12, 0x00, 0x80, 0x07, 0x18, 0x00, 0x80, 0x6D, 0x06, 
+0x02, 0x82, 0x06, 0x0D, 0x03, 0x02, 0x01, 0x86, 0x03, 0x05, 0xA5, 0xF5, 0x00, 0x28, 0x01, 0x02, 
+0x03, 0x80, 0x01, 0x01, 0x05, 0x82, 0x0B, 0x11, 0x13, 0x1E, 0x01, 0x84, 0x18, 0x20, 0x86, 0x00, 
+0x4A, 0x5E, 0x01, 0x86, 0x03, 0x81, 0xE5, 0x59, 0x0F, 0x24, 0x9D, 0x1D, 0x01, 0x86, 0x0B, 0x11, 
+0x08, 0x0B, 0x05, 0x08, 0x01, 0x01, 0x03, 0x86, 0x01, 0x05, 0x96, 0x0C, 0x86, 0x2D, 0x05, 0x03, 
+0x01, 0x82, 0x03, 0x15, 0x06, 0x05, 0x02, 0x81, 0x10, 0x6D, 0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 
+0x1A, 0x00, 0x80, 0x85, 0x08, 0x02, 0x04, 0x01, 0x85, 0x5F, 0x77, 0x5B, 0x00, 0x34, 0x13, 0x01, 
+0x05, 0x87, 0x81, 0x05, 0x13, 0x21, 0x25, 0x43, 0x5C, 0x05, 0x1C, 0x01, 0x88, 0x03, 0x11, 0x3D, 
+0xDE, 0x00, 0x78, 0x6E, 0x05, 0x03, 0x5A, 0x01, 0x88, 0x03, 0x0B, 0x21, 0x24, 0x00, 0x48, 0xA5, 
+0x01, 0x03, 0x1D, 0x01, 0x85, 0x29, 0x43, 0x25, 0x18, 0x8C, 0xD7, 0x01, 0x0B, 0x85, 0x05, 0x67, 
+0x32, 0x00, 0x38, 0x2D, 0x05, 0x01, 0x06, 0x02, 0x82, 0x09, 0x61, 0x6A, 0x2D, 0x00, 0x10, 0x00, 
+0x80, 0x07, 0x19, 0x00, 0x83, 0x04, 0x4B, 0x0E, 0x09, 0x06, 0x02, 0x80, 0x08, 0x04, 0x01, 0x8E, 
+0x03, 0x39, 0x00, 0x34, 0x16, 0x71, 0x18, 0x95, 0xB3, 0x23, 0x35, 0x4E, 0xAA, 0xCE, 0x03, 0x1E, 
+0x01, 0x85, 0x60, 0x3D, 0x1A, 0x00, 0x20, 0x0B, 0x5C, 0x01, 0x85, 0x0B, 0xAF, 0xBD, 0x0C, 0x62, 
+0x27, 0x1E, 0x01, 0x8E, 0x13, 0xFF, 0x19, 0xB6, 0x1B, 0x39, 0x69, 0xFF, 0xD4, 0x8C, 0x1F, 0x29, 
+0x18, 0x9D, 0xA5, 0x55, 0x00, 0x5B, 0x5F, 0x04, 0x01, 0x82, 0x08, 0x02, 0x36, 0x04, 0x02, 0x01, 
+0x09, 0x80, 0x65, 0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 0x1A, 0x00, 0x83, 0x2E, 0x61, 0x0E, 0x09, 
+0x03, 0x02, 0x82, 0x36, 0x06, 0x49, 0x03, 0x01, 0x8A, 0x03, 0x01, 0x8D, 0x00, 0x19, 0x9B, 0x9A, 
+0x20, 0x32, 0x39, 0x0F, 0x02, 0x00, 0x81, 0x7B, 0x21, 0x1D, 0x01, 0x88, 0x03, 0x13, 0x6C, 0x38, 
+0x00, 0x73, 0x1E, 0x01, 0x03, 0x59, 0x01, 0x85, 0x0B, 0x21, 0x3A, 0x0C, 0x19, 0x95, 0x1F, 0x01, 
+0x81, 0x8F, 0x35, 0x03, 0x00, 0x88, 0x2E, 0x4E, 0x62, 0xB1, 0x20, 0x26, 0x00, 0x25, 0x08, 0x04, 
+0x01, 0x82, 0x08, 0x06, 0x36, 0x03, 0x02, 0x82, 0x0D, 0x10, 0x93, 0x2E, 0x00, 0x0F, 0x00, 0x80, 
+0x07, 0x1A, 0x00, 0x83, 0x04, 0x00, 0x97, 0x0E, 0x05, 0x02, 0x81, 0x06, 0x0D, 0x04, 0x01, 0x85, 
+0x05, 0x25, 0x30, 0x00, 0x1A, 0x0F, 0x01, 0x00, 0x85, 0x0F, 0x37, 0x38, 0x4A, 0x9C, 0x16, 0x1C, 
+0x01, 0x81, 0x05, 0x08, 0x01, 0x01, 0x86, 0x1C, 0xA7, 0x26, 0x0C, 0xD4, 0x01, 0x05, 0x5A, 0x01, 
+0x84, 0x5C, 0x1B, 0x00, 0x34, 0x44, 0x20, 0x01, 0x85, 0x75, 0x1F, 0xCE, 0x41, 0x86, 0x58, 0x01, 
+0x00, 0x85, 0x0C, 0x4F, 0x00, 0x1A, 0x29, 0x05, 0x04, 0x01, 0x81, 0x5E, 0x06, 0x04, 0x02, 0x85, 
+0x09, 0x14, 0xFF, 0xAF, 0x73, 0x04, 0x00, 0x04, 0x2B, 0x00, 0x12, 0x00, 0x80, 0x07, 0x17, 0x00, 
+0x84, 0x04, 0x00, 0xB7, 0x10, 0x0D, 0x06, 0x02, 0x04, 0x01, 0x8C, 0x08, 0x77, 0x3B, 0x00, 0x0F, 
+0x19, 0x39, 0x92, 0x68, 0x1D, 0x64, 0xA6, 0x05, 0x20, 0x01, 0x87, 0x03, 0x01, 0x1E, 0x56, 0x0C, 
+0x74, 0xB0, 0x05, 0x01, 0x03, 0x56, 0x01, 0x87, 0x05, 0x8F, 0x24, 0x0C, 0x2B, 0xA4, 0x0B, 0x03, 
+0x20, 0x01, 0x8B, 0x05, 0x01, 0x60, 0x64, 0x20, 0x33, 0x63, 0x2B, 0x0C, 0x0F, 0x38, 0x16, 0x05, 
+0x01, 0x01, 0x06, 0x04, 0x02, 0x83, 0xFF, 0x85, 0x29, 0x66, 0x84, 0x00, 0x01, 0x04, 0x2B, 0x00, 
+0x12, 0x00, 0x80, 0x07, 0x19, 0x00, 0x80, 0x6A, 0x01, 0x09, 0x06, 0x02, 0x80, 0x08, 0x04, 0x01, 
+0x86, 0x13, 0x51, 0x00, 0x1A, 0xF7, 0xD8, 0x18, 0x02, 0x01, 0x80, 0x03, 0x23, 0x01, 0x86, 0x1C, 
+0x35, 0xB9, 0x0C, 0x4A, 0x17, 0x0B, 0x56, 0x01, 0x86, 0x05, 0x03, 0x70, 0x48, 0x00, 0xDF, 0xBC, 
+0x25, 0x01, 0x01, 0x08, 0x86, 0x21, 0x80, 0xA7, 0x1A, 0x0C, 0x56, 0x13, 0x04, 0x01, 0x80, 0x03, 
+0x06, 0x02, 0x82, 0x09, 0x89, 0xFF, 0x7D, 0xF7, 0x01, 0x04, 0x2C, 0x00, 0x11, 0x00, 0x80, 0x07, 
+0x18, 0x00, 0x01, 0x04, 0x83, 0x65, 0x61, 0x0E, 0x09, 0x03, 0x02, 0x82, 0x2A, 0x06, 0x15, 0x04, 
+0x01, 0x86, 0x13, 0x4C, 0x00, 0x26, 0x29, 0xC2, 0x05, 0x26, 0x01, 0x89, 0x03, 0x57, 0x23, 0x24, 
+0x0F, 0x1A, 0x23, 0x0B, 0x01, 0x03, 0x54, 0x01, 0x86, 0x05, 0x4D, 0x51, 0x00, 0x3B, 0x3C, 0x05, 
+0x26, 0x01, 0x83, 0x03, 0x01, 0x57, 0x70, 0x01, 0x0C, 0x81, 0x43, 0x11, 0x04, 0x01, 0x82, 0x31, 
+0x06, 0x2A, 0x04, 0x02, 0x82, 0xC6, 0xA0, 0x30, 0x2E, 0x00, 0x0F, 0x00, 0x80, 0x07, 0x1D, 0x00, 
+0x81, 0x83, 0x10, 0x05, 0x02, 0x82, 0x06, 0x02, 0x03, 0x03, 0x01, 0x84, 0x05, 0x43, 0x1B, 0x19, 
+0x50, 0x2A, 0x01, 0x86, 0x64, 0x92, 0x1B, 0x00, 0x38, 0x4D, 0x0B, 0x54, 0x01, 0x86, 0x0B, 0x17, 
+0x4C, 0x26, 0x0C, 0x20, 0x18, 0x29, 0x01, 0x85, 0x13, 0x55, 0x00, 0x54, 0x1D, 0x05, 0x03, 0x01, 
+0x81, 0x03, 0x0D, 0x06, 0x02, 0x83, 0x0D, 0x8B, 0x00, 0x04, 0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 
+0x1C, 0x00, 0x82, 0x7F, 0x10, 0x0D, 0x06, 0x02, 0x05, 0x01, 0x85, 0x18, 0x4E, 0x00, 0x4A, 0x1E, 
+0x08, 0x27, 0x01, 0x88, 0x03, 0x0B, 0x43, 0xB3, 0x26, 0x0F, 0x20, 0x13, 0x05, 0x53, 0x01, 0x85, 
+0x05, 0x1D, 0x74, 0x00, 0x51, 0x3D, 0x29, 0x01, 0x85, 0x05, 0x1D, 0x32, 0x00, 0x69, 0x21, 0x05, 
+0x01, 0x82, 0x0D, 0x06, 0x2A, 0x04, 0x02, 0x82, 0x76, 0x7F, 0x00, 0x01, 0x04, 0x2C, 0x00, 0x11, 
+0x00, 0x80, 0x07, 0x1B, 0x00, 0x81, 0x6D, 0x02, 0x01, 0x09, 0x03, 0x02, 0x82, 0x06, 0x02, 0x15, 
+0x03, 0x01, 0x86, 0x03, 0x5F, 0x28, 0x00, 0x48, 0x70, 0x05, 0x27, 0x01, 0x89, 0x05, 0x11, 0x67, 
+0x23, 0x3E, 0x00, 0x48, 0x9B, 0x03, 0xFF, 0x4A, 0x32, 0x50, 0x01, 0x86, 0x03, 0x81, 0x44, 0x42, 
+0x0C, 0x79, 0x25, 0x01, 0x11, 0x28, 0x01, 0x86, 0x05, 0x43, 0x65, 0x00, 0x1F, 0x01, 0x03, 0x03, 
+0x01, 0x82, 0x31, 0x02, 0x06, 0x04, 0x02, 0x82, 0x10, 0x6B, 0x12, 0x2F, 0x00, 0x0E, 0x00, 0x80, 
+0x07, 0x1D, 0x00, 0x83, 0x04, 0x30, 0x66, 0x0E, 0x05, 0x02, 0x81, 0x06, 0x15, 0x05, 0x01, 0x84, 
+0xDA, 0x19, 0x00, 0xC1, 0x13, 0x28, 0x01, 0x88, 0x03, 0x2F, 0x1C, 0x3C, 0x39, 0x00, 0x38, 0x1E, 
+0x0B, 0x50, 0x01, 0x87, 0x05, 0x13, 0x20, 0x37, 0x0C, 0x96, 0x4D, 0x05, 0x29, 0x01, 0x84, 0x17, 
+0x28, 0x00, 0x59, 0x1E, 0x05, 0x01, 0x80, 0x49, 0x06, 0x02, 0x84, 0x10, 0x7E, 0x04, 0x00, 0x04, 
+0x2D, 0x00, 0x10, 0x00, 0x80, 0x07, 0x1B, 0x00, 0x84, 0x04, 0x00, 0x7D, 0x10, 0x0D, 0x04, 0x02, 
+0x81, 0x06, 0x02, 0x05, 0x01, 0x85, 0xD8, 0x8E, 0x00, 0x5B, 0x16, 0x05, 0x26, 0x01, 0x80, 0x13, 
+0x01, 0x01, 0x87, 0x03, 0x3C, 0x35, 0x37, 0x0C, 0x56, 0x16, 0x08, 0x4F, 0x01, 0x86, 0x5F, 0xFF, 
+0xD4, 0x8C, 0x78, 0x00, 0x3E, 0x77, 0x08, 0x29, 0x01, 0x85, 0x05, 0x27, 0x1B, 0x00, 0x4A, 0x60, 
+0x05, 0x01, 0x06, 0x02, 0x01, 0x0E, 0x82, 0x93, 0x00, 0x04, 0x2E, 0x00, 0x0F, 0x00, 0x80, 0x07, 
+0x1C, 0x00, 0x84, 0x04, 0x00, 0xC5, 0x10, 0x0D, 0x06, 0x02, 0x05, 0x01, 0x85, 0x08, 0x68, 0x12, 
+0xFF, 0x1B, 0xD7, 0x28, 0x08, 0x2A, 0x01, 0x82, 0x18, 0x3D, 0x42, 0x01, 0x0F, 0x82, 0x28, 0x17, 
+0x05, 0x4B, 0x01, 0x88, 0x03, 0x05, 0x01, 0x22, 0x39, 0x00, 0x1B, 0xA5, 0x03, 0x2B, 0x01, 0x80, 
+0x3A, 0x01, 0x19, 0x81, 0x7B, 0x0B, 0x05, 0x01, 0x80, 0x06, 0x05, 0x02, 0x84, 0x09, 0x87, 0x65, 
+0x00, 0x04, 0x2E, 0x00, 0x0F, 0x00, 0x80, 0x07, 0x1B, 0x00, 0x86, 0x04, 0x00, 0x04, 0x4B, 0x02, 
+0x0E, 0x09, 0x03, 0x02, 0x82, 0x2A, 0x02, 0x49, 0x04, 0x01, 0x86, 0x05, 0x3D, 0x1B, 0x04, 0x24, 
+0x18, 0x2F, 0x2A, 0x01, 0x87, 0xFF, 0x6D, 0x63, 0x25, 0x69, 0x0C, 0x2B, 0x4C, 0x17, 0x05, 0x4B, 
+0x01, 0x88, 0x05, 0x1E, 0xC9, 0x00, 0x1B, 0x20, 0x17, 0x01, 0x03, 0x28, 0x01, 0x86, 0x08, 0x4D, 
+0x41, 0x00, 0x39, 0x1C, 0x05, 0x04, 0x01, 0x82, 0x08, 0x06, 0x2A, 0x03, 0x02, 0x82, 0x0D, 0x14, 
+0x99, 0x02, 0x04, 0x2E, 0x00, 0x0F, 0x00, 0x80, 0x07, 0x1D, 0x00, 0x83, 0x12, 0x04, 0x87, 0x0E, 
+0x07, 0x02, 0x80, 0x03, 0x04, 0x01, 0x86, 0xE6, 0x8E, 0x00, 0x55, 0xD1, 0x05, 0x03, 0x2A, 0x01, 
+0x86, 0x18, 0x29, 0x63, 0x00, 0x1B, 0x43, 0x71, 0x4A, 0x01, 0x86, 0x57, 0x1E, 0x51, 0x0C, 0x19, 
+0x35, 0x21, 0x01, 0x01, 0x01, 0x03, 0x13, 0x01, 0x80, 0x03, 0x12, 0x01, 0x86, 0x05, 0x25, 0x3B, 
+0x00, 0x4A, 0x71, 0x03, 0x03, 0x01, 0x82, 0x03, 0x02, 0x06, 0x04, 0x02, 0x84, 0x09, 0x2C, 0x82, 
+0x12, 0x04, 0x2F, 0x00, 0x0E, 0x00, 0x80, 0x07, 0x1E, 0x00, 0x83, 0x04, 0x00, 0x94, 0x10, 0x06, 
+0x02, 0x82, 0x06, 0x15, 0x03, 0x02, 0x01, 0x82, 0x03, 0x11, 0x3C, 0x01, 0x0F, 0x81, 0x29, 0x13, 
+0x12, 0x01, 0x01, 0x05, 0x16, 0x01, 0x88, 0x5F, 0x29, 0x42, 0x59, 0x00, 0x48, 0x29, 0x11, 0x05, 
+0x47, 0x01, 0x87, 0x0B, 0x27, 0x42, 0x00, 0x0F, 0x96, 0x70, 0x08, 0x16, 0x01, 0x01, 0x05, 0x12, 
+0x01, 0x86, 0x21, 0x1F, 0x0C, 0x19, 0x23, 0x01, 0x03, 0x02, 0x01, 0x83, 0x03, 0x31, 0x06, 0x2A, 
+0x03, 0x02, 0x85, 0x0D, 0x2C, 0x97, 0x9F, 0x00, 0x04, 0x2F, 0x00, 0x0E, 0x00, 0x80, 0x07, 0x1D, 
+0x00, 0x01, 0x04, 0x85, 0x00, 0x6D, 0x87, 0x0E, 0x02, 0x09, 0x03, 0x02, 0x82, 0x06, 0x0D, 0x03, 
+0x03, 0x01, 0x86, 0x05, 0x1C, 0xAA, 0x00, 0x34, 0x16, 0x05, 0x0D, 0x01, 0x01, 0x03, 0x83, 0x05, 
+0x01, 0x6E, 0x8F, 0x16, 0x01, 0x89, 0x03, 0x01, 0x6E, 0xDC, 0x48, 0x00, 0x3B, 0x29, 0x13, 0x0B, 
+0x46, 0x01, 0x88, 0x18, 0x51, 0x0F, 0x0C, 0x34, 0xA3, 0x05, 0x03, 0x2F, 0x15, 0x01, 0x83, 0x4D, 
+0x6E, 0x01, 0x05, 0x0F, 0x01, 0x85, 0x05, 0x1E, 0x63, 0x00, 0x3E, 0x1E, 0x04, 0x01, 0x82, 0x03, 
+0x15, 0x06, 0x04, 0x02, 0x01, 0x09, 0x80, 0x91, 0x32, 0x00, 0x0B, 0x00, 0x80, 0x07, 0x22, 0x00, 
+0x83, 0x04, 0x00, 0x94, 0x2C, 0x05, 0x02, 0x81, 0x06, 0x02, 0x04, 0x01, 0x86, 0x03, 0x13, 0x7B, 
+0x00, 0x1A, 0xA5, 0x05, 0x0E, 0x01, 0x85, 0x08, 0x18, 0xC4, 0x24, 0xA2, 0x8F, 0x17, 0x01, 0x87, 
+0x67, 0x95, 0x35, 0x73, 0x00, 0x1B, 0x9B, 0x71, 0x43, 0x01, 0x88, 0x03, 0x81, 0x1C, 0xFF, 0xF8, 
+0xAD, 0x0C, 0x0F, 0x3E, 0xD6, 0x71, 0x16, 0x01, 0x86, 0x05, 0xFF, 0x8E, 0x5B, 0xB3, 0x42, 0xB8, 
+0x27, 0x5F, 0x0E, 0x01, 0x85, 0x11, 0x43, 0x3F, 0x0C, 0x4C, 0x11, 0x05, 0x01, 0x80, 0x0D, 0x05, 
+0x02, 0x84, 0x0D, 0x02, 0x5D, 0x00, 0x04, 0x30, 0x00, 0x0D, 0x00, 0x80, 0x07, 0x22, 0x00, 0x81, 
+0x4B, 0x09, 0x07, 0x02, 0x80, 0x08, 0x04, 0x01, 0x86, 0x05, 0x29, 0x72, 0x04, 0x50, 0x17, 0x05, 
+0x0B, 0x01, 0x89, 0x08, 0x17, 0x6F, 0xD4, 0x55, 0x00, 0x63, 0x70, 0x0B, 0x03, 0x15, 0x01, 0x89, 
+0x03, 0x13, 0x8D, 0x3E, 0x37, 0x00, 0x5A, 0x25, 0x01, 0x0B, 0x3F, 0x01, 0x84, 0x03, 0x05, 0x01, 
+0x27, 0x32, 0x01, 0x0C, 0x81, 0x33, 0x3C, 0x02, 0x01, 0x80, 0x05, 0x15, 0x01, 0x86, 0x23, 0x48, 
+0x00, 0x39, 0x24, 0x25, 0x17, 0x0C, 0x01, 0x86, 0x05, 0x18, 0x55, 0x00, 0x55, 0x1D, 0x08, 0x04, 
+0x01, 0x82, 0x2F, 0x02, 0x06, 0x04, 0x02, 0x82, 0x10, 0x0D, 0x4B, 0x32, 0x00, 0x0B, 0x00, 0x80, 
+0x07, 0x24, 0x00, 0x82, 0x2E, 0x46, 0x09, 0x05, 0x02, 0x81, 0x06, 0x02, 0x05, 0x01, 0x86, 0x13, 
+0x42, 0x00, 0x4B, 0x4C, 0x08, 0x03, 0x07, 0x01, 0x8A, 0x03, 0x05, 0x01, 0x9A, 0x3A, 0x41, 0x19, 
+0x00, 0x37, 0xE1, 0x27, 0x1A, 0x01, 0x88, 0x1C, 0x29, 0x74, 0x00, 0x78, 0x20, 0x27, 0x0B, 0x05, 
+0x3E, 0x01, 0x88, 0x57, 0x1D, 0x38, 0x00, 0x12, 0x42, 0x6E, 0x05, 0x03, 0x18, 0x01, 0x8A, 0x27, 
+0x33, 0x26, 0x00, 0x04, 0x32, 0x96, 0x23, 0x01, 0x05, 0x03, 0x08, 0x01, 0x84, 0x03, 0x33, 0x78, 
+0x12, 0x62, 0x06, 0x01, 0x81, 0x15, 0x06, 0x05, 0x02, 0x84, 0x2C, 0x8B, 0x45, 0x00, 0x04, 0x30, 
+0x00, 0x0D, 0x00, 0x80, 0x07, 0x21, 0x00, 0x01, 0x04, 0x83, 0x6B, 0x76, 0x02, 0x09, 0x04, 0x02, 
+0x80, 0x06, 0x04, 0x01, 0x87, 0x03, 0x0B, 0xB1, 0x65, 0x12, 0x4A, 0x67, 0x08, 0x05, 0x01, 0x86, 
+0x03, 0x05, 0x0B, 0x1C, 0x7B, 0x33, 0x2E, 0x01, 0x00, 0x82, 0x39, 0xA2, 0x21, 0x1B, 0x01, 0x8B, 
+0x67, 0x3C, 0x35, 0x4E, 0x00, 0x45, 0x4A, 0x1C, 0x11, 0x0B, 0x01, 0x03, 0x39, 0x01, 0x89, 0x81, 
+0xA6, 0x43, 0x39, 0x00, 0x12, 0x68, 0x2D, 0x11, 0x03, 0x1A, 0x01, 0x8B, 0x13, 0x1D, 0x32, 0x0F, 
+0x00, 0x30, 0x42, 0x28, 0x1E, 0x05, 0x08, 0x03, 0x05, 0x01, 0x87, 0x05, 0x27, 0x3E, 0x00, 0x39, 
+0x3D, 0x05, 0x03, 0x04, 0x01, 0x01, 0x06, 0x04, 0x02, 0x82, 0x14, 0x6B, 0x52, 0x33, 0x00, 0x0A, 
+0x00, 0x80, 0x07, 0x24, 0x00, 0x83, 0x04, 0x00, 0xFF, 0x38, 0xCE, 0x61, 0x06, 0x02, 0x82, 0x06, 
+0x15, 0x03, 0x04, 0x01, 0x86, 0xE6, 0x32, 0x00, 0x6A, 0x6F, 0x0B, 0x03, 0x03, 0x01, 0x85, 0x2F, 
+0x0B, 0x7C, 0x1F, 0x3A, 0xAA, 0x01, 0x00, 0x82, 0x1A, 0x20, 0x60, 0x1D, 0x01, 0x84, 0x03, 0x05, 
+0x29, 0x56, 0x3B, 0x01, 0x00, 0x82, 0x63, 0x3D, 0x13, 0x01, 0x05, 0x37, 0x01, 0x8C, 0x05, 0x08, 
+0x27, 0x7B, 0x12, 0x00, 0x1A, 0x20, 0x1C, 0x05, 0x03, 0x01, 0x03, 0x1B, 0x01, 0x82, 0x21, 0xB1, 
+0x1B, 0x01, 0x00, 0x86, 0xA8, 0x68, 0x4C, 0x75, 0x0B, 0x01, 0x03, 0x03, 0x01, 0x85, 0x57, 0xD4, 
+0x74, 0x0F, 0xFF, 0xD8, 0xAD, 0x67, 0x05, 0x01, 0x80, 0x15, 0x05, 0x02, 0x01, 0x09, 0x81, 0x93, 
+0x12, 0x33, 0x00, 0x0A, 0x00, 0x80, 0x07, 0x26, 0x00, 0x82, 0x04, 0xFF, 0x6E, 0x73, 0x10, 0x07, 
+0x02, 0x80, 0x08, 0x04, 0x01, 0x86, 0x9D, 0x43, 0x86, 0x0F, 0xC0, 0x75, 0xFD, 0x01, 0x01, 0x80, 
+0x03, 0x01, 0x01, 0x8C, 0xA4, 0x3A, 0x32, 0x04, 0x00, 0x45, 0xD2, 0x1E, 0x11, 0x03, 0x05, 0x71, 
+0x13, 0x1B, 0x01, 0x8B, 0x03, 0x13, 0x16, 0x6E, 0x33, 0x0C, 0x00, 0x5A, 0x1F, 0x21, 0x01, 0x05, 
+0x37, 0x01, 0x88, 0x22, 0xDE, 0x58, 0x00, 0xDE, 0x68, 0x0B, 0x01, 0x03, 0x01, 0x01, 0x80, 0x03, 
+0x1B, 0x01, 0x84, 0x03, 0x11, 0x16, 0x7B, 0x30, 0x01, 0x00, 0x85, 0x38, 0x3A, 0x25, 0x9D, 0x57, 
+0x03, 0x01, 0x01, 0x86, 0x08, 0x6E, 0x42, 0x00, 0x59, 0x1D, 0x03, 0x05, 0x01, 0x01, 0x02, 0x80, 
+0x06, 0x03, 0x02, 0x84, 0x09, 0x10, 0x82, 0x00, 0x04, 0x32, 0x00, 0x0B, 0x00, 0x80, 0x07, 0x24, 
+0x00, 0x83, 0xBB, 0x00, 0xB7, 0x76, 0x07, 0x02, 0x80, 0x15, 0x04, 0x01, 0x98, 0x2F, 0x16, 0x32, 
+0x00, 0xB6, 0xF7, 0x08, 0x8C, 0x57, 0xD7, 0x1D, 0x24, 0x42, 0x30, 0x00, 0x04, 0xB6, 0xDA, 0xFF, 
+0x8B, 0x4A, 0x13, 0x11, 0x01, 0x13, 0x08, 0x05, 0x1D, 0x01, 0x8D, 0x0B, 0x44, 0x1D, 0xC1, 0x52, 
+0x00, 0x0F, 0x55, 0x70, 0x71, 0x08, 0x05, 0x01, 0x03, 0x30, 0x01, 0x89, 0x08, 0x16, 0x7B, 0x1B, 
+0x00, 0x58, 0x4E, 0x2D, 0x21, 0x05, 0x21, 0x01, 0x93, 0x03, 0x08, 0xFF, 0x8B, 0x4A, 0x2D, 0x92, 
+0x58, 0x00, 0x12, 0x50, 0xD4, 0x22, 0x01, 0x05, 0x03, 0x05, 0xB8, 0x48, 0x0F, 0x33, 0x21, 0x05, 
+0x01, 0x82, 0x15, 0x02, 0x06, 0x03, 0x02, 0x01, 0x09, 0x81, 0x47, 0x30, 0x34, 0x00, 0x09, 0x00, 
+0x80, 0x07, 0x28, 0x00, 0x82, 0x4B, 0x87, 0x0E, 0x05, 0x02, 0x01, 0x06, 0x04, 0x01, 0x8B, 0x03, 
+0x13, 0x43, 0x45, 0x00, 0x6C, 0xD8, 0xFF, 0xC7, 0x29, 0x16, 0xB4, 0xD3, 0x1B, 0x01, 0x00, 0x84, 
+0x1B, 0xB1, 0x75, 0x9D, 0x03, 0x24, 0x01, 0x81, 0x03, 0x01, 0x01, 0xB3, 0x8A, 0x41, 0x12, 0x00, 
+0x2B, 0x62, 0x44, 0x01, 0x08, 0x05, 0x01, 0x03, 0x2B, 0x01, 0x84, 0x05, 0x08, 0x18, 0xB1, 0xB6, 
+0x01, 0x00, 0x82, 0x2B, 0x25, 0xAF, 0x01, 0x13, 0x80, 0x03, 0x23, 0x01, 0x84, 0x11, 0x9D, 0xFF, 
+0xCC, 0x52, 0x9A, 0xAA, 0x01, 0x00, 0x8A, 0x2E, 0x35, 0xB8, 0x16, 0x0B, 0x6E, 0x35, 0x0C, 0x59, 
+0x5C, 0x03, 0x05, 0x01, 0x01, 0x02, 0x80, 0x06, 0x03, 0x02, 0x82, 0x09, 0x0E, 0xB7, 0x35, 0x00, 
+0x08, 0x00, 0x80, 0x07, 0x28, 0x00, 0x83, 0x04, 0x00, 0xB7, 0x14, 0x05, 0x02, 0x82, 0x06, 0x02, 
+0x49, 0x05, 0x01, 0x87, 0x64, 0x51, 0x00, 0x4B, 0xFF, 0x31, 0x84, 0x6F, 0xD4, 0x5B, 0x01, 0x00, 
+0x84, 0x4F, 0x7B, 0x16, 0x11, 0x03, 0x27, 0x01, 0x8B, 0x11, 0x13, 0x2D, 0x34, 0x62, 0x39, 0x00, 
+0x0C, 0x3B, 0x1F, 0x80, 0x03, 0x01, 0x05, 0x28, 0x01, 0x8B, 0x03, 0x05, 0x01, 0x67, 0x1D, 0x42, 
+0x19, 0x00, 0x0F, 0x41, 0x6C, 0x27, 0x28, 0x01, 0x85, 0x03, 0xA6, 0x11, 0xFF, 0x0D, 0x5B, 0x4C, 
+0x5A, 0x01, 0x00, 0x87, 0x54, 0x24, 0x3C, 0x25, 0x2B, 0x0C, 0x3A, 0x18, 0x05, 0x01, 0x82, 0x49, 
+0x02, 0x06, 0x03, 0x02, 0x83, 0x09, 0x0E, 0x89, 0x12, 0x35, 0x00, 0x08, 0x00, 0x80, 0x07, 0x28, 
+0x00, 0x84, 0x04, 0x00, 0x4B, 0x0D, 0x09, 0x07, 0x02, 0x80, 0x03, 0x04, 0x01, 0x8B, 0x11, 0x23, 
+0x0F, 0x00, 0xB6, 0x55, 0x12, 0x00, 0x26, 0x56, 0x1C, 0x13, 0x2D, 0x01, 0x81, 0x18, 0x25, 0x01, 
+0x56, 0x88, 0x1A, 0x00, 0x0F, 0x3B, 0x25, 0x16, 0x13, 0x0B, 0x05, 0x21, 0x01, 0x8F, 0x08, 0x01, 
+0x03, 0x01, 0x05, 0x11, 0x17, 0x3D, 0x42, 0x78, 0x00, 0x0C, 0xA8, 0x7B, 0x23, 0x17, 0x2D, 0x01, 
+0x8A, 0x11, 0x1E, 0x33, 0x19, 0x00, 0x04, 0x39, 0x1B, 0x00, 0x1B, 0x5C, 0x05, 0x01, 0x80, 0x03, 
+0x07, 0x02, 0x81, 0x0E, 0x85, 0x36, 0x00, 0x07, 0x00, 0x80, 0x07, 0x2C, 0x00, 0x81, 0xB2, 0x10, 
+0x05, 0x02, 0x82, 0x06, 0x02, 0x31, 0x05, 0x01, 0x81, 0x60, 0x33, 0x02, 0x00, 0x83, 0x0F, 0x5B, 
+0xAF, 0x17, 0x30, 0x01, 0x8E, 0x05, 0xA5, 0x62, 0x34, 0x41, 0xF5, 0x00, 0x0C, 0xE7, 0x28, 0x70, 
+0x17, 0x0B, 0x01, 0x05, 0x1C, 0x01, 0x01, 0x03, 0x8E, 0x01, 0x08, 0x05, 0x0B, 0x27, 0xA7, 0x50, 
+0x1A, 0x00, 0x0C, 0x1A, 0x9C, 0xB1, 0xF0, 0x05, 0x2E, 0x01, 0x8A, 0x03, 0x01, 0x17, 0x70, 0x32, 
+0x45, 0x00, 0x04, 0x00, 0x1F, 0x17, 0x05, 0x01, 0x82, 0x08, 0x02, 0x06, 0x04, 0x02, 0x82, 0x0E, 
+0x53, 0x4B, 0x36, 0x00, 0x07, 0x00, 0x80, 0x07, 0x2C, 0x00, 0x83, 0x85, 0x46, 0x0E, 0x09, 0x04, 
+0x02, 0x82, 0x06, 0x02, 0x03, 0x05, 0x01, 0x86, 0x22, 0x78, 0x00, 0x12, 0x7B, 0x17, 0x11, 0x34, 
+0x01, 0x84, 0x22, 0x62, 0x28, 0x41, 0x0F, 0x01, 0x00, 0x88, 0x48, 0x56, 0xA7, 0x4D, 0x75, 0x05, 
+0x0B, 0x01, 0x05, 0x15, 0x01, 0x80, 0x03, 0x01, 0x01, 0x80, 0x08, 0x01, 0x0B, 0x8B, 0x17, 0x70, 
+0x28, 0x38, 0x26, 0x00, 0x0C, 0x59, 0x7B, 0x23, 0x18, 0x08, 0x33, 0x01, 0x86, 0x11, 0x8C, 0x68, 
+0x58, 0x04, 0xDE, 0x6E, 0x05, 0x01, 0x82, 0x03, 0x5E, 0x06, 0x05, 0x02, 0x82, 0x14, 0x89, 0x40, 
+0x36, 0x00, 0x07, 0x00, 0x80, 0x07, 0x2B, 0x00, 0x84, 0x04, 0x00, 0x6B, 0x10, 0x0D, 0x05, 0x02, 
+0x81, 0x2A, 0x15, 0x05, 0x01, 0x85, 0x21, 0x6C, 0x00, 0x12, 0xD9, 0x13, 0x36, 0x01, 0x85, 0x17, 
+0x1D, 0x1F, 0x95, 0x56, 0x26, 0x01, 0x00, 0x87, 0x19, 0x3B, 0x4A, 0xB1, 0x2D, 0x21, 0x13, 0x08, 
+0x02, 0x05, 0x06, 0x01, 0x02, 0x03, 0x82, 0x13, 0x01, 0x03, 0x02, 0x01, 0x88, 0x05, 0x08, 0x05, 
+0x08, 0x71, 0x27, 0x3D, 0x20, 0x4E, 0x01, 0x3F, 0x01, 0x0C, 0x86, 0x5B, 0x28, 0x25, 0x77, 0x0B, 
+0x08, 0x03, 0x34, 0x01, 0x85, 0x80, 0x68, 0x00, 0xFF, 0x7E, 0xF7, 0x43, 0x13, 0x05, 0x01, 0x81, 
+0x15, 0x06, 0x04, 0x02, 0x85, 0x0D, 0x10, 0x47, 0x98, 0x00, 0x04, 0x35, 0x00, 0x08, 0x00, 0x80, 
+0x07, 0x2A, 0x00, 0x84, 0x04, 0x00, 0x84, 0x0D, 0xF9, 0x05, 0x02, 0x01, 0x06, 0x06, 0x01, 0x84, 
+0x2D, 0x39, 0x00, 0x8E, 0x1C, 0x28, 0x01, 0x86, 0x03, 0x20, 0x2E, 0x04, 0x2E, 0x20, 0x03, 0x07, 
+0x01, 0x82, 0x05, 0x17, 0x5C, 0x01, 0x77, 0x82, 0x3B, 0x5B, 0x30, 0x01, 0x00, 0x94, 0x45, 0x52, 
+0xB6, 0xC0, 0xB1, 0x2D, 0x64, 0x67, 0x9D, 0x03, 0x08, 0x01, 0x0B, 0x01, 0x0B, 0x11, 0xC2, 0x2F, 
+0xC2, 0x05, 0x0B, 0x01, 0x01, 0x92, 0x03, 0x18, 0x44, 0x95, 0x1F, 0xE1, 0x73, 0x26, 0x0C, 0x00, 
+0x0C, 0xBD, 0x63, 0x1F, 0x16, 0x27, 0x03, 0x05, 0x03, 0x36, 0x01, 0x84, 0xA7, 0x48, 0x00, 0xD2, 
+0x60, 0x06, 0x01, 0x81, 0x02, 0x06, 0x04, 0x02, 0x83, 0x09, 0x10, 0x83, 0x45, 0x37, 0x00, 0x06, 
+0x00, 0x80, 0x07, 0x2E, 0x00, 0x82, 0x12, 0xA1, 0xF9, 0x06, 0x02, 0x82, 0x06, 0x15, 0x03, 0x04, 
+0x01, 0x85, 0x17, 0xF6, 0x58, 0x04, 0xC0, 0x18, 0x27, 0x01, 0x80, 0x50, 0x04, 0x00, 0x80, 0x50, 
+0x0B, 0x01, 0x82, 0x80, 0x3C, 0x35, 0x01, 0x3A, 0x82, 0x1B, 0x19, 0x04, 0x01, 0x00, 0xA5, 0x86, 
+0x1A, 0x3B, 0x51, 0x62, 0x6C, 0x4C, 0x3D, 0x23, 0xFF, 0xD0, 0x73, 0x22, 0x64, 0x1C, 0x2D, 0xFF, 
+0x11, 0x7C, 0x23, 0x4C, 0x20, 0xDF, 0xC3, 0x63, 0x5A, 0xB9, 0x3F, 0x00, 0x0C, 0x0F, 0x1B, 0x38, 
+0xDF, 0x24, 0xAF, 0x18, 0x11, 0x01, 0x16, 0x1F, 0x39, 0x01, 0x00, 0x05, 0x01, 0x86, 0x03, 0x20, 
+0x2E, 0x04, 0x2E, 0x20, 0x03, 0x03, 0x01, 0x86, 0x03, 0x20, 0x2E, 0x04, 0x2E, 0x20, 0x03, 0x1B, 
+0x01, 0x85, 0x1C, 0x50, 0x00, 0x1B, 0x77, 0x11, 0x04, 0x01, 0x82, 0x03, 0x15, 0x06, 0x05, 0x02, 
+0x84, 0x14, 0x66, 0x85, 0x00, 0x04, 0x36, 0x00, 0x07, 0x00, 0x80, 0x07, 0x2E, 0x00, 0x81, 0x30, 
+0x87, 0x06, 0x02, 0x82, 0x06, 0x02, 0x08, 0x05, 0x01, 0x84, 0x44, 0x92, 0x00, 0x1B, 0xB1, 0x26, 
+0x01, 0x88, 0x22, 0x00, 0x12, 0x22, 0x11, 0x22, 0x12, 0x00, 0x5C, 0x0B, 0x01, 0x8A, 0x05, 0x11, 
+0x1C, 0x3D, 0x2D, 0x39, 0x68, 0x41, 0x30, 0x65, 0x0F, 0x03, 0x00, 0x81, 0x37, 0x19, 0x01, 0x79, 
+0x01, 0x1A, 0x80, 0x86, 0x01, 0x19, 0x80, 0xED, 0x01, 0x0C, 0x80, 0x00, 0x02, 0x0C, 0x89, 0xB9, 
+0x5A, 0x1A, 0x35, 0x1F, 0x25, 0x1D, 0x44, 0xFF, 0x09, 0x2A, 0x0B, 0x02, 0x01, 0x04, 0x00, 0x05, 
+0x01, 0x80, 0x50, 0x04, 0x00, 0x80, 0x50, 0x03, 0x01, 0x80, 0x50, 0x04, 0x00, 0x80, 0x50, 0x1A, 
+0x01, 0x85, 0x13, 0x62, 0x0F, 0x12, 0x1F, 0x21, 0x05, 0x01, 0x82, 0x2F, 0xDB, 0x06, 0x04, 0x02, 
+0x82, 0x0E, 0x09, 0x7D, 0x39, 0x00, 0x04, 0x00, 0x80, 0x07, 0x30, 0x00, 0x84, 0x04, 0xBB, 0x99, 
+0xEC, 0x09, 0x05, 0x02, 0x82, 0x06, 0x15, 0x03, 0x04, 0x01, 0x85, 0x11, 0x22, 0x1B, 0x00, 0x41, 
+0x2D, 0x25, 0x01, 0x82, 0x34, 0x00, 0x1F, 0x02, 0x01, 0x82, 0x1F, 0x00, 0x34, 0x0D, 0x01, 0x84, 
+0x05, 0x08, 0x11, 0x16, 0x43, 0x01, 0x22, 0x94, 0x92, 0x4C, 0x35, 0x55, 0x63, 0xFF, 0x1B, 0xD7, 
+0x1B, 0x26, 0x4F, 0x0C, 0x26, 0x0C, 0x12, 0x04, 0x19, 0x0C, 0x2B, 0x5A, 0x39, 0x51, 0xEF, 0x01, 
+0x35, 0x82, 0x1C, 0x3C, 0x22, 0x01, 0x01, 0x82, 0x05, 0x01, 0x03, 0x03, 0x01, 0x82, 0x1B, 0x20, 
+0x16, 0x01, 0x00, 0x04, 0x01, 0x88, 0x22, 0x00, 0x12, 0x22, 0x11, 0x22, 0x12, 0x00, 0x5C, 0x01, 
+0x01, 0x88, 0x22, 0x00, 0x12, 0x22, 0x11, 0x22, 0x12, 0x00, 0x5C, 0x19, 0x01, 0x84, 0xA4, 0x3B, 
+0x00, 0x32, 0x44, 0x05, 0x01, 0x82, 0x03, 0x15, 0x06, 0x05, 0x02, 0x84, 0x14, 0x6B, 0x6D, 0x00, 
+0x04, 0x37, 0x00, 0x06, 0x00, 0x80, 0x07, 0x30, 0x00, 0x82, 0x52, 0x87, 0x09, 0x05, 0x02, 0x82, 
+0x36, 0x02, 0x49, 0x05, 0x01, 0x85, 0x17, 0x6F, 0x19, 0x0F, 0xD2, 0x13, 0x24, 0x01, 0x82, 0x40, 
+0x00, 0x4D, 0x02, 0x01, 0x82, 0x4D, 0x00, 0x1B, 0x0E, 0x01, 0x01, 0x03, 0x81, 0x01, 0x05, 0x02, 
+0x01, 0x01, 0x64, 0x85, 0x20, 0x1C, 0x4A, 0x29, 0x43, 0x25, 0x01, 0x28, 0x88, 0x29, 0xC0, 0x9A, 
+0xF6, 0x3A, 0x6C, 0x28, 0x2D, 0x25, 0x01, 0x2D, 0x80, 0xA6, 0x03, 0x01, 0x01, 0x03, 0x08, 0x01, 
+0x01, 0x00, 0x04, 0x01, 0x82, 0x34, 0x00, 0x1F, 0x02, 0x01, 0x82, 0x1F, 0x00, 0x34, 0x01, 0x01, 
+0x82, 0x34, 0x00, 0x1F, 0x02, 0x01, 0x82, 0x1F, 0x00, 0x34, 0x18, 0x01, 0x85, 0x16, 0x55, 0x00, 
+0x1B, 0x3D, 0x13, 0x05, 0x01, 0x80, 0x31, 0x01, 0x06, 0x04, 0x02, 0x84, 0x10, 0x0D, 0x94, 0x00, 
+0x04, 0x38, 0x00, 0x05, 0x00, 0x80, 0x07, 0x2F, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0x8B, 0x0E, 
+0x09, 0x05, 0x02, 0x82, 0x2A, 0x02, 0x03, 0x05, 0x01, 0x84, 0x60, 0xE0, 0x04, 0x1B, 0x3C, 0x24, 
+0x01, 0x82, 0x12, 0x00, 0x13, 0x02, 0x01, 0x82, 0x13, 0x00, 0x12, 0x14, 0x01, 0x81, 0x03, 0x01, 
+0x01, 0x05, 0x84, 0x01, 0x5F, 0x11, 0x08, 0x75, 0x01, 0x18, 0x8B, 0x80, 0x18, 0x11, 0x75, 0x11, 
+0x13, 0x0B, 0x01, 0x05, 0x08, 0x01, 0x03, 0x0E, 0x01, 0x01, 0x00, 0x04, 0x01, 0x82, 0x40, 0x00, 
+0x4D, 0x02, 0x01, 0x82, 0x4D, 0x00, 0x1B, 0x01, 0x01, 0x82, 0x40, 0x00, 0x4D, 0x02, 0x01, 0x82, 
+0x4D, 0x00, 0x1B, 0x18, 0x01, 0x84, 0x35, 0x12, 0x30, 0xC0, 0x21, 0x05, 0x01, 0x82, 0x03, 0x0D, 
+0x06, 0x05, 0x02, 0x82, 0x10, 0xAD, 0x65, 0x3A, 0x00, 0x03, 0x00, 0x80, 0x07, 0x32, 0x00, 0x01, 
+0xBB, 0x83, 0x04, 0x87, 0x10, 0x0D, 0x05, 0x02, 0x81, 0x06, 0x15, 0x05, 0x01, 0x86, 0x11, 0x22, 
+0xAA, 0x00, 0x39, 0x2D, 0x11, 0x22, 0x01, 0x01, 0x00, 0x04, 0x01, 0x81, 0x00, 0x04, 0x17, 0x01, 
+0x04, 0x03, 0x05, 0x01, 0x05, 0x03, 0x11, 0x01, 0x01, 0x00, 0x04, 0x01, 0x82, 0x12, 0x00, 0x13, 
+0x02, 0x01, 0x82, 0x13, 0x00, 0x12, 0x01, 0x01, 0x82, 0x12, 0x00, 0x13, 0x02, 0x01, 0x82, 0x13, 
+0x00, 0x12, 0x16, 0x01, 0x85, 0x17, 0xA4, 0x1A, 0x04, 0x41, 0x21, 0x06, 0x01, 0x81, 0x15, 0x06, 
+0x04, 0x02, 0x85, 0x0D, 0x14, 0x61, 0xAE, 0x00, 0x04, 0x39, 0x00, 0x04, 0x00, 0x80, 0x07, 0x34, 
+0x00, 0x81, 0x8B, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x80, 0x08, 0x05, 0x01, 0x85, 0xA6, 0xEE, 0x1B, 
+0x00, 0x50, 0x16, 0x22, 0x01, 0x82, 0x12, 0x00, 0x13, 0x02, 0x01, 0x82, 0x13, 0x00, 0x12, 0x3A, 
+0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x00, 0x04, 0x01, 0x81, 0x00, 0x04, 0x01, 0x01, 0x01, 0x00, 
+0x04, 0x01, 0x81, 0x00, 0x04, 0x15, 0x01, 0x85, 0x13, 0x1D, 0x1B, 0x00, 0x6A, 0x22, 0x06, 0x01, 
+0x80, 0x08, 0x01, 0x06, 0x04, 0x02, 0x83, 0x09, 0x0E, 0x99, 0x04, 0x3B, 0x00, 0x02, 0x00, 0x80, 
+0x07, 0x33, 0x00, 0x01, 0x04, 0x83, 0x00, 0xF8, 0x6B, 0x14, 0x06, 0x02, 0x81, 0x06, 0xFF, 0xE7, 
+0x31, 0x05, 0x01, 0x86, 0x08, 0x13, 0xE4, 0x04, 0x0F, 0x8D, 0x27, 0x21, 0x01, 0x82, 0x40, 0x00, 
+0x4D, 0x02, 0x01, 0x82, 0x4D, 0x00, 0x1B, 0x3A, 0x01, 0x01, 0x00, 0x04, 0x01, 0x82, 0x12, 0x00, 
+0x13, 0x02, 0x01, 0x82, 0x13, 0x00, 0x12, 0x01, 0x01, 0x82, 0x12, 0x00, 0x13, 0x02, 0x01, 0x82, 
+0x13, 0x00, 0x12, 0x15, 0x01, 0x84, 0x77, 0x3E, 0x00, 0x2E, 0x6F, 0x06, 0x01, 0x82, 0x08, 0xDB, 
+0x06, 0x05, 0x02, 0x82, 0x14, 0x87, 0x5D, 0x3C, 0x00, 0x01, 0x00, 0x80, 0x07, 0x38, 0x00, 0x82, 
+0x72, 0x66, 0x0E, 0x05, 0x02, 0x83, 0x06, 0x36, 0x0D, 0x03, 0x05, 0x01, 0x85, 0xFF, 0x8F, 0x6B, 
+0x92, 0x00, 0x19, 0x25, 0x13, 0x20, 0x01, 0x82, 0x34, 0x00, 0x1F, 0x02, 0x01, 0x82, 0x1F, 0x00, 
+0x34, 0x3A, 0x01, 0x01, 0x00, 0x04, 0x01, 0x82, 0x40, 0x00, 0x4D, 0x02, 0x01, 0x82, 0x4D, 0x00, 
+0x1B, 0x01, 0x01, 0x82, 0x40, 0x00, 0x4D, 0x02, 0x01, 0x82, 0x4D, 0x00, 0x1B, 0x07, 0x01, 0x81, 
+0x03, 0x13, 0x0A, 0x01, 0x85, 0xBF, 0xDF, 0x00, 0x26, 0x8D, 0x18, 0x05, 0x01, 0x83, 0x03, 0x0D, 
+0x02, 0x06, 0x04, 0x02, 0x84, 0x10, 0x02, 0x88, 0x00, 0x04, 0x3B, 0x00, 0x02, 0x00, 0x80, 0x07, 
+0x37, 0x00, 0x83, 0x12, 0x88, 0x14, 0x09, 0x07, 0x02, 0x80, 0x08, 0x06, 0x01, 0x84, 0x3D, 0x3B, 
+0x00, 0xAA, 0x29, 0x09, 0x01, 0x82, 0x6E, 0x1D, 0x27, 0x13, 0x01, 0x88, 0x22, 0x00, 0x12, 0x5C, 
+0x03, 0x5C, 0x12, 0x00, 0x22, 0x3A, 0x01, 0x01, 0x00, 0x04, 0x01, 0x82, 0x34, 0x00, 0x1F, 0x02, 
+0x01, 0x82, 0x1F, 0x00, 0x34, 0x01, 0x01, 0x82, 0x34, 0x00, 0x1F, 0x02, 0x01, 0x82, 0x1F, 0x00, 
+0x34, 0x07, 0x01, 0x82, 0xA2, 0x1F, 0xFF, 0xD0, 0x6B, 0x09, 0x01, 0x84, 0x24, 0x30, 0x0F, 0x33, 
+0x64, 0x06, 0x01, 0x82, 0x31, 0x02, 0x06, 0x05, 0x02, 0x84, 0x14, 0x97, 0x52, 0x00, 0x04, 0x3B, 
+0x00, 0x02, 0x00, 0x80, 0x07, 0x36, 0x00, 0x84, 0x04, 0x00, 0x58, 0x83, 0x09, 0x06, 0x02, 0x81, 
+0x06, 0x36, 0x06, 0x01, 0x85, 0xD0, 0x9B, 0x1A, 0x00, 0x38, 0x1E, 0x07, 0x01, 0x83, 0x1E, 0x35, 
+0x1A, 0x24, 0x14, 0x01, 0x80, 0x8E, 0x04, 0x00, 0x80, 0x5D, 0x3B, 0x01, 0x01, 0x00, 0x04, 0x01, 
+0x88, 0x22, 0x00, 0x12, 0x5C, 0x03, 0x5C, 0x12, 0x00, 0x22, 0x01, 0x01, 0x88, 0x22, 0x00, 0x12, 
+0x5C, 0x03, 0x5C, 0x12, 0x00, 0x22, 0x06, 0x01, 0x85, 0x27, 0x69, 0x0F, 0x4A, 0x44, 0x08, 0x05, 
+0x01, 0x86, 0x13, 0xA4, 0x1B, 0x00, 0x38, 0xB5, 0x11, 0x06, 0x01, 0x01, 0x02, 0x80, 0x06, 0x03, 
+0x02, 0x85, 0x0D, 0x14, 0x46, 0x8B, 0x00, 0x04, 0x3C, 0x00, 0x01, 0x00, 0x80, 0x07, 0x3A, 0x00, 
+0x82, 0x85, 0x09, 0x14, 0x07, 0x02, 0x81, 0x15, 0x03, 0x05, 0x01, 0x85, 0x17, 0x28, 0x1A, 0x00, 
+0x55, 0x44, 0x05, 0x01, 0x81, 0x18, 0x55, 0x01, 0x00, 0x81, 0x68, 0x7C, 0x13, 0x01, 0x86, 0x03, 
+0x20, 0x1A, 0x04, 0x1A, 0x20, 0x03, 0x38, 0x01, 0x07, 0x00, 0x02, 0x01, 0x80, 0x8E, 0x04, 0x00, 
+0x80, 0x5D, 0x03, 0x01, 0x80, 0x8E, 0x04, 0x00, 0x80, 0x5D, 0x07, 0x01, 0x81, 0x7C, 0x41, 0x01, 
+0x00, 0x81, 0x54, 0x27, 0x04, 0x01, 0x86, 0x13, 0x1D, 0xCA, 0x00, 0x38, 0x1D, 0x9D, 0x05, 0x01, 
+0x83, 0x03, 0x15, 0x02, 0x06, 0x04, 0x02, 0x83, 0x09, 0x10, 0x7A, 0x45, 0x3E, 0x00, 0x80, 0x07, 
+0x3A, 0x00, 0x84, 0x04, 0x12, 0x04, 0xFF, 0xF3, 0xA4, 0x09, 0x06, 0x02, 0x82, 0x06, 0x36, 0x15, 
+0x06, 0x01, 0x85, 0x03, 0x34, 0x37, 0x00, 0x24, 0x4D, 0x03, 0x01, 0x85, 0x6E, 0x51, 0x0F, 0x3F, 
+0x3A, 0x18, 0x54, 0x01, 0x07, 0x00, 0x02, 0x01, 0x86, 0x03, 0x20, 0x1A, 0x04, 0x1A, 0x20, 0x03, 
+0x03, 0x01, 0x86, 0x03, 0x20, 0x1A, 0x04, 0x1A, 0x20, 0x03, 0x07, 0x01, 0x87, 0x08, 0xBC, 0x24, 
+0x26, 0x0F, 0x41, 0x2D, 0x03, 0x02, 0x01, 0x84, 0x23, 0x54, 0x00, 0x74, 0x3C, 0x07, 0x01, 0x83, 
+0x49, 0xDB, 0x02, 0x06, 0x03, 0x02, 0x85, 0x0D, 0x14, 0x53, 0x84, 0x00, 0x04, 0x3D, 0x00, 0x81, 
+0x00, 0x07, 0x3A, 0x00, 0x84, 0x04, 0x00, 0x65, 0x89, 0x10, 0x07, 0x02, 0x81, 0x06, 0x08, 0x06, 
+0x01, 0x85, 0xB0, 0x33, 0x00, 0x04, 0x24, 0x17, 0x01, 0x01, 0x85, 0x1E, 0x4A, 0x00, 0x26, 0xD3, 
+0x44, 0x7C, 0x01, 0x8D, 0x1E, 0x41, 0x04, 0x00, 0x42, 0x1E, 0x08, 0x01, 0x77, 0x3E, 0x00, 0x19, 
+0x3C, 0x21, 0x06, 0x01, 0x80, 0x08, 0x01, 0x02, 0x80, 0x06, 0x04, 0x02, 0x01, 0x0E, 0x82, 0xA1, 
+0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3B, 0x00, 0x01, 0x04, 0x84, 0x00, 0x85, 0x47, 0x09, 0x0D, 
+0x04, 0x02, 0x01, 0x06, 0x80, 0x02, 0x07, 0x01, 0x8B, 0x1C, 0x55, 0x00, 0x1A, 0x24, 0x2F, 0x16, 
+0x55, 0x00, 0x26, 0x56, 0x27, 0x15, 0x01, 0x80, 0x03, 0x4D, 0x01, 0x83, 0x03, 0x27, 0xBC, 0x13, 
+0x15, 0x01, 0x8B, 0x27, 0x34, 0x0C, 0x00, 0x3E, 0xFF, 0x8E, 0x5B, 0xBF, 0xBD, 0x0C, 0x86, 0x4C, 
+0x21, 0x07, 0x01, 0x81, 0x0D, 0x06, 0x05, 0x02, 0x01, 0x09, 0x83, 0x7D, 0x4B, 0x00, 0x04, 0x3E, 
+0x00, 0x80, 0x07, 0x3E, 0x00, 0x83, 0x04, 0x88, 0x76, 0x10, 0x07, 0x02, 0x80, 0x0D, 0x06, 0x01, 
+0x86, 0x11, 0x44, 0x5B, 0x00, 0x12, 0x62, 0x32, 0x01, 0x12, 0x81, 0xB4, 0xFF, 0x8E, 0x5B, 0x16, 
+0x01, 0x83, 0x5C, 0xDF, 0xE5, 0x13, 0x4A, 0x01, 0x83, 0xFF, 0x10, 0x6C, 0x63, 0xFF, 0x9B, 0xC6, 
+0x1C, 0x16, 0x01, 0x81, 0x64, 0x62, 0x01, 0x12, 0x85, 0xFF, 0x99, 0xC6, 0x54, 0x00, 0x1A, 0xFF, 
+0x97, 0xA5, 0x11, 0x07, 0x01, 0x80, 0x0D, 0x01, 0x06, 0x04, 0x02, 0x85, 0x09, 0x0E, 0x93, 0x65, 
+0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3D, 0x00, 0x02, 0x04, 0x82, 0x40, 0x82, 0x0D, 0x07, 0x02, 
+0x81, 0x06, 0x0D, 0x07, 0x01, 0x87, 0x23, 0x55, 0x00, 0x0F, 0x0C, 0x26, 0x56, 0x44, 0x16, 0x01, 
+0x84, 0x17, 0x35, 0x0C, 0xCA, 0xBF, 0x4A, 0x01, 0x83, 0xFF, 0x10, 0x6C, 0x4F, 0x3F, 0xB8, 0x17, 
+0x01, 0x83, 0x44, 0x50, 0x26, 0x00, 0x01, 0x0C, 0x81, 0x20, 0x27, 0x07, 0x01, 0x01, 0x02, 0x80, 
+0x06, 0x04, 0x02, 0x01, 0x09, 0x81, 0x61, 0x2E, 0x3E, 0x00, 0x80, 0x07, 0x02, 0x00, 0x3B, 0x00, 
+0x80, 0x07, 0x04, 0x00, 0x82, 0x40, 0x87, 0x2C, 0x06, 0x02, 0x83, 0x2A, 0x02, 0x5E, 0x03, 0x05, 
+0x01, 0x86, 0x03, 0x23, 0x48, 0x0C, 0x00, 0x3B, 0x1E, 0x17, 0x01, 0x84, 0x3D, 0x2B, 0x0C, 0x35, 
+0x8F, 0x4A, 0x01, 0x84, 0x27, 0xFF, 0x9A, 0xBE, 0x0C, 0x5A, 0xAF, 0x17, 0x01, 0x85, 0xF7, 0x79, 
+0x00, 0x4F, 0xD3, 0x16, 0x06, 0x01, 0x82, 0x03, 0x5E, 0x06, 0x06, 0x02, 0x82, 0x09, 0x0E, 0xAE, 
+0x3E, 0x00, 0x80, 0x07, 0x03, 0x00, 0x3A, 0x00, 0x80, 0x07, 0x06, 0x00, 0x82, 0x6A, 0x46, 0x10, 
+0x05, 0x02, 0x01, 0x06, 0x81, 0x02, 0x2F, 0x06, 0x01, 0x86, 0x7C, 0x70, 0x48, 0x00, 0x0C, 0x4C, 
+0x27, 0x15, 0x01, 0x84, 0x18, 0x42, 0x00, 0x74, 0x5C, 0x1B, 0x01, 0x84, 0xFF, 0xE8, 0x59, 0xFA, 
+0xBE, 0xBA, 0x9E, 0x03, 0x01, 0x82, 0xBE, 0xBA, 0xFF, 0x29, 0x4A, 0x23, 0x01, 0x85, 0x0B, 0x1C, 
+0x73, 0xDD, 0x33, 0xA6, 0x15, 0x01, 0x85, 0x1D, 0x8E, 0x00, 0x19, 0x33, 0x13, 0x07, 0x01, 0x82, 
+0x2F, 0x2A, 0x06, 0x05, 0x02, 0x82, 0x09, 0x0E, 0x6B, 0x3E, 0x00, 0x80, 0x07, 0x04, 0x00, 0x39, 
+0x00, 0x80, 0x07, 0x05, 0x00, 0x86, 0x04, 0x00, 0x12, 0x90, 0x0D, 0x0E, 0x0D, 0x06, 0x02, 0x81, 
+0xDB, 0x08, 0x06, 0x01, 0x86, 0x08, 0x29, 0x38, 0x00, 0x2B, 0x34, 0x7C, 0x13, 0x01, 0x81, 0x03, 
+0x4C, 0x01, 0x00, 0x81, 0x9C, 0x17, 0x19, 0x01, 0x81, 0x9E, 0xCB, 0x03, 0x0A, 0x81, 0xCC, 0xBA, 
+0x02, 0x01, 0x80, 0xFF, 0x00, 0xF0, 0x01, 0x0A, 0x80, 0xE8, 0x23, 0x01, 0x85, 0x13, 0xFF, 0xF8, 
+0xAD, 0x0C, 0xCA, 0x25, 0x71, 0x12, 0x01, 0x86, 0x17, 0x1D, 0x4E, 0x00, 0x37, 0x6C, 0x16, 0x07, 
+0x01, 0x82, 0x08, 0xFF, 0xA7, 0x31, 0x06, 0x06, 0x02, 0x82, 0x10, 0x61, 0x6A, 0x3E, 0x00, 0x80, 
+0x07, 0x04, 0x00, 0x39, 0x00, 0x80, 0x07, 0x09, 0x00, 0x81, 0x7E, 0x09, 0x06, 0x02, 0x83, 0x06, 
+0x2A, 0x06, 0x08, 0x06, 0x01, 0x86, 0x13, 0x1C, 0x3B, 0x00, 0x12, 0x28, 0x1E, 0x12, 0x01, 0x84, 
+0x64, 0x32, 0x00, 0xFF, 0x39, 0xCE, 0xE6, 0x19, 0x01, 0x81, 0x9E, 0xFF, 0x82, 0xD0, 0x06, 0x0A, 
+0x82, 0xBA, 0x01, 0xE9, 0x02, 0x0A, 0x80, 0xFA, 0x24, 0x01, 0x84, 0x6E, 0x54, 0x0C, 0x3E, 0x80, 
+0x12, 0x01, 0x85, 0x25, 0x3B, 0x00, 0x2B, 0x24, 0x18, 0x07, 0x01, 0x81, 0x08, 0x06, 0x06, 0x02, 
+0x83, 0x0D, 0x2C, 0x7A, 0xFF, 0xBA, 0xDE, 0x3E, 0x00, 0x80, 0x07, 0x05, 0x00, 0x38, 0x00, 0x80, 
+0x07, 0x08, 0x00, 0x84, 0x04, 0x00, 0x52, 0x6B, 0xC6, 0x06, 0x02, 0x01, 0x06, 0x81, 0x02, 0x08, 
+0x07, 0x01, 0x86, 0x1C, 0x50, 0x00, 0x0C, 0x35, 0x44, 0x03, 0x0F, 0x01, 0x85, 0x17, 0x68, 0x0F, 
+0x00, 0x6F, 0x03, 0x19, 0x01, 0x80, 0xBE, 0x07, 0x0A, 0x82, 0xCC, 0x9E, 0xBA, 0x02, 0x0A, 0x80, 
+0xFF, 0xC7, 0x69, 0x25, 0x01, 0x84, 0x20, 0x0F, 0x19, 0x4C, 0x11, 0x0F, 0x01, 0x86, 0x17, 0x1F, 
+0x3B, 0x00, 0x2B, 0x8D, 0x7C, 0x06, 0x01, 0x81, 0x03, 0x08, 0x08, 0x02, 0x83, 0x0E, 0x02, 0x9F, 
+0x04, 0x3E, 0x00, 0x80, 0x07, 0x05, 0x00, 0x38, 0x00, 0x80, 0x07, 0x09, 0x00, 0x85, 0x04, 0x00, 
+0x6A, 0xAD, 0x0E, 0x09, 0x08, 0x02, 0x80, 0x08, 0x07, 0x01, 0x85, 0x1C, 0x56, 0x00, 0x0F, 0x5B, 
+0x1D, 0x0F, 0x01, 0x84, 0x1D, 0x74, 0x0C, 0x4A, 0x8C, 0x1A, 0x01, 0x80, 0xEA, 0x08, 0x0A, 0x81, 
+0xBA, 0xAC, 0x02, 0x0A, 0x80, 0x61, 0x25, 0x01, 0x84, 0x1E, 0x4E, 0x00, 0x3B, 0xFF, 0x8F, 0x63, 
+0x0E, 0x01, 0x86, 0x16, 0x1F, 0x0C, 0x00, 0x2B, 0x43, 0x17, 0x07, 0x01, 0x82, 0x31, 0x02, 0x06, 
+0x06, 0x02, 0x85, 0x10, 0x2C, 0x88, 0x45, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x04, 0x00, 0x39, 
+0x00, 0x80, 0x07, 0x0A, 0x00, 0x83, 0x04, 0xC5, 0x10, 0x0E, 0x06, 0x02, 0x01, 0x06, 0x81, 0x02, 
+0x08, 0x07, 0x01, 0x86, 0x80, 0x3E, 0x0F, 0x00, 0x38, 0x29, 0x13, 0x0C, 0x01, 0x86, 0x13, 0xDF, 
+0x0C, 0x4F, 0x1D, 0xFF, 0xA7, 0x21, 0x05, 0x19, 0x01, 0x03, 0x0A, 0x81, 0xFF, 0xA3, 0xC0, 0xD5, 
+0x03, 0x0A, 0x81, 0xBE, 0xCB, 0x01, 0x0A, 0x80, 0xFF, 0x21, 0xE8, 0x27, 0x01, 0x83, 0x3D, 0x86, 
+0x0F, 0x20, 0x0C, 0x01, 0x86, 0x03, 0xFF, 0xCF, 0x63, 0x3E, 0x26, 0x00, 0x63, 0x25, 0x08, 0x01, 
+0x83, 0x08, 0x02, 0xDB, 0x06, 0x04, 0x02, 0x84, 0x0D, 0x14, 0xFF, 0x29, 0x4A, 0x90, 0x30, 0x3E, 
+0x00, 0x80, 0x07, 0x07, 0x00, 0x36, 0x00, 0x80, 0x07, 0x0C, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 
+0x6A, 0x66, 0x14, 0x09, 0x02, 0x80, 0x08, 0x07, 0x01, 0x86, 0x16, 0xC4, 0x3F, 0x00, 0x4F, 0x25, 
+0x18, 0x0B, 0x01, 0x84, 0x70, 0x26, 0x0C, 0x24, 0x17, 0x1B, 0x01, 0x03, 0x0A, 0x81, 0xAC, 0x01, 
+0x03, 0x0A, 0x81, 0xAC, 0xFF, 0x41, 0xE0, 0x01, 0x0A, 0x80, 0xFF, 0xA2, 0xC0, 0x27, 0x01, 0x84, 
+0x18, 0x51, 0x00, 0x79, 0xDC, 0x0A, 0x01, 0x87, 0x11, 0xA2, 0x3E, 0x0C, 0x26, 0x54, 0x1E, 0x13, 
+0x07, 0x01, 0x83, 0x08, 0x06, 0x02, 0x2A, 0x06, 0x02, 0x82, 0x14, 0x88, 0x30, 0x3E, 0x00, 0x80, 
+0x07, 0x08, 0x00, 0x35, 0x00, 0x80, 0x07, 0x0E, 0x00, 0x80, 0x04, 0x01, 0x00, 0x83, 0x7D, 0x61, 
+0x09, 0x0D, 0x05, 0x02, 0x80, 0x06, 0x01, 0x02, 0x80, 0x08, 0x07, 0x01, 0x86, 0x05, 0x4C, 0x54, 
+0x0C, 0x2B, 0x56, 0xD6, 0x09, 0x01, 0x84, 0x18, 0x34, 0x0C, 0x3B, 0x1E, 0x1C, 0x01, 0x03, 0x0A, 
+0x81, 0xAC, 0x01, 0x03, 0x0A, 0x80, 0xE8, 0x02, 0x0A, 0x80, 0xE8, 0x27, 0x01, 0x85, 0x08, 0xFF, 
+0xAF, 0x73, 0x1B, 0x0C, 0xF4, 0x13, 0x07, 0x01, 0x87, 0x5F, 0x27, 0xA7, 0x59, 0x0C, 0x3F, 0x24, 
+0xB0, 0x08, 0x01, 0x82, 0x08, 0x02, 0x06, 0x07, 0x02, 0x84, 0x2C, 0x53, 0x5D, 0x00, 0x04, 0x3E, 
+0x00, 0x80, 0x07, 0x07, 0x00, 0x36, 0x00, 0x80, 0x07, 0x0D, 0x00, 0x80, 0x04, 0x02, 0x00, 0x83, 
+0x90, 0x2C, 0x10, 0x0D, 0x05, 0x02, 0x01, 0x06, 0x81, 0x36, 0x08, 0x07, 0x01, 0x87, 0x7C, 0xAF, 
+0x54, 0x0F, 0x0C, 0x3E, 0x29, 0x13, 0x06, 0x01, 0x85, 0x11, 0x28, 0x0C, 0x0F, 0x24, 0x7C, 0x1C, 
+0x01, 0x03, 0x0A, 0x81, 0xAC, 0x01, 0x03, 0x0A, 0x80, 0xFF, 0xA2, 0xC0, 0x02, 0x0A, 0x80, 0xFF, 
+0x86, 0x81, 0x28, 0x01, 0x85, 0x13, 0x34, 0x00, 0x79, 0x3C, 0x11, 0x05, 0x01, 0x88, 0x13, 0x2D, 
+0x41, 0x4F, 0x00, 0xE7, 0xFF, 0x55, 0x95, 0x21, 0x08, 0x06, 0x01, 0x81, 0x03, 0x08, 0x01, 0x06, 
+0x06, 0x02, 0x83, 0x0E, 0x09, 0x6B, 0x7F, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x08, 0x00, 0x35, 
+0x00, 0x80, 0x07, 0x10, 0x00, 0x01, 0x04, 0x83, 0x52, 0x88, 0x0D, 0x14, 0x08, 0x02, 0x82, 0x06, 
+0x08, 0x03, 0x06, 0x01, 0x87, 0x05, 0x77, 0x35, 0x26, 0x0C, 0x4F, 0x1F, 0x27, 0x05, 0x01, 0x84, 
+0x64, 0x38, 0x0C, 0x41, 0x75, 0x1D, 0x01, 0x03, 0x0A, 0x81, 0xE8, 0x9E, 0x03, 0x0A, 0x80, 0xFF, 
+0x41, 0xE8, 0x02, 0x0A, 0x80, 0xFF, 0xE8, 0x59, 0x29, 0x01, 0x84, 0xD6, 0x38, 0x00, 0x55, 0x18, 
+0x04, 0x01, 0x87, 0x13, 0x4C, 0x63, 0x0C, 0x37, 0xFF, 0xBB, 0xC6, 0xA2, 0x13, 0x07, 0x01, 0x83, 
+0x03, 0x31, 0x2A, 0x06, 0x07, 0x02, 0x82, 0x10, 0x47, 0x72, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 
+0x80, 0x07, 0x08, 0x00, 0x35, 0x00, 0x80, 0x07, 0x13, 0x00, 0x83, 0x65, 0x7F, 0x10, 0x09, 0x06, 
+0x02, 0x84, 0x36, 0x06, 0x02, 0x08, 0x03, 0x07, 0x01, 0x88, 0x18, 0x28, 0x54, 0x00, 0x4F, 0x32, 
+0x3D, 0x11, 0x08, 0x01, 0x01, 0x84, 0x17, 0x33, 0x00, 0x0F, 0x3C, 0x1E, 0x01, 0x80, 0xCC, 0x02, 
+0x0A, 0x81, 0xFF, 0x21, 0xE8, 0xEB, 0x07, 0x0A, 0x80, 0x08, 0x2A, 0x01, 0x84, 0x1F, 0x0C, 0x26, 
+0xB3, 0x03, 0x01, 0x01, 0x88, 0x11, 0x5C, 0x33, 0x19, 0x0C, 0xB9, 0x24, 0x44, 0x05, 0x07, 0x01, 
+0x83, 0x03, 0x08, 0x02, 0x36, 0x07, 0x02, 0x82, 0x14, 0xB2, 0x90, 0x3E, 0x00, 0x80, 0x07, 0x0C, 
+0x00, 0x31, 0x00, 0x80, 0x07, 0x15, 0x00, 0x84, 0x04, 0x12, 0x00, 0x30, 0x93, 0x01, 0x0E, 0x06, 
+0x02, 0x01, 0x06, 0x81, 0x02, 0x5E, 0x08, 0x01, 0x8E, 0x13, 0x1C, 0x54, 0x26, 0x00, 0x3B, 0x20, 
+0x60, 0x01, 0xC2, 0x22, 0x2E, 0x58, 0xCE, 0x75, 0x1E, 0x01, 0x80, 0xEB, 0x08, 0x0A, 0x80, 0xCC, 
+0x01, 0x0A, 0x80, 0xEA, 0x2B, 0x01, 0x8D, 0x44, 0x38, 0x00, 0x3B, 0x64, 0x5F, 0x18, 0xAB, 0x73, 
+0x04, 0x0C, 0x63, 0xFF, 0x14, 0x8D, 0x8F, 0x09, 0x01, 0x80, 0x5E, 0x01, 0x02, 0x80, 0x36, 0x06, 
+0x02, 0x82, 0x0E, 0x46, 0x40, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x0B, 0x00, 0x32, 0x00, 0x80, 
+0x07, 0x19, 0x00, 0x83, 0x7A, 0x09, 0x10, 0x09, 0x06, 0x02, 0x01, 0x06, 0x80, 0x0D, 0x08, 0x01, 
+0x8C, 0x05, 0x44, 0x1F, 0x2B, 0x00, 0x58, 0xFF, 0x19, 0xC6, 0xFF, 0x31, 0x84, 0xFF, 0x6E, 0x6B, 
+0x4A, 0x00, 0x1A, 0xDA, 0x1F, 0x01, 0x80, 0xD5, 0x07, 0x0A, 0x81, 0xCB, 0xCC, 0x01, 0x0A, 0x80, 
+0xEB, 0x2B, 0x01, 0x8B, 0x03, 0x23, 0x2B, 0x0F, 0xA9, 0x29, 0x51, 0x4F, 0x00, 0x5A, 0x42, 0x5C, 
+0x0A, 0x01, 0x01, 0x02, 0x80, 0x2A, 0x06, 0x02, 0x83, 0x0D, 0x2C, 0x89, 0x8B, 0x01, 0x00, 0x80, 
+0x04, 0x3E, 0x00, 0x80, 0x07, 0x0B, 0x00, 0x32, 0x00, 0x80, 0x07, 0x19, 0x00, 0x83, 0x72, 0x83, 
+0x46, 0x09, 0x07, 0x02, 0x01, 0x06, 0x80, 0x0D, 0x09, 0x01, 0x8A, 0x13, 0x9B, 0x42, 0x0F, 0x00, 
+0xFF, 0x3D, 0xEF, 0xB6, 0xFF, 0x9F, 0xF7, 0x0F, 0xCE, 0x21, 0x20, 0x01, 0x80, 0xFF, 0x66, 0x81, 
+0x05, 0x0A, 0x81, 0xFB, 0xE9, 0x02, 0x0A, 0x80, 0xBE, 0x2C, 0x01, 0x89, 0x18, 0xC3, 0x0C, 0x4F, 
+0x48, 0x00, 0x3F, 0x4E, 0x43, 0x21, 0x09, 0x01, 0x82, 0x08, 0x0D, 0x06, 0x07, 0x02, 0x83, 0x0E, 
+0x10, 0x53, 0x5D, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x0C, 0x00, 0x31, 0x00, 0x80, 
+0x07, 0x19, 0x00, 0x80, 0x04, 0x01, 0x00, 0x84, 0x7F, 0x46, 0x14, 0x02, 0x0D, 0x04, 0x02, 0x02, 
+0x06, 0x80, 0x0D, 0x09, 0x01, 0x88, 0x11, 0x60, 0x7B, 0xA8, 0x04, 0x00, 0x0F, 0x39, 0x64, 0x22, 
+0x01, 0x87, 0xD5, 0xCB, 0xFC, 0x0A, 0xEA, 0xBE, 0x9E, 0xFF, 0xC7, 0x69, 0x02, 0x0A, 0x80, 0xFF, 
+0xA7, 0x71, 0x2D, 0x01, 0x87, 0x1D, 0x74, 0x37, 0x0F, 0x5A, 0xC4, 0x6E, 0x11, 0x0A, 0x01, 0x09, 
+0x02, 0x01, 0x0E, 0x83, 0x83, 0x72, 0x12, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x0C, 0x00, 
+0x31, 0x00, 0x80, 0x07, 0x1A, 0x00, 0x02, 0x04, 0x83, 0x7D, 0x47, 0x76, 0x0E, 0x06, 0x02, 0x01, 
+0x06, 0x82, 0x02, 0x15, 0x03, 0x08, 0x01, 0x86, 0x17, 0x1C, 0x4A, 0x38, 0x28, 0x25, 0x13, 0x29, 
+0x01, 0x80, 0xBE, 0x02, 0x0A, 0x86, 0xFF, 0x29, 0x52, 0x01, 0xFF, 0xE8, 0x59, 0xFA, 0xBE, 0xBA, 
+0x9E, 0x27, 0x01, 0x85, 0x7C, 0x23, 0xA4, 0x20, 0x23, 0x13, 0x09, 0x01, 0x81, 0x03, 0x0D, 0x09, 
+0x02, 0x84, 0x09, 0x14, 0x66, 0x9F, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x0E, 0x00, 0x2F, 
+0x00, 0x80, 0x07, 0x1F, 0x00, 0x84, 0x30, 0x8A, 0x7A, 0x09, 0x0D, 0x09, 0x02, 0x80, 0x0D, 0x0A, 
+0x01, 0x82, 0x27, 0x44, 0x8F, 0x2B, 0x01, 0x80, 0xFF, 0xE3, 0xB0, 0x01, 0x0A, 0x82, 0xFC, 0x9E, 
+0xCB, 0x03, 0x0A, 0x81, 0xCC, 0xBA, 0x28, 0x01, 0x82, 0x13, 0x11, 0x03, 0x09, 0x01, 0x82, 0x08, 
+0x0D, 0x09, 0x08, 0x02, 0x85, 0x09, 0x10, 0x7A, 0xC5, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x10, 
+0x00, 0x2D, 0x00, 0x80, 0x07, 0x20, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0xC5, 0x46, 0xC6, 0x07, 
+0x02, 0x80, 0x06, 0x02, 0x02, 0x81, 0x15, 0x03, 0x36, 0x01, 0x80, 0xFB, 0x01, 0x0A, 0x81, 0xFB, 
+0xFF, 0x82, 0xD0, 0x06, 0x0A, 0x80, 0xBA, 0x33, 0x01, 0x83, 0x15, 0x06, 0x02, 0x06, 0x07, 0x02, 
+0x83, 0x09, 0xFF, 0x85, 0x29, 0x6B, 0x2E, 0x01, 0x00, 0x81, 0x04, 0x00, 0x01, 0x04, 0x3E, 0x00, 
+0x80, 0x07, 0x0D, 0x00, 0x30, 0x00, 0x80, 0x07, 0x1F, 0x00, 0x01, 0x04, 0x81, 0x5D, 0x7A, 0x01, 
+0x14, 0x06, 0x02, 0x01, 0x06, 0x01, 0x02, 0x81, 0x49, 0x03, 0x35, 0x01, 0x80, 0xFF, 0x00, 0xF0, 
+0x0A, 0x0A, 0x81, 0xCC, 0x9E, 0x30, 0x01, 0x81, 0x03, 0x15, 0x09, 0x02, 0x84, 0x0D, 0x2C, 0x47, 
+0x94, 0x40, 0x3E, 0x00, 0x80, 0x07, 0x14, 0x00, 0x29, 0x00, 0x80, 0x07, 0x28, 0x00, 0x83, 0x04, 
+0x2E, 0x7F, 0x61, 0x01, 0x09, 0x06, 0x02, 0x80, 0x06, 0x01, 0x02, 0x82, 0x0D, 0x01, 0x03, 0x32, 
+0x01, 0x80, 0xE9, 0x0C, 0x0A, 0x80, 0xBA, 0x2E, 0x01, 0x83, 0x03, 0x08, 0x02, 0x06, 0x08, 0x02, 
+0x83, 0x0E, 0x10, 0x61, 0x85, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x13, 0x00, 0x2A, 
+0x00, 0x80, 0x07, 0x29, 0x00, 0x82, 0x45, 0xA0, 0x2C, 0x02, 0x09, 0x06, 0x02, 0x01, 0x06, 0x83, 
+0x02, 0x31, 0x01, 0x03, 0x30, 0x01, 0x80, 0xBA, 0x06, 0x0A, 0x81, 0xFF, 0xA3, 0xC0, 0xD5, 0x03, 
+0x0A, 0x80, 0xBE, 0x2C, 0x01, 0x85, 0x03, 0x01, 0x49, 0x06, 0x02, 0x06, 0x07, 0x02, 0x86, 0x09, 
+0x0E, 0x6B, 0x9F, 0x30, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x14, 0x00, 0x29, 0x00, 0x80, 0x07, 
+0x2B, 0x00, 0x83, 0x04, 0xAE, 0x61, 0x10, 0x01, 0x09, 0x06, 0x02, 0x02, 0x06, 0x82, 0x02, 0x15, 
+0x03, 0x2F, 0x01, 0x80, 0xAC, 0x06, 0x0A, 0x81, 0xAC, 0x01, 0x03, 0x0A, 0x80, 0xAC, 0x2B, 0x01, 
+0x81, 0x03, 0x0D, 0x02, 0x06, 0x08, 0x02, 0x83, 0x09, 0x76, 0xAD, 0x7F, 0x3E, 0x00, 0x80, 0x07, 
+0x18, 0x00, 0x25, 0x00, 0x80, 0x07, 0x31, 0x00, 0x83, 0x45, 0x88, 0x02, 0x0E, 0x08, 0x02, 0x02, 
+0x06, 0x82, 0x15, 0x08, 0x03, 0x2D, 0x01, 0x80, 0xCB, 0x01, 0x0A, 0x80, 0xFF, 0x41, 0xE0, 0x03, 
+0x0A, 0x81, 0xAC, 0x01, 0x03, 0x0A, 0x80, 0xAC, 0x29, 0x01, 0x82, 0x03, 0x49, 0x0D, 0x01, 0x06, 
+0x07, 0x02, 0x85, 0x0D, 0x09, 0x2C, 0x53, 0x91, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x19, 0x00, 0x24, 
+0x00, 0x80, 0x07, 0x34, 0x00, 0x84, 0x40, 0x89, 0x14, 0x09, 0x0D, 0x07, 0x02, 0x02, 0x06, 0x80, 
+0x15, 0x2D, 0x01, 0x80, 0xFF, 0x41, 0xE0, 0x01, 0x0A, 0x80, 0xFF, 0xA3, 0xC0, 0x03, 0x0A, 0x81, 
+0xAC, 0x01, 0x03, 0x0A, 0x80, 0xAC, 0x28, 0x01, 0x82, 0x08, 0x5E, 0x06, 0x09, 0x02, 0x85, 0x09, 
+0x0E, 0x09, 0x97, 0x6D, 0x12, 0x3E, 0x00, 0x80, 0x07, 0x1A, 0x00, 0x23, 0x00, 0x80, 0x07, 0x36, 
+0x00, 0x83, 0x7E, 0x66, 0x10, 0x14, 0x09, 0x02, 0x01, 0x06, 0x83, 0x02, 0x31, 0x01, 0x03, 0x28, 
+0x01, 0x80, 0x9E, 0x02, 0x0A, 0x80, 0xFF, 0x24, 0xA1, 0x03, 0x0A, 0x81, 0xE8, 0x9E, 0x03, 0x0A, 
+0x80, 0xAC, 0x25, 0x01, 0x85, 0x03, 0x01, 0x5E, 0x06, 0x02, 0x06, 0x09, 0x02, 0x83, 0x09, 0x0E, 
+0xB7, 0x40, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x19, 0x00, 0x24, 0x00, 0x80, 0x07, 
+0x36, 0x00, 0x84, 0x85, 0x7A, 0x46, 0x14, 0x10, 0x08, 0x02, 0x02, 0x06, 0x81, 0x0D, 0x15, 0x28, 
+0x01, 0x80, 0xD5, 0x02, 0x0A, 0x81, 0xFF, 0x86, 0x79, 0xCC, 0x02, 0x0A, 0x81, 0xFF, 0x21, 0xE8, 
+0xEB, 0x03, 0x0A, 0x80, 0xFA, 0x24, 0x01, 0x80, 0x08, 0x01, 0x02, 0x81, 0x2A, 0x36, 0x09, 0x02, 
+0x83, 0x0D, 0x2C, 0x53, 0x7E, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x1B, 0x00, 0x22, 
+0x00, 0x80, 0x07, 0x36, 0x00, 0x01, 0x04, 0x87, 0x00, 0x45, 0x8B, 0x97, 0x02, 0x14, 0x09, 0x0D, 
+0x07, 0x02, 0x81, 0x06, 0x36, 0x01, 0x02, 0x80, 0x31, 0x26, 0x01, 0x80, 0xFF, 0x66, 0x81, 0x02, 
+0x0A, 0x81, 0xE9, 0xEB, 0x08, 0x0A, 0x80, 0xE9, 0x22, 0x01, 0x83, 0x2F, 0x15, 0x02, 0x06, 0x0A, 
+0x02, 0x85, 0x09, 0x10, 0x09, 0x6B, 0x4B, 0x12, 0x3E, 0x00, 0x80, 0x07, 0x1E, 0x00, 0x1F, 0x00, 
+0x80, 0x07, 0x3B, 0x00, 0x80, 0x04, 0x01, 0x00, 0x84, 0x40, 0x88, 0x87, 0x0E, 0x14, 0x08, 0x02, 
+0x81, 0x36, 0x06, 0x02, 0x02, 0x82, 0x5E, 0x01, 0x03, 0x22, 0x01, 0x80, 0xFF, 0x04, 0xA9, 0x02, 
+0x0A, 0x81, 0x01, 0xD5, 0x07, 0x0A, 0x80, 0xCB, 0x20, 0x01, 0x81, 0x03, 0x31, 0x01, 0x02, 0x80, 
+0x06, 0x0B, 0x02, 0x84, 0x09, 0x0E, 0x47, 0xB7, 0x2E, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 
+0x07, 0x1D, 0x00, 0x20, 0x00, 0x80, 0x07, 0x3C, 0x00, 0x80, 0x04, 0x01, 0x00, 0x82, 0x9F, 0xA3, 
+0x61, 0x01, 0x10, 0x08, 0x02, 0x01, 0x06, 0x02, 0x02, 0x82, 0x5E, 0x2F, 0x03, 0x20, 0x01, 0x80, 
+0xFF, 0x82, 0xC8, 0x01, 0x0A, 0x80, 0xEA, 0x01, 0x01, 0x80, 0xFF, 0x66, 0x81, 0x05, 0x0A, 0x81, 
+0xFB, 0x9E, 0x1E, 0x01, 0x83, 0x2F, 0x08, 0x02, 0x36, 0x0D, 0x02, 0x83, 0x10, 0x76, 0xA1, 0x84, 
+0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x1F, 0x00, 0x1E, 0x00, 0x80, 0x07, 0x3E, 0x00, 
+0x81, 0x07, 0x04, 0x01, 0x00, 0x85, 0x04, 0xE4, 0xD8, 0x0D, 0x14, 0x0E, 0x08, 0x02, 0x82, 0x06, 
+0x36, 0x02, 0x01, 0x06, 0x80, 0x0D, 0x01, 0x2F, 0x80, 0x03, 0x1D, 0x01, 0x83, 0xFF, 0x24, 0xA1, 
+0xFF, 0x82, 0xD0, 0xFC, 0xFF, 0xE3, 0xB0, 0x02, 0x01, 0x86, 0xD5, 0xCB, 0xFC, 0x0A, 0xEA, 0xBE, 
+0x9E, 0x1D, 0x01, 0x82, 0x08, 0x31, 0x06, 0x0D, 0x02, 0x84, 0x09, 0x14, 0x0D, 0x83, 0xAE, 0x01, 
+0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x21, 0x00, 0x1C, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 
+0x07, 0x06, 0x00, 0x86, 0x65, 0xD9, 0x89, 0x09, 0x14, 0x09, 0x0D, 0x08, 0x02, 0x80, 0x2A, 0x01, 
+0x06, 0x01, 0x02, 0x82, 0x5E, 0x08, 0x03, 0x1E, 0x01, 0x80, 0x9E, 0x25, 0x01, 0x80, 0x15, 0x01, 
+0x02, 0x01, 0x06, 0x0C, 0x02, 0x83, 0x0E, 0x02, 0x53, 0x7F, 0x01, 0x04, 0x80, 0x00, 0x01, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x21, 0x00, 0x1C, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x08, 0x00, 
+0x82, 0x6D, 0x7D, 0x66, 0x01, 0x10, 0x0A, 0x02, 0x01, 0x06, 0x80, 0x36, 0x01, 0x06, 0x81, 0x02, 
+0x0D, 0x40, 0x01, 0x84, 0x08, 0x15, 0x0D, 0x02, 0x06, 0x0B, 0x02, 0x81, 0x09, 0x02, 0x01, 0x09, 
+0x83, 0x0E, 0x2C, 0x91, 0x4B, 0x01, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x23, 0x00, 0x1A, 
+0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x09, 0x00, 0x80, 0x04, 0x01, 0x00, 0x84, 0x84, 0xB5, 
+0x46, 0x14, 0xF9, 0x0C, 0x02, 0x81, 0x06, 0x36, 0x02, 0x02, 0x83, 0x15, 0x49, 0x01, 0x03, 0x37, 
+0x01, 0x81, 0x49, 0x0D, 0x02, 0x02, 0x80, 0x06, 0x0F, 0x02, 0x84, 0x2C, 0x0D, 0x82, 0x85, 0x04, 
+0x3E, 0x00, 0x80, 0x07, 0x28, 0x00, 0x15, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x0F, 0x00, 
+0x01, 0x04, 0x86, 0x00, 0x45, 0x98, 0xFF, 0xEC, 0x62, 0x02, 0x14, 0x0E, 0x01, 0x09, 0x0C, 0x02, 
+0x81, 0x06, 0x36, 0x02, 0x02, 0x81, 0x15, 0x08, 0x31, 0x01, 0x81, 0x31, 0x0D, 0x02, 0x02, 0x81, 
+0x06, 0x2A, 0x0F, 0x02, 0x85, 0x0E, 0x76, 0x87, 0x7D, 0x84, 0x00, 0x02, 0x04, 0x3E, 0x00, 0x80, 
+0x07, 0x27, 0x00, 0x16, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x10, 0x00, 0x80, 0x04, 0x01, 
+0x00, 0x84, 0x52, 0x82, 0x7E, 0x6B, 0x0E, 0x02, 0x09, 0x0B, 0x02, 0x80, 0x06, 0x01, 0x02, 0x80, 
+0x06, 0x01, 0x02, 0x83, 0x06, 0x0D, 0x5E, 0x08, 0x01, 0x01, 0x80, 0x03, 0x22, 0x01, 0x80, 0x2F, 
+0x01, 0x01, 0x82, 0x03, 0x08, 0x0D, 0x02, 0x02, 0x01, 0x06, 0x11, 0x02, 0x87, 0x10, 0x0E, 0x53, 
+0xA0, 0x6D, 0x00, 0x04, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x28, 0x00, 0x15, 0x00, 0x80, 
+0x07, 0x3E, 0x00, 0x80, 0x07, 0x13, 0x00, 0x80, 0x04, 0x03, 0x00, 0x82, 0xFF, 0x35, 0xAD, 0x47, 
+0x0E, 0x01, 0x09, 0x10, 0x02, 0x01, 0x06, 0x82, 0x02, 0x2A, 0x02, 0x02, 0x0D, 0x80, 0x15, 0x01, 
+0x01, 0x80, 0x03, 0x19, 0x01, 0x84, 0x08, 0x01, 0x08, 0x49, 0x5E, 0x03, 0x02, 0x01, 0x06, 0x13, 
+0x02, 0x01, 0x0E, 0x82, 0x53, 0xA0, 0x52, 0x02, 0x00, 0x03, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x28, 
+0x00, 0x15, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x19, 0x00, 0x86, 0x30, 0x82, 0x14, 0x47, 
+0x2C, 0x10, 0x0D, 0x11, 0x02, 0x8E, 0x06, 0x02, 0x06, 0x02, 0x2A, 0x06, 0x02, 0x06, 0x0D, 0x15, 
+0x08, 0x49, 0x08, 0x01, 0x08, 0x04, 0x01, 0x80, 0x08, 0x04, 0x01, 0x89, 0x2F, 0x31, 0x01, 0x15, 
+0x5E, 0x0D, 0x31, 0x02, 0x06, 0x02, 0x02, 0x06, 0x82, 0x2A, 0x06, 0x2A, 0x14, 0x02, 0x84, 0x0E, 
+0x2C, 0x61, 0x93, 0x72, 0x01, 0x00, 0x80, 0x04, 0x01, 0x00, 0x01, 0x04, 0x81, 0x00, 0x04, 0x3E, 
+0x00, 0x80, 0x07, 0x28, 0x00, 0x15, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x1B, 0x00, 0x88, 
+0x72, 0x5D, 0xB7, 0x61, 0xEC, 0x09, 0x14, 0x09, 0x0D, 0x12, 0x02, 0x80, 0x36, 0x01, 0x02, 0x83, 
+0x06, 0x36, 0x06, 0x02, 0x01, 0x06, 0x84, 0x36, 0x02, 0x06, 0x02, 0x06, 0x02, 0x02, 0x88, 0x06, 
+0x02, 0x06, 0x02, 0x36, 0x02, 0x2A, 0x06, 0x2A, 0x17, 0x02, 0x80, 0x09, 0x02, 0x02, 0x86, 0x09, 
+0x0E, 0x14, 0x76, 0x99, 0xC5, 0x40, 0x01, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x2F, 0x00, 
+0x0E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x24, 0x00, 0x82, 0x12, 0x6D, 0x82, 0x01, 0x6B, 
+0x83, 0x10, 0x2C, 0x09, 0x0E, 0x14, 0x02, 0x80, 0x06, 0x08, 0x02, 0x80, 0x06, 0x04, 0x02, 0x80, 
+0x06, 0x19, 0x02, 0x80, 0x09, 0x02, 0x02, 0x80, 0x0D, 0x01, 0x0E, 0x84, 0xFF, 0x07, 0x42, 0xAD, 
+0x82, 0x5D, 0x30, 0x02, 0x00, 0x01, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x30, 0x00, 0x0D, 0x00, 0x80, 
+0x07, 0x3E, 0x00, 0x80, 0x07, 0x27, 0x00, 0x88, 0x12, 0x45, 0x6A, 0x7D, 0x87, 0x61, 0x2A, 0xFF, 
+0x66, 0x29, 0x09, 0x39, 0x02, 0x80, 0x09, 0x02, 0x02, 0x88, 0x0D, 0x02, 0x10, 0x14, 0x10, 0x46, 
+0x93, 0xF8, 0x12, 0x3E, 0x00, 0x80, 0x07, 0x38, 0x00, 0x05, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 
+0x07, 0x32, 0x00, 0x83, 0x45, 0x65, 0x2E, 0x93, 0x01, 0x46, 0x86, 0x2C, 0x0E, 0x2C, 0x0E, 0x0D, 
+0x09, 0x0D, 0x2E, 0x02, 0x80, 0x09, 0x03, 0x02, 0x8C, 0x0D, 0x0E, 0x14, 0x10, 0x09, 0x87, 0x7A, 
+0xAE, 0xF8, 0x12, 0x00, 0x04, 0x12, 0x3E, 0x00, 0x80, 0x07, 0x37, 0x00, 0x06, 0x00, 0x80, 0x07, 
+0x3E, 0x00, 0x80, 0x07, 0x30, 0x00, 0x80, 0x04, 0x03, 0x00, 0x88, 0x6D, 0x4B, 0xAE, 0x99, 0xA1, 
+0x10, 0x14, 0x10, 0x14, 0x01, 0x09, 0x2D, 0x02, 0x89, 0x0D, 0x09, 0x14, 0x10, 0x09, 0x53, 0x7A, 
+0x98, 0x40, 0x12, 0x02, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3A, 0x00, 0x03, 0x00, 0x80, 
+0x07, 0x3E, 0x00, 0x80, 0x07, 0x3C, 0x00, 0x85, 0x40, 0x8A, 0x90, 0x7A, 0x89, 0x46, 0x01, 0x10, 
+0x84, 0x2C, 0x0E, 0x10, 0x09, 0x0E, 0x02, 0x02, 0x80, 0x0D, 0x12, 0x02, 0x80, 0x09, 0x07, 0x02, 
+0x80, 0x0D, 0x01, 0x02, 0x8B, 0x09, 0x0E, 0x09, 0x2C, 0x14, 0x0E, 0x61, 0x83, 0x91, 0x72, 0x04, 
+0x12, 0x01, 0x00, 0x82, 0x04, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3C, 0x00, 0x01, 0x00, 0x80, 
+0x07, 0x3E, 0x00, 0x80, 0x07, 0x3D, 0x00, 0x83, 0x12, 0x00, 0x04, 0x00, 0x01, 0x45, 0x8A, 0x65, 
+0x8B, 0xAE, 0x89, 0x97, 0x66, 0x46, 0x09, 0x76, 0x09, 0x2C, 0x01, 0x0E, 0x86, 0x09, 0x02, 0x09, 
+0x02, 0xFF, 0xC6, 0x31, 0x0D, 0xFF, 0xC6, 0x31, 0x01, 0x02, 0x80, 0x0D, 0x06, 0x02, 0x80, 0x0D, 
+0x02, 0x02, 0x8F, 0x0D, 0x02, 0x0E, 0x09, 0x10, 0x09, 0x76, 0x0E, 0x14, 0x0D, 0x7A, 0x97, 0x7A, 
+0x82, 0x9F, 0x04, 0x02, 0x00, 0x82, 0x04, 0x12, 0x04, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 
+0x07, 0x3D, 0x00, 0x81, 0x00, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x83, 0x07, 0x04, 0x00, 
+0x04, 0x03, 0x00, 0x81, 0x12, 0x04, 0x01, 0x2E, 0x87, 0x72, 0x88, 0x8A, 0x7E, 0xA0, 0x61, 0x47, 
+0x02, 0x01, 0x09, 0x80, 0x10, 0x01, 0x14, 0x99, 0x09, 0x14, 0x09, 0x2C, 0x09, 0x14, 0x09, 0x76, 
+0x09, 0x0E, 0x10, 0x14, 0x10, 0x09, 0x76, 0x0E, 0x0D, 0x66, 0xF9, 0xB2, 0x82, 0x99, 0x88, 0x85, 
+0xFF, 0x9D, 0xF7, 0x04, 0x03, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 
+0x06, 0x00, 0x37, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x0B, 0x00, 0x01, 0x04, 0x04, 0x00, 
+0x80, 0x04, 0x03, 0x00, 0x83, 0x2E, 0x40, 0x9F, 0x30, 0x01, 0x5D, 0x83, 0xB7, 0xAE, 0x98, 0x82, 
+0x01, 0x7D, 0x92, 0x7A, 0x93, 0x88, 0xA1, 0x7A, 0x93, 0x91, 0x7E, 0xA1, 0x93, 0x90, 0x91, 0x7F, 
+0x65, 0x6D, 0x52, 0x45, 0x00, 0x04, 0x01, 0x00, 0x80, 0xBB, 0x02, 0x04, 0x3E, 0x00, 0x80, 0x07, 
+0x3E, 0x00, 0x80, 0x07, 0x09, 0x00, 0x34, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x1B, 0x00, 
+0x80, 0x04, 0x06, 0x00, 0x83, 0x04, 0x00, 0x04, 0xCD, 0x01, 0x00, 0x84, 0x04, 0x00, 0x0F, 0x00, 
+0x04, 0x02, 0x00, 0x80, 0x04, 0x02, 0x00, 0x81, 0x04, 0x12, 0x01, 0x04, 0x81, 0x00, 0x04, 0x3E, 
+0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x0D, 0x00, 0x30, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 
+0x07, 0x22, 0x00, 0x02, 0x04, 0x02, 0x00, 0x84, 0x0F, 0x00, 0x04, 0x00, 0x04, 0x02, 0x00, 0x81, 
+0x0F, 0x00, 0x02, 0x04, 0x03, 0x00, 0x02, 0x04, 0x01, 0x00, 0x80, 0x04, 0x3E, 0x00, 0x80, 0x07, 
+0x3E, 0x00, 0x80, 0x07, 0x0D, 0x00, 0x30, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x16, 0x00, 
+0x80, 0x04, 0x0A, 0x00, 0x01, 0x04, 0x0C, 0x00, 0x80, 0x0F, 0x06, 0x00, 0x01, 0x04, 0x3E, 0x00, 
+0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x11, 0x00, 0x2C, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 
+0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x3E, 0x00, 0x80, 0x07, 0x11, 0x00, 
+};
@@ -0,0 +1,182 @@
+/******************************************************************************
+ * http_writer.cpp
+ * Buffered HTTP response writer for the M5Stack Screen-Capture web server.
+ * See http_writer.h for a description of the interface.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "http_writer.h"
+#include "logger.h"
+
+ResponseWriter http_response;
+
+
+ResponseWriter::ResponseWriter(size_t buffer_size){
+  size = buffer_size;
+  // the buffer is allocated on the first use (not during static init)
+  buffer = NULL;
+  used = 0;
+  client = NULL;
+  write_error = false;
+  sent = 0;
+  writes = 0;
+  start_micros = first_byte_micros = end_micros = 0;
+}
+
+
+void ResponseWriter::begin(WiFiClient &new_client){
+  if(!buffer)
+    buffer = (uint8_t *) malloc(size);
+  client = &new_client;
+  used = 0;
+  write_error = (buffer == NULL);
+  sent = 0;
+  writes = 0;
+  start_micros = micros();
+  first_byte_micros = end_micros = start_micros;
+  set_nodelay(HTTP_WRITER_NODELAY);
+}
+
+
+void ResponseWriter::set_nodelay(bool nodelay){
+  if(client)
+    client->setNoDelay(nodelay);
+}
+
+
+void ResponseWriter::status(int code, const char *reason){
+  printf("HTTP/1.1 %d %s\r\n", code, reason);
+}
+
+
+void ResponseWriter::header(const char *name, const char *value){
+  printf("%s: %s\r\n", name, value);
+}
+
+
+void ResponseWriter::header(const char *name, unsigned long value){
+  printf("%s: %lu\r\n", name, value);
+}
+
+
+void ResponseWriter::end_headers(){
+  write((const uint8_t *)"\r\n", 2);
+}
+
+
+/***************************************************************************************
+* Function name:          send_raw
+* Description:            send data to the client without buffering
+* return value:           number of bytes written
+***************************************************************************************/
+size_t ResponseWriter::send_raw(const uint8_t *data, size_t len){
+  if(!client || write_error || len == 0)
+    return 0;
+  size_t n = client->write(data, len);
+  if(sent == 0)
+    first_byte_micros = micros();
+  sent += n;
+  writes++;
+  if(n != len)
+    write_error = true;
+  return n;
+}
+
+
+size_t ResponseWriter::write(uint8_t c){
+  return write(&c, 1);
+}
+
+
+/***************************************************************************************
+* Function name:          write
+* Description:            add data to the response
+*                         The buffer is filled up to a full segment before it is sent.
+*                         Large blocks are sent directly (in multiples of the buffer
+*                         size), only the rest is kept in the buffer.
+* return value:           number of bytes accepted
+***************************************************************************************/
+size_t ResponseWriter::write(const uint8_t *data, size_t len){
+  if(write_error)
+    return 0;
+  size_t accepted = len;
+  // top up a partly filled buffer first
+  if(used > 0){
+    size_t n = min(len, size - used);
+    memcpy(buffer + used, data, n);
+    used += n;
+    data += n;
+    len -= n;
+    if(used == size)
+      flush_buffer();
+  }
+  // whole segments can go out without copying
+  if(len >= size){
+    size_t direct = len - (len % size);
+    send_raw(data, direct);
+    data += direct;
+    len -= direct;
+  }
+  if(len > 0){
+    memcpy(buffer + used, data, len);
+    used += len;
+  }
+  return write_error ? 0 : accepted;
+}
+
+
+size_t ResponseWriter::write_P(const char *data, size_t len){
+  // the flash is memory mapped on the ESP32
+  return write((const uint8_t *)data, len);
+}
+
+
+bool ResponseWriter::flush_buffer(){
+  if(used > 0){
+    send_raw(buffer, used);
+    used = 0;
+  }
+  return !write_error;
+}
+
+
+void ResponseWriter::end(){
+  flush_buffer();
+  end_micros = micros();
+  logger_write(LOG_HTTP, LOG_DEBUG, "response: %u bytes in %u writes, TTFB %lu us, total %lu us",
+               (unsigned)sent, (unsigned)writes, ttfb_us(), total_us());
+  client = NULL;
+}
+
+
+/***************************************************************************************
+* Function name:          http_send_text
+* Description:            send a complete response with a short text body
+*                         text = NULL sends no body (e.g. for 204 No Content)
+***************************************************************************************/
+void http_send_text(WiFiClient &client, int code, const char *reason,
+                    const char *text, unsigned long retry_after){
+  http_response.begin(client);
+  http_response.status(code, reason);
+  if(retry_after > 0)
+    http_response.header("Retry-After", retry_after);
+  if(text){
+    http_response.header("Content-type", "text/plain");
+    http_response.header("Content-Length", (unsigned long)strlen(text));
+  }
+  http_response.end_headers();
+  if(text)
+    http_response.print(text);
+  http_response.end();
+}
+
+
+void http_send_json(WiFiClient &client, const char *json){
+  http_response.begin(client);
+  http_response.status(200, "OK");
+  http_response.header("Content-type", "application/json");
+  http_response.header("Content-Length", (unsigned long)strlen(json));
+  http_response.end_headers();
+  http_response.print(json);
+  http_response.end();
+}
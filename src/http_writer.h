@@ -0,0 +1,97 @@
+/******************************************************************************
+ * http_writer.h
+ * Buffered HTTP response writer for the M5Stack Screen-Capture web server.
+ *
+ * The status line, the header lines and the body are collected in one
+ * reusable buffer and sent to the client in full TCP segments. Without
+ * the buffer, every println() ends up in its own small TCP segment,
+ * which results in Nagle / delayed-ACK stalls on the client side.
+ *
+ * The writer is a Print, so everything that can print to a WiFiClient
+ * can print into the writer as well.
+ *
+ * example:
+ *   http_response.begin(client);
+ *   http_response.status(200, "OK");
+ *   http_response.header("Content-type", "text/html");
+ *   http_response.end_headers();
+ *   http_response.write_P(index_html, sizeof(index_html));
+ *   http_response.end();
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef HTTP_WRITER_H
+#define HTTP_WRITER_H
+
+#include <Arduino.h>
+#include "WiFi.h"
+
+// size of the send buffer
+// 1460 bytes = TCP maximum segment size for an Ethernet/WiFi MTU of 1500
+#ifndef HTTP_WRITER_BUFFER_SIZE
+#define HTTP_WRITER_BUFFER_SIZE 1460
+#endif
+
+// TCP_NODELAY for response connections
+// Since the writer only sends full segments (or the final rest), Nagle's
+// algorithm can't combine anything anymore and only adds latency.
+#ifndef HTTP_WRITER_NODELAY
+#define HTTP_WRITER_NODELAY true
+#endif
+
+class ResponseWriter : public Print {
+  public:
+    ResponseWriter(size_t buffer_size = HTTP_WRITER_BUFFER_SIZE);
+    // start a new response on the given client
+    void begin(WiFiClient &client);
+    // enable or disable TCP_NODELAY for the current client
+    void set_nodelay(bool nodelay);
+    // status line, e.g. status(200, "OK")
+    void status(int code, const char *reason);
+    void header(const char *name, const char *value);
+    void header(const char *name, unsigned long value);
+    // the empty line between header and body
+    void end_headers();
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t len) override;
+    using Print::write;
+    // body data from the flash memory
+    size_t write_P(const char *data, size_t len);
+    // send everything that is in the buffer
+    bool flush_buffer();
+    // flush the buffer and finish the response (statistics are logged)
+    void end();
+    // true if no write to the client failed since begin()
+    bool ok() { return !write_error; }
+    // statistics of the last response (micro seconds / bytes)
+    unsigned long ttfb_us() { return first_byte_micros - start_micros; }
+    unsigned long total_us() { return end_micros - start_micros; }
+    size_t bytes_sent() { return sent; }
+    // number of writes to the client (not TCP segments, lwIP may split or merge them)
+    size_t writes_sent() { return writes; }
+
+  private:
+    size_t send_raw(const uint8_t *data, size_t len);
+    uint8_t *buffer;
+    size_t size;
+    size_t used;
+    WiFiClient *client;
+    bool write_error;
+    size_t sent;
+    size_t writes;
+    unsigned long start_micros;
+    unsigned long first_byte_micros;
+    unsigned long end_micros;
+};
+
+// the web server handles one response at a time, so one writer is enough
+extern ResponseWriter http_response;
+
+// complete response with a short text body (text = NULL: no body)
+// retry_after > 0 adds a Retry-After header (seconds)
+void http_send_text(WiFiClient &client, int code, const char *reason,
+                    const char *text, unsigned long retry_after = 0);
+// complete 200 response with a JSON body
+void http_send_json(WiFiClient &client, const char *json);
+
+#endif
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * input.cpp
+ * Debounced buttons of the M5Stack without blocking delays.
+ * See input.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "input.h"
+#include <M5Stack.h>
+
+#define INPUT_BUTTONS 3
+
+struct input_button_t {
+  // state of the button after the last update
+  bool pressed;
+  // time of the last change from released to pressed
+  unsigned long since;
+  // press is accepted and reported
+  bool accepted;
+  bool event;
+};
+
+static input_button_t buttons[INPUT_BUTTONS];
+// accepted presses that are not reported yet (bit 0 = A) and the time of the first one
+static uint8_t pending_mask = 0;
+static unsigned long pending_since;
+// reported combination (bit mask), 0 = none
+static uint8_t combo_event = 0;
+
+
+// return value: true if the press was accepted now
+static bool update_button(input_button_t &b, bool pressed, unsigned long now){
+  if(pressed && !b.pressed)
+    b.since = now;
+  if(!pressed)
+    b.accepted = false;
+  b.pressed = pressed;
+  if(pressed && !b.accepted && now - b.since >= INPUT_DEBOUNCE_MS){
+    b.accepted = true;
+    return true;
+  }
+  return false;
+}
+
+
+void input_update(){
+  unsigned long now = millis();
+  bool pressed[INPUT_BUTTONS] = { M5.BtnA.isPressed(), M5.BtnB.isPressed(), M5.BtnC.isPressed() };
+  for(int i=0; i<INPUT_BUTTONS; i++){
+    if(update_button(buttons[i], pressed[i], now)){
+      if(pending_mask == 0)
+        pending_since = now;
+      pending_mask |= 1 << i;
+    }
+  }
+  // report the presses when no other button can join anymore
+  if(pending_mask && now - pending_since >= INPUT_COMBO_MS){
+    if((pending_mask & (pending_mask - 1)) == 0){
+      for(int i=0; i<INPUT_BUTTONS; i++){
+        if(pending_mask & (1 << i))
+          buttons[i].event = true;
+      }
+    } else {
+      combo_event = pending_mask;
+    }
+    pending_mask = 0;
+  }
+}
+
+
+bool input_pressed(char button){
+  int index = button - 'A';
+  if(index < 0 || index >= INPUT_BUTTONS || !buttons[index].event)
+    return false;
+  buttons[index].event = false;
+  return true;
+}
+
+
+bool input_combo(const char *combo){
+  uint8_t mask = 0;
+  for(const char *c=combo; *c; c++){
+    int index = *c - 'A';
+    if(index >= 0 && index < INPUT_BUTTONS)
+      mask |= 1 << index;
+  }
+  if(mask == 0 || combo_event != mask)
+    return false;
+  combo_event = 0;
+  return true;
+}
@@ -0,0 +1,35 @@
+/******************************************************************************
+ * input.h
+ * Debounced buttons of the M5Stack without blocking delays.
+ *
+ * With WiFi active, the A button (GPIO 39) shows short ghost presses.
+ * They used to be suppressed by the delay(20) at the end of loop(), which
+ * made the loop poll the buttons only every 20 ms. Now every button has
+ * to be pressed for INPUT_DEBOUNCE_MS without interruption before the
+ * press is accepted, independent of how often input_update() is called.
+ *
+ * Buttons that are pressed together (within INPUT_COMBO_MS) are reported
+ * as a combination (input_combo("AC")) instead of single presses, so a
+ * combination does not trigger the functions of its buttons. A single
+ * press is reported INPUT_COMBO_MS after it was accepted.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <Arduino.h>
+
+// minimum time a button has to be pressed without interruption
+#define INPUT_DEBOUNCE_MS 20
+// presses within this time form a combination
+#define INPUT_COMBO_MS 60
+
+// read the buttons (call after M5.update() in every loop)
+void input_update();
+// true once for every accepted press of the button 'A', 'B' or 'C'
+bool input_pressed(char button);
+// true once when exactly the given buttons were pressed together, e.g. "AC"
+bool input_combo(const char *buttons);
+
+#endif
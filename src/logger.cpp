@@ -0,0 +1,185 @@
+/******************************************************************************
+ * logger.cpp
+ * Asynchronous logging for the M5Stack Screen-Capture firmware.
+ * See logger.h for a description of the interface.
+ *
+ * The ring buffer is a bounded multi-producer / single-consumer queue.
+ * Every slot carries a sequence number that tells producers and the
+ * consumer whether the slot is free or holds a finished message.
+ * Producers reserve a slot with a single compare-and-swap on the head
+ * index, so no task ever waits for another one.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "logger.h"
+
+#include <atomic>
+#include <stdarg.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// default level for each category
+uint8_t logger_level[LOG_N_CATEGORIES] = {
+  LOG_INFO,   // LOG_SYS
+  LOG_INFO,   // LOG_HTTP
+  LOG_INFO,   // LOG_WIFI
+  LOG_INFO    // LOG_CAPTURE
+};
+
+static const char *level_tag[] = { "ERR", "WARN", "INFO", "DBG" };
+static const char *category_tag[] = { "sys", "http", "wifi", "capture" };
+
+struct log_slot_t {
+  std::atomic<uint32_t> seq;
+  uint32_t timestamp;
+  uint8_t category;
+  uint8_t level;
+  // deferred = true: text is not used, format and args are formatted later
+  bool deferred;
+  const char *format;
+  int32_t args[3];
+  char text[LOGGER_MSG_LEN];
+};
+
+static log_slot_t log_ring[LOGGER_RING_SIZE];
+static std::atomic<uint32_t> log_head(0);
+static uint32_t log_tail = 0;
+static std::atomic<uint32_t> log_dropped_count(0);
+static TaskHandle_t logger_task_handle = NULL;
+
+// drain the ring buffer every 10ms
+#define LOGGER_DRAIN_INTERVAL_MS 10
+
+
+/***************************************************************************************
+* Function name:          log_reserve
+* Description:            reserve a free slot in the ring buffer
+* return value:           pointer to the slot or NULL if the buffer is full
+***************************************************************************************/
+static log_slot_t *log_reserve(){
+  uint32_t pos = log_head.load(std::memory_order_relaxed);
+  for(;;){
+    log_slot_t *slot = &log_ring[pos & (LOGGER_RING_SIZE-1)];
+    uint32_t seq = slot->seq.load(std::memory_order_acquire);
+    int32_t diff = (int32_t)seq - (int32_t)pos;
+    if(diff == 0){
+      // slot is free, try to claim it
+      if(log_head.compare_exchange_weak(pos, pos+1, std::memory_order_relaxed))
+        return slot;
+    } else if(diff < 0){
+      // slot still holds a message that was not drained yet
+      log_dropped_count.fetch_add(1, std::memory_order_relaxed);
+      return NULL;
+    } else {
+      // another producer was faster
+      pos = log_head.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// hand the filled slot over to the consumer
+static inline void log_commit(log_slot_t *slot){
+  uint32_t pos = slot->seq.load(std::memory_order_relaxed);
+  slot->seq.store(pos+1, std::memory_order_release);
+}
+
+
+bool logger_write(uint8_t category, uint8_t level, const char *format, ...){
+  if(!logger_enabled(category, level))
+    return false;
+  log_slot_t *slot = log_reserve();
+  if(!slot)
+    return false;
+  slot->timestamp = millis();
+  slot->category = category;
+  slot->level = level;
+  slot->deferred = false;
+  va_list args;
+  va_start(args, format);
+  vsnprintf(slot->text, LOGGER_MSG_LEN, format, args);
+  va_end(args);
+  log_commit(slot);
+  return true;
+}
+
+
+bool logger_fast_push(uint8_t category, uint8_t level, const char *format,
+                      int32_t a, int32_t b, int32_t c){
+  log_slot_t *slot = log_reserve();
+  if(!slot)
+    return false;
+  slot->timestamp = millis();
+  slot->category = category;
+  slot->level = level;
+  slot->deferred = true;
+  slot->format = format;
+  slot->args[0] = a;
+  slot->args[1] = b;
+  slot->args[2] = c;
+  log_commit(slot);
+  return true;
+}
+
+
+void logger_set_level(uint8_t category, uint8_t level){
+  if(category < LOG_N_CATEGORIES)
+    logger_level[category] = level;
+}
+
+
+uint32_t logger_dropped(){
+  return log_dropped_count.load(std::memory_order_relaxed);
+}
+
+
+/***************************************************************************************
+* Function name:          logger_task
+* Description:            background task that writes the messages to Serial
+***************************************************************************************/
+static void logger_task(void *parameter){
+  uint32_t reported_drops = 0;
+  char line[LOGGER_MSG_LEN];
+  for(;;){
+    for(;;){
+      log_slot_t *slot = &log_ring[log_tail & (LOGGER_RING_SIZE-1)];
+      if(slot->seq.load(std::memory_order_acquire) != log_tail+1)
+        break;
+      const char *text = slot->text;
+      if(slot->deferred){
+        snprintf(line, sizeof(line), slot->format,
+                 slot->args[0], slot->args[1], slot->args[2]);
+        text = line;
+      }
+      Serial.printf("%lu [%s][%s] %s\n", (unsigned long)slot->timestamp,
+                    level_tag[slot->level & 3],
+                    category_tag[slot->category % LOG_N_CATEGORIES], text);
+      // release the slot for the next round
+      slot->seq.store(log_tail+LOGGER_RING_SIZE, std::memory_order_release);
+      log_tail++;
+    }
+    uint32_t drops = logger_dropped();
+    if(drops != reported_drops){
+      Serial.printf("[WARN][log] %u messages dropped\n", (unsigned)(drops - reported_drops));
+      reported_drops = drops;
+    }
+    vTaskDelay(pdMS_TO_TICKS(LOGGER_DRAIN_INTERVAL_MS));
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          logger_begin
+* Description:            initialize the ring buffer and start the background task
+*                         Serial must be initialized before (done by M5.begin())
+***************************************************************************************/
+void logger_begin(){
+  if(logger_task_handle)
+    return;
+  for(uint32_t i=0; i<LOGGER_RING_SIZE; i++)
+    log_ring[i].seq.store(i, std::memory_order_relaxed);
+  log_head.store(0);
+  log_tail = 0;
+  // lowest priority above idle, on the core that is not running loop()
+  xTaskCreatePinnedToCore(logger_task, "logger", 3072, NULL, 1,
+                          &logger_task_handle, 0);
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * logger.h
+ * Asynchronous logging for the M5Stack Screen-Capture firmware.
+ *
+ * Log messages are placed into a lock-free ring buffer and written to the
+ * serial port by a low-priority background task. Writing a message never
+ * blocks: if the ring buffer is full, the message is dropped and counted.
+ *
+ * Every message has a level and a category. Messages below the level
+ * configured for their category are discarded before any formatting.
+ *
+ * Two ways to log:
+ *   logger_write() formats the message immediately (printf style) and
+ *                  copies the text into the ring buffer.
+ *   logger_fast()  stores only a pointer to a constant format string and
+ *                  up to three integer arguments. The formatting is done
+ *                  later by the background task. This is the one to use
+ *                  on hot paths. The format string must be a literal and
+ *                  must only contain integer conversions (%d, %u, %x...).
+ *
+ * example:
+ *   logger_write(LOG_WIFI, LOG_ERR, "unable to connect to %s", ssid);
+ *   logger_fast(LOG_HTTP, LOG_DEBUG, "sent %d bytes in %d ms", n, t);
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+
+// log levels (lower value = more important)
+#define LOG_ERR    0
+#define LOG_WARN   1
+#define LOG_INFO   2
+#define LOG_DEBUG  3
+
+// log categories
+#define LOG_SYS      0
+#define LOG_HTTP     1
+#define LOG_WIFI     2
+#define LOG_CAPTURE  3
+#define LOG_N_CATEGORIES 4
+
+// number of messages the ring buffer can hold (must be a power of 2)
+#ifndef LOGGER_RING_SIZE
+#define LOGGER_RING_SIZE 64
+#endif
+// maximum length of a single (formatted) message including the terminating 0
+#ifndef LOGGER_MSG_LEN
+#define LOGGER_MSG_LEN 96
+#endif
+
+// level threshold per category (read on every log call)
+extern uint8_t logger_level[LOG_N_CATEGORIES];
+
+void logger_begin();
+void logger_set_level(uint8_t category, uint8_t level);
+bool logger_write(uint8_t category, uint8_t level, const char *format, ...)
+  __attribute__((format(printf, 3, 4)));
+bool logger_fast_push(uint8_t category, uint8_t level, const char *format,
+                      int32_t a, int32_t b, int32_t c);
+uint32_t logger_dropped();
+
+// check the level first, so that filtered messages cost only one compare
+inline bool logger_enabled(uint8_t category, uint8_t level){
+  return level <= logger_level[category];
+}
+
+inline bool logger_fast(uint8_t category, uint8_t level, const char *format,
+                        int32_t a = 0, int32_t b = 0, int32_t c = 0){
+  if(!logger_enabled(category, level))
+    return false;
+  return logger_fast_push(category, level, format, a, b, c);
+}
+
+#endif
@@ -30,6 +30,9 @@
 // install the library:
 // pio lib install "M5Stack"
 
+// asynchronous logging to the serial port
+#include "logger.h"
+
 // Free Fonts for nice looking fonts on the screen
 #include "Free_Fonts.h"
 
@@ -58,40 +61,141 @@ WiFiServer server(80);
 #define GET_refresh_img  4
 #define GET_button_img  5
 #define GET_screenshot  6
+#define GET_live_page  7
+#define GET_websocket  8
+#define GET_events  9
+#define POST_api_button  10
+#define GET_api_frame  11
+#define GET_api_storage  12
+#define GET_api_retention  13
+#define POST_api_burst  14
+#define GET_api_burst  15
+#define GET_burst_file  16
+#define GET_api_dedup  17
+#define GET_api_transcode  18
+#define GET_file  19
+#define GET_api_files  20
 int html_get_request;
+// minimum interval of the event stream (query parameter "interval")
+unsigned long events_interval;
+// new frame cap of GET /api/frame?fps=<n> (0 = unchanged)
+long api_fps;
+// parameters of POST /api/burst
+long api_burst_frames;
+long api_burst_seconds;
+bool api_burst_delta;
+bool api_burst_sd;
+// value of the Sec-WebSocket-Key header of the current request
+char websocket_key[48];
+// value of the If-None-Match header of the current request
+char if_none_match[48];
 
 // website stuff
+#include "http_writer.h"
 #include "index.h"
 #include "electric_logo.h"
 #include "favicon.h"
 #include "button.h"
 #include "refresh.h"
+#include "live.h"
+
+// screen capture to files and network clients
+#include "capture.h"
+#include "screenshot.h"
+// background writer for the captures of the buttons
+#include "storage.h"
+#include "capture_name.h"
+#include "retention.h"
+// consecutive frames into one archive
+#include "burst.h"
+#include "file_writer.h"
+// content hash of the screen, unchanged frames are not stored or sent again
+#include "frame_hash.h"
+// BMP captures are transcoded to QOI in the idle time
+#include "transcode.h"
+// downloads of the stored files with byte ranges (resume)
+#include <SPIFFS.h>
+#include "file_server.h"
+// Range and If-Range headers and the file of GET /sd/<path>, GET /spiffs/<path>
+char http_range[48];
+char http_if_range[48];
+char file_path[FILE_SERVER_PATH_LEN];
+fs::FS *file_fs;
+
+// change tracking of the screen and WebSocket live view
+#include "screen.h"
+// off-screen frame buffer in PSRAM
+#include "canvas.h"
+#include "websocket.h"
+// Server-Sent Events feed
+#include "events.h"
 
 unsigned long next_millis;
-// Flags for button presses via Web interface
-bool Control_A_pressed = false;
-bool Control_B_pressed = false;
-bool Control_C_pressed = false;
-
-// image for gauge display
-#include "gauge.h"
-// RAD = DEG * (pi/180).
-#define DEG2RAD 0.01745329251994;
+// Queue for button presses via Web interface
+// every press gets an id (= number of presses queued before)
+#define BUTTON_QUEUE_SIZE 16
+char button_queue[BUTTON_QUEUE_SIZE];
+uint32_t button_queue_head = 0;
+uint32_t button_queue_tail = 0;
+// buttons of the current POST /api/button/... request
+char api_buttons[BUTTON_QUEUE_SIZE+1];
+bool api_wait;
+// clients waiting for the frame of their button press (?wait=1)
+#define BUTTON_MAX_WAITERS 4
+#define BUTTON_WAIT_TIMEOUT_MS 2000
+struct button_waiter_t {
+  WiFiClient client;
+  bool active;
+  uint32_t press_id;
+  unsigned long deadline;
+};
+button_waiter_t button_waiters[BUTTON_MAX_WAITERS];
+
+// dashboard with the gauge, two bar graphs and a numeric readout
+#include "widgets.h"
+// frame rate of the dashboard and debounced buttons
+#include "frame.h"
+#include "input.h"
+// smooth movement of the needle
+#include "animation.h"
+#include "gauge_bg.h"
 // the value for the gauge display
 float gauge_val = 50.0;
+// displayed needle position, follows gauge_val
+anim_value_t needle = ANIM_VALUE(50.0, ANIM_SMOOTH_TIME);
+// true: the dashboard has replaced the start screen
+bool dashboard_visible = false;
+// layout of the dashboard
+// the bars are placed in the white stripes left and right of the gauge image
+enum { DASH_GAUGE, DASH_VALUE, DASH_RSSI, DASH_BATTERY, DASH_WIDGETS };
+widget_t dashboard[DASH_WIDGETS] = {
+  // type            x    y    w    h   min  max  color          format
+  { WIDGET_GAUGE,    0,   0, 320, 240,    0, 100, TFT_RED,       NULL },
+  { WIDGET_NUMBER,   2,   2,  52,  20,    0, 100, TFT_BLACK,     "%.0f%%" },
+  { WIDGET_BAR,      8,  60,  14, 120, -100, -40, TFT_BLUE,      NULL },
+  { WIDGET_BAR,    298,  60,  14, 120,    0, 100, TFT_DARKGREEN, NULL },
+};
 
 // forward declarations:
 void check_webserver();
 boolean connect_Wifi();
-bool M5Screen2bmp(WiFiClient &client);
-bool M5Screen2bmp(fs::FS &fs, const char * path);
-bool M5Screen2ppm(fs::FS &fs, const char * path);
-void draw_gauge(float val_1, float val_2);
+void send_progmem(WiFiClient &client, const char *content_type, const char *data, size_t len);
+void draw_dashboard(float val_1, float val_2);
+void handle_ws_command(uint8_t command, uint8_t argument);
+bool button_queue_push(char button);
+char button_queue_pop();
+bool button_wait(WiFiClient &client, uint32_t press_id);
+void url_path(const char *url, char *path, size_t size);
+void service_button_waiters();
+void capture_done(const char *path, bool ok, void *arg);
+void capture_button(char button, bool web);
 
 
 void setup() {
   M5.begin();
   M5.Power.begin();
+  // start the logging task (Serial is initialized by M5.begin())
+  logger_begin();
   //Brightness (0: Off - 255: Full)
   M5.Lcd.setBrightness(100); 
   // draw start screen  
@@ -126,59 +230,140 @@ void setup() {
   M5.Lcd.setFreeFont(FF1);
   M5.Lcd.setTextColor(TFT_WHITE);
   M5.Lcd.drawString(String_buffer, (int)(M5.Lcd.width()/2), M5.Lcd.height()-20, 1);
+  screen_invalidate_all();
   // Start TCP/IP-Server
   server.begin();     
+  // Live view via WebSocket
+  ws_begin(handle_ws_command);
+  // snapshot buffer for the screenshot requests
+  screenshot_begin();
+  // capture slots and task for writing the captures to the SD card
+  storage_begin();
+  // numbered file names for the captures (counter in the NVS)
+  capture_name_begin(SD);
+  // quota of the captures on the SD card (oldest captures are evicted)
+  retention_begin(SD, SD.totalBytes());
+  // index of a burst archive that was written during a power loss
+  burst_recover(SD);
+  // smaller files for the stored captures, in the background
+  transcode_begin(SD);
+  // SPIFFS for the file downloads
+  file_server_begin();
+#ifdef FILE_WRITER_BENCHMARK
+  // SD write speed for the different block sizes
+  file_writer_benchmark(SD);
+#endif
+  // frame buffer for the gauge (drawing directly on the LCD without PSRAM)
+  canvas_begin();
+  gauge_bg_benchmark();
+  widgets_begin(dashboard, DASH_WIDGETS);
+  frame_begin(FRAME_DEFAULT_FPS);
   // start gauge display after 20 seconds (or button press)
   next_millis = millis() + 20000;
 }
 
 void loop() {
   M5.update();  
+  input_update();
   // get actual time in miliseconds
   unsigned long current_millis = millis();
+  // next button press from the Web interface (0 = none)
+  char web_button = button_queue_pop();
+
+  // buttons A and C together: record a burst of frames
+  if (input_combo("AC")){
+    burst_start(BURST_DEFAULT_FRAMES, 0, true, true);
+  }
 
   // left Button
-  if (M5.BtnA.wasPressed() || Control_A_pressed){  
-    Control_A_pressed = false;
+  if (input_pressed('A') || web_button == 'A'){  
+    ws_button_event('A');
+    events_button('A');
     gauge_val = 0.0;
-    draw_gauge(gauge_val, 50);
-    M5Screen2bmp(SD, "/gauge_0.bmp");
+    // no animation, the capture shows the final position
+    anim_jump(needle, gauge_val);
+    draw_dashboard(needle.value, 50);
+    // new numbered file, written in the background
+    capture_button('A', web_button == 'A');
     next_millis = millis() + 1000;
   }
 
   // center Button
-  if (M5.BtnB.wasPressed() || Control_B_pressed){
-    Control_B_pressed = false;
+  if (input_pressed('B') || web_button == 'B'){
+    ws_button_event('B');
+    events_button('B');
     gauge_val = 50.0;
-    draw_gauge(gauge_val, 50);
-    M5Screen2bmp(SD, "/gauge_50.bmp");
+    // no animation, the capture shows the final position
+    anim_jump(needle, gauge_val);
+    draw_dashboard(needle.value, 50);
+    // new numbered file, written in the background
+    capture_button('B', web_button == 'B');
     next_millis = millis() + 1000;
   }
 
   // right Button
-  if (M5.BtnC.wasPressed() || Control_C_pressed){
-    Control_C_pressed = false;
+  if (input_pressed('C') || web_button == 'C'){
+    ws_button_event('C');
+    events_button('C');
     gauge_val = 100.0;
-    draw_gauge(gauge_val, 50);
-    M5Screen2bmp(SD, "/gauge_100.bmp");
+    // no animation, the capture shows the final position
+    anim_jump(needle, gauge_val);
+    draw_dashboard(needle.value, 50);
+    // new numbered file, written in the background
+    capture_button('C', web_button == 'C');
     next_millis = millis() + 1000;
   }
 
-  // check if next measure interval is reached
-  if(current_millis > next_millis){
-    // ramdom movements for gauge display
-    gauge_val += random(0, 11)-5;
-    if(gauge_val < 0) gauge_val = 0.0;
-    if(gauge_val > 100) gauge_val = 100.0;
-    draw_gauge(gauge_val, 50);
-    next_millis = millis() + 1000;
+  // answer the clients that are waiting for the frame of their button press
+  service_button_waiters();
+
+  // next frame of the dashboard (fixed frame rate)
+  if(frame_start()){
+    // check if next measure interval is reached
+    if(current_millis > next_millis){
+      // ramdom movements for gauge display
+      gauge_val += random(0, 11)-5;
+      if(gauge_val < 0) gauge_val = 0.0;
+      if(gauge_val > 100) gauge_val = 100.0;
+      anim_set_target(needle, gauge_val);
+      // the status bars are updated with the same interval
+      widget_set(DASH_RSSI, WiFi.RSSI());
+      widget_set(DASH_BATTERY, M5.Power.getBatteryLevel());
+      dashboard_visible = true;
+      next_millis = millis() + 1000;
+    }
+    if(dashboard_visible){
+      // the needle moves towards gauge_val, only the widgets with
+      // changed values are drawn (nothing if the needle is at rest)
+      anim_step(needle, frame_dt());
+      draw_dashboard(needle.value, 50);
+    }
+    frame_end();
+    // a running burst takes every frame
+    burst_frame();
   }
 
   // check for new clients and handle responses
   check_webserver();
-  // The delay is important
-  // otherwise ghost key presses of the A key may occur.
-  delay(20);
+  // send the queued screenshots (one slice per client)
+  screenshot_service();
+  // report the captures written in the background
+  storage_service();
+  // send the burst archive to the download client
+  burst_service();
+  // send the next blocks of the file downloads
+  file_server_service();
+  // send screen updates to the live view clients
+  ws_service();
+  // send the pending events to the event stream clients
+  events_service();
+  // transcode the stored captures in the idle time before the next frame,
+  // not during a burst and not while a client is waiting for the connection
+  if(burst_state() != BURST_CAPTURING && !server.hasClient())
+    transcode_service(frame_idle_left_us());
+  // sleep until the next frame (a few ms at most)
+  // ghost key presses of the A key are filtered by the debouncing in input.cpp
+  frame_idle();
 }
 
 
@@ -193,11 +378,11 @@ void check_webserver(){
   wl_status_t wifi_Status = WiFi.status();
   if(wifi_Status != WL_CONNECTED){
     // reconnect if the connection get lost
-    Serial.println("[ERR] Lost WiFi connection, reconnecting...");
+    logger_write(LOG_WIFI, LOG_ERR, "Lost WiFi connection, reconnecting...");
     if(connect_Wifi()){
-      Serial.println("[OK] WiFi reconnected");
+      logger_write(LOG_WIFI, LOG_INFO, "WiFi reconnected");
     } else {
-      Serial.println("[ERR] unable to reconnect");
+      logger_write(LOG_WIFI, LOG_ERR, "unable to reconnect");
     }
   }
   // check if WIFI is connected
@@ -209,21 +394,26 @@ void check_webserver(){
     if (client) {  
       // force a disconnect after 2 seconds
       unsigned long timeout_millis = millis()+2000;
-      Serial.println("New Client.");  
+      logger_fast(LOG_HTTP, LOG_DEBUG, "New Client.");
       // a String to hold incoming data from the client line by line        
       String currentLine = "";                
+      // true if the connection is handed over (e.g. to the WebSocket server)
+      bool keep_connection = false;
+      websocket_key[0] = 0;
+      if_none_match[0] = 0;
+      http_range[0] = 0;
+      http_if_range[0] = 0;
       // loop while the client's connected
       while (client.connected()) { 
         // if the client is still connected after 2 seconds,
         // something is wrong. So kill the connection
         if(millis() > timeout_millis){
-          Serial.println("Force Client stop!");  
+          logger_fast(LOG_HTTP, LOG_WARN, "Force Client stop!");
           client.stop();
         } 
         // if there's bytes to read from the client,
         if (client.available()) {             
           char c = client.read();            
-          Serial.write(c);    
           // if the byte is a newline character             
           if (c == '\n') {    
             // two newline characters in a row (empty line) are indicating
@@ -235,60 +425,208 @@ void check_webserver(){
               switch (html_get_request)
               {
                 case GET_index_page: {
-                  client.println("HTTP/1.1 200 OK");
-                  client.println("Content-type:text/html");
-                  client.println();
-                  client.write_P(index_html, sizeof(index_html));
+                  send_progmem(client, "text/html", index_html, sizeof(index_html));
                   break;
                 }
                 case GET_favicon: {
-                  client.println("HTTP/1.1 200 OK");
-                  client.println("Content-type:image/x-icon");
-                  client.println();
-                  client.write_P(electric_favicon, sizeof(electric_favicon));
+                  send_progmem(client, "image/x-icon", electric_favicon, sizeof(electric_favicon));
                   break;
                 }
                 case GET_logo: {
-                  client.println("HTTP/1.1 200 OK");
-                  client.println("Content-type:image/jpeg");
-                  client.println();
-                  client.write_P(electric_logo, sizeof(electric_logo));
+                  send_progmem(client, "image/jpeg", electric_logo, sizeof(electric_logo));
                   break;
                 }
                 case GET_screenshot: {              
-                  client.println("HTTP/1.1 200 OK");
-                  client.println("Content-type:image/bmp");
-                  client.println();
-                  M5Screen2bmp(client);
+                  // queued, served from a shared snapshot by screenshot_service()
+                  keep_connection = screenshot_request(client, if_none_match);
                   break;
                 }
                 case GET_refresh_img: {              
-                  client.println("HTTP/1.1 200 OK");
-                  client.println("Content-type:image/png");
-                  client.println();
-                  client.write_P(refresh_img, sizeof(refresh_img));
+                  send_progmem(client, "image/png", refresh_img, sizeof(refresh_img));
                   break;
                 }
                 case GET_button_img: {              
-                  client.println("HTTP/1.1 200 OK");
-                  client.println("Content-type:image/png");
-                  client.println();
-                  client.write_P(control_button_img, sizeof(control_button_img));
+                  send_progmem(client, "image/png", control_button_img, sizeof(control_button_img));
+                  break;
+                }
+                case GET_live_page: {
+                  send_progmem(client, "text/html", live_html, sizeof(live_html));
+                  break;
+                }
+                case GET_events: {
+                  if(events_accept(client, events_interval)){
+                    keep_connection = true;
+                  } else {
+                    http_send_text(client, 503, "Service Unavailable", "no free event stream slot");
+                  }
+                  break;
+                }
+                case POST_api_button: {
+                  // queue all buttons of the request, in the given order
+                  uint32_t press_id = button_queue_head;
+                  bool queued = api_buttons[0] != 0;
+                  for(int i=0; api_buttons[i] && queued; i++)
+                    queued = button_queue_push(api_buttons[i]);
+                  if(!queued){
+                    http_send_text(client, 400, "Bad Request", "unknown button or queue full");
+                  } else if(api_wait){
+                    // the answer is sent when the last button press has been drawn
+                    press_id = button_queue_head - 1;
+                    if(button_wait(client, press_id))
+                      keep_connection = true;
+                    else
+                      http_send_text(client, 503, "Service Unavailable", "too many waiting clients");
+                  } else {
+                    http_send_text(client, 204, "No Content", NULL);
+                  }
+                  break;
+                }
+                case GET_api_frame: {
+                  // frame cap and CPU usage, ?fps=<n> sets a new frame cap
+                  if(api_fps > 0)
+                    frame_set_fps(constrain(api_fps, 1, 60));
+                  char body[224];
+                  snprintf(body, sizeof(body),
+                           "{\"fps_cap\":%u,\"fps\":%.1f,\"cpu\":%.1f,\"render\":%.1f,"
+                           "\"skipped\":%u,\"over_budget\":%u,\"jitter_us\":%u,\"render_avg_us\":%u}",
+                           (unsigned)frame_fps(), frame_stats.fps, frame_stats.cpu_percent,
+                           frame_stats.render_percent, (unsigned)frame_stats.skipped,
+                           (unsigned)frame_stats.over_budget, (unsigned)frame_stats.jitter_us,
+                           (unsigned)frame_stats.render_avg_us);
+                  http_send_json(client, body);
+                  break;
+                }
+                case GET_api_storage: {
+                  // state of the background capture writer
+                  char body[256];
+                  storage_status_json(body, sizeof(body));
+                  http_send_json(client, body);
+                  break;
+                }
+                case GET_api_retention: {
+                  // captures kept on the SD card and their quota
+                  char body[256];
+                  retention_status_json(body, sizeof(body));
+                  http_send_json(client, body);
+                  break;
+                }
+                case POST_api_burst: {
+                  if(burst_start(api_burst_frames, api_burst_seconds * 1000, api_burst_delta, api_burst_sd)){
+                    char body[256];
+                    burst_status_json(body, sizeof(body));
+                    http_send_json(client, body);
+                  } else {
+                    http_send_text(client, 409, "Conflict", "burst running or no memory");
+                  }
+                  break;
+                }
+                case GET_api_burst: {
+                  char body[256];
+                  burst_status_json(body, sizeof(body));
+                  http_send_json(client, body);
+                  break;
+                }
+                case GET_burst_file: {
+                  keep_connection = burst_download(client);
+                  break;
+                }
+                case GET_api_transcode: {
+                  // background transcoding of the captures to QOI
+                  char body[256];
+                  transcode_status_json(body, sizeof(body));
+                  http_send_json(client, body);
+                  break;
+                }
+                case GET_file: {
+                  keep_connection = file_server_request(client, *file_fs, file_path, http_range,
+                                                        http_if_range, if_none_match);
+                  break;
+                }
+                case GET_api_files: {
+                  // downloads of the stored files
+                  char body[256];
+                  file_server_status_json(body, sizeof(body));
+                  http_send_json(client, body);
+                  break;
+                }
+                case GET_api_dedup: {
+                  // hit rates of the frame deduplication
+                  char body[320];
+                  frame_hash_status_json(body, sizeof(body));
+                  http_send_json(client, body);
+                  break;
+                }
+                case GET_websocket: {
+                  if(websocket_key[0] && ws_accept(client, websocket_key)){
+                    keep_connection = true;
+                  } else {
+                    http_send_text(client, 503, "Service Unavailable", "no free live view slot");
+                  }
                   break;
                 }
                 default:
-                  client.println("HTTP/1.1 404 Not Found");
-                  client.println("Content-type:text/html");
-                  client.println();
-                  client.print("404 Page not found.<br>");
+                  http_send_text(client, 404, "Not Found", "404 Page not found.");
                   break;
               }
-              // The HTTP response ends with another blank line:
-              client.println();
               // break out of the while loop:
               break;
             } else {    // if a newline is found
+              // the request line is logged, all header lines only in debug level
+              logger_write(LOG_HTTP, currentLine.startsWith("GET ") ? LOG_INFO : LOG_DEBUG,
+                           "%s", currentLine.c_str());
               // Analyze the currentLine:
+              // remember the key of a WebSocket upgrade request
+              if(strncasecmp(currentLine.c_str(), "Sec-WebSocket-Key:", 18) == 0){
+                String key = currentLine.substring(18);
+                key.trim();
+                strlcpy(websocket_key, key.c_str(), sizeof(websocket_key));
+              }
+              // ETag of the image the client has already (GET /screenshot.bmp)
+              if(strncasecmp(currentLine.c_str(), "If-None-Match:", 14) == 0){
+                String etag = currentLine.substring(14);
+                etag.trim();
+                strlcpy(if_none_match, etag.c_str(), sizeof(if_none_match));
+              }
+              // byte range of a file download (resume), e.g. "Range: bytes=1000-"
+              if(strncasecmp(currentLine.c_str(), "Range:", 6) == 0){
+                String range = currentLine.substring(6);
+                range.trim();
+                strlcpy(http_range, range.c_str(), sizeof(http_range));
+              }
+              if(strncasecmp(currentLine.c_str(), "If-Range:", 9) == 0){
+                String if_range = currentLine.substring(9);
+                if_range.trim();
+                strlcpy(http_if_range, if_range.c_str(), sizeof(http_if_range));
+              }
+              // detect the button API requests:
+              // POST /api/button/A            single button press
+              // POST /api/button/ACB?wait=1   several presses, answer after the frame is drawn
+              if(currentLine.startsWith("POST /api/button/")){
+                html_get_request = POST_api_button;
+                int i = 0;
+                const char *p = currentLine.c_str() + 17;
+                while(*p == 'A' || *p == 'B' || *p == 'C'){
+                  if(i < BUTTON_QUEUE_SIZE)
+                    api_buttons[i++] = *p;
+                  p++;
+                }
+                // anything else than A, B or C is an error
+                if(*p != ' ' && *p != '?')
+                  i = 0;
+                api_buttons[i] = 0;
+                api_wait = currentLine.indexOf("wait=1") > 0;
+              } else if(currentLine.startsWith("POST /api/burst")){
+                // POST /api/burst?frames=60&seconds=2&delta=0&sd=0
+                html_get_request = POST_api_burst;
+                int pos = currentLine.indexOf("frames=");
+                api_burst_frames = (pos > 0) ? currentLine.substring(pos+7).toInt() : 0;
+                pos = currentLine.indexOf("seconds=");
+                api_burst_seconds = (pos > 0) ? currentLine.substring(pos+8).toInt() : 0;
+                api_burst_delta = currentLine.indexOf("delta=0") < 0;
+                api_burst_sd = currentLine.indexOf("sd=0") < 0;
+              } else if(currentLine.startsWith("POST /")){
+                html_get_request = GET_unknown;
+              }
               // detect the specific GET requests:
               if(currentLine.startsWith("GET /")){
                 html_get_request = GET_unknown;
@@ -316,19 +654,80 @@ void check_webserver(){
                 if(currentLine.startsWith("GET /button.png")){
                   html_get_request = GET_button_img;
                 }
+                // if the live view page is requested
+                if(currentLine.startsWith("GET /live")){
+                  html_get_request = GET_live_page;
+                }
+                // if the live view WebSocket is requested
+                if(currentLine.startsWith("GET /ws ")){
+                  html_get_request = GET_websocket;
+                }
+                // if the event stream is requested
+                if(currentLine.startsWith("GET /events")){
+                  html_get_request = GET_events;
+                  events_interval = EVENTS_DEFAULT_INTERVAL_MS;
+                  int pos = currentLine.indexOf("interval=");
+                  long interval = (pos > 0) ? currentLine.substring(pos+9).toInt() : 0;
+                  if(interval > 0)
+                    events_interval = interval;
+                }
+                // frame statistics, optionally with a new frame cap
+                if(currentLine.startsWith("GET /api/frame")){
+                  html_get_request = GET_api_frame;
+                  int pos = currentLine.indexOf("fps=");
+                  api_fps = (pos > 0) ? currentLine.substring(pos+4).toInt() : 0;
+                }
+                // state of the capture writer
+                if(currentLine.startsWith("GET /api/storage")){
+                  html_get_request = GET_api_storage;
+                }
+                // captures kept on the SD card
+                if(currentLine.startsWith("GET /api/retention")){
+                  html_get_request = GET_api_retention;
+                }
+                // state of the burst capture and the archive of the last burst
+                if(currentLine.startsWith("GET /api/burst")){
+                  html_get_request = GET_api_burst;
+                }
+                if(currentLine.startsWith("GET /burst.m5a")){
+                  html_get_request = GET_burst_file;
+                }
+                // frames that were not stored or sent again (unchanged screen)
+                if(currentLine.startsWith("GET /api/dedup")){
+                  html_get_request = GET_api_dedup;
+                }
+                // captures transcoded to QOI
+                if(currentLine.startsWith("GET /api/transcode")){
+                  html_get_request = GET_api_transcode;
+                }
+                // files of the SD card and the SPIFFS, e.g. GET /sd/cap/0000/000017_btnA.qoi
+                if(currentLine.startsWith("GET /sd/")){
+                  html_get_request = GET_file;
+                  file_fs = &SD;
+                  url_path(currentLine.c_str() + 7, file_path, sizeof(file_path));
+                }
+                if(currentLine.startsWith("GET /spiffs/")){
+                  html_get_request = GET_file;
+                  file_fs = &SPIFFS;
+                  url_path(currentLine.c_str() + 11, file_path, sizeof(file_path));
+                }
+                // state of the file downloads
+                if(currentLine.startsWith("GET /api/files")){
+                  html_get_request = GET_api_files;
+                }
                 // if the control-button A was pressed on the HTML page
                 if(currentLine.startsWith("GET /button-A")){
-                  Control_A_pressed = true;
+                  button_queue_push('A');
                   html_get_request = GET_index_page;
                 }
                 // if the control-button B was pressed on the HTML page
                 if(currentLine.startsWith("GET /button-B")){
-                  Control_B_pressed = true;
+                  button_queue_push('B');
                   html_get_request = GET_index_page;
                 }
                 // if the control-button C was pressed on the HTML page
                 if(currentLine.startsWith("GET /button-C")){
-                  Control_C_pressed = true;
+                  button_queue_push('C');
                   html_get_request = GET_index_page;
                 }
               }
@@ -342,195 +741,165 @@ void check_webserver(){
         }
       }
       // close the connection:
-      client.stop();
-      Serial.println("Client Disconnected.");
+      if(!keep_connection)
+        client.stop();
+      logger_fast(LOG_HTTP, LOG_DEBUG, "Client Disconnected.");
     }
   }
 }
 
 
 /***************************************************************************************
-* Function name:          M5Screen2ppm
-* Description:            Dump the screen to a ppm image File
-* Image file format:      .ppm
-* return value:           true:  succesfully wrote screen to file
-*                         false: unabel to open file for writing
-* example for screen capture onto SD-Card: 
-*                         M5Screen2ppm(SD, "/screen.ppm");
+* Function name:          send_progmem
+* Description:            send a complete response with a body from the flash memory
+*                         The header and the body are sent in full TCP segments.
 ***************************************************************************************/
-bool M5Screen2ppm(fs::FS &fs, const char * path){
-  // Open file for writing
-  // The existing image file will be replaced
-  File file = fs.open(path, FILE_WRITE);
-  if(file){
-    int image_height = M5.Lcd.height();
-    int image_width = M5.Lcd.width();
-    // write PPM file header
-    //    P6 - magical numer = file format indicator
-    //          P6 =  Binary (raw) format
-    //                16777216 colors (0–255 for each RGB channel)
-    //    \n - CR = Blank space (Spaceholder)
-    //    w h - width and heigt decimal in ASCII (Space-seperated)
-    //    \n - CR = Blank space (Spaceholder)
-    //    cmax - maximum color value (decimal in ASCII)
-    //    \n - CR = Blank space (Spaceholder)
-    file.printf("P6\n%d %d\n255\n", image_width, image_height);
-    // To keep the required memory low, the image is captured line by line
-    unsigned char line_data[image_width*3];
-    // The function readRectRGB reads a screen area and returns the 
-    // RGB 8 bit colour values of each pixel
-    for(int y=0; y<image_height; y++){
-      // get one line of the screen content
-      M5.Lcd.readRectRGB(0, y, image_width, 1, line_data);
-      // write the line to the file
-      file.write(line_data, image_width*3);
+void send_progmem(WiFiClient &client, const char *content_type, const char *data, size_t len){
+  http_response.begin(client);
+  http_response.status(200, "OK");
+  http_response.header("Content-type", content_type);
+  http_response.header("Content-Length", (unsigned long)len);
+  http_response.end_headers();
+  http_response.write_P(data, len);
+  http_response.end();
+}
+
+
+/***************************************************************************************
+* Function name:          url_path
+* Description:            copy the path of a request line up to the query or the end
+*                         and decode the %XX escapes (e.g. %20 for a space)
+***************************************************************************************/
+void url_path(const char *url, char *path, size_t size){
+  size_t n = 0;
+  while(*url && *url != ' ' && *url != '?' && n + 1 < size){
+    if(url[0] == '%' && isxdigit(url[1]) && isxdigit(url[2])){
+      char hex[3] = { url[1], url[2], 0 };
+      path[n++] = (char) strtol(hex, NULL, 16);
+      url += 3;
+    } else {
+      path[n++] = *url++;
     }
-    file.close();
-    return true;
   }
-  return false;
+  path[n] = 0;
 }
 
 
 /***************************************************************************************
-* Function name:          M5Screen2bmp
-* Description:            Dump the screen to a bmp image File
-* Image file format:      .bmp
-* return value:           true:  succesfully wrote screen to file
-*                         false: unabel to open file for writing
-* example for screen capture onto SD-Card: 
-*                         M5Screen2bmp(SD, "/screen.bmp");
-* inspired by: https://stackoverflow.com/a/58395323
+* Function name:          button_queue_push
+* Description:            queue a button press from the Web interface
+* return value:           false if the queue is full or the button is unknown
 ***************************************************************************************/
-bool M5Screen2bmp(fs::FS &fs, const char * path){
-  // Open file for writing
-  // The existing image file will be replaced
-  File file = fs.open(path, FILE_WRITE);
-  if(file){
-    // M5Stack:      TFT_WIDTH = 240 / TFT_HEIGHT = 320
-    // M5StickC:     TFT_WIDTH =  80 / TFT_HEIGHT = 160
-    // M5StickCplus: TFT_WIDTH =  135 / TFT_HEIGHT = 240
-    int image_height = M5.Lcd.height();
-    int image_width = M5.Lcd.width();
-    // horizontal line must be a multiple of 4 bytes long
-    // add padding to fill lines with 0
-    const uint pad=(4-(3*image_width)%4)%4;
-    // header size is 54 bytes:
-    //    File header = 14 bytes
-    //    Info header = 40 bytes
-    uint filesize=54+(3*image_width+pad)*image_height; 
-    unsigned char header[54] = { 
-      'B','M',  // BMP signature (Windows 3.1x, 95, NT, …)
-      0,0,0,0,  // image file size in bytes
-      0,0,0,0,  // reserved
-      54,0,0,0, // start of pixel array
-      40,0,0,0, // info header size
-      0,0,0,0,  // image width
-      0,0,0,0,  // image height
-      1,0,      // number of color planes
-      24,0,     // bits per pixel
-      0,0,0,0,  // compression
-      0,0,0,0,  // image size (can be 0 for uncompressed images)
-      0,0,0,0,  // horizontal resolution (dpm)
-      0,0,0,0,  // vertical resolution (dpm)
-      0,0,0,0,  // colors in color table (0 = none)
-      0,0,0,0 };// important color count (0 = all colors are important)
-    // fill filesize, width and heigth in the header array
-    for(uint i=0; i<4; i++) {
-        header[ 2+i] = (char)((filesize>>(8*i))&255);
-        header[18+i] = (char)((image_width   >>(8*i))&255);
-        header[22+i] = (char)((image_height  >>(8*i))&255);
-    }
-    // write the header to the file
-    file.write(header, 54);
-    
-    // To keep the required memory low, the image is captured line by line
-    unsigned char line_data[image_width*3+pad];
-    // initialize padded pixel with 0 
-    for(int i=(image_width-1)*3; i<(image_width*3+pad); i++){
-      line_data[i]=0;
-    }
-    // The coordinate origin of a BMP image is at the bottom left.
-    // Therefore, the image must be read from bottom to top.
-    for(int y=image_height; y>0; y--){
-      // get one line of the screen content
-      M5.Lcd.readRectRGB(0, y-1, image_width, 1, line_data);
-      // BMP color order is: Blue, Green, Red
-      // return values from readRectRGB is: Red, Green, Blue
-      // therefore: R und B need to be swapped
-      for(int x=0; x<image_width; x++){
-        unsigned char r_buff = line_data[x*3];
-        line_data[x*3] = line_data[x*3+2];
-        line_data[x*3+2] = r_buff;
-      }
-      // write the line to the file
-      file.write(line_data, (image_width*3)+pad);
+bool button_queue_push(char button){
+  if(button != 'A' && button != 'B' && button != 'C')
+    return false;
+  if(button_queue_head - button_queue_tail >= BUTTON_QUEUE_SIZE)
+    return false;
+  button_queue[button_queue_head % BUTTON_QUEUE_SIZE] = button;
+  button_queue_head++;
+  return true;
+}
+
+
+char button_queue_pop(){
+  if(button_queue_tail == button_queue_head)
+    return 0;
+  char button = button_queue[button_queue_tail % BUTTON_QUEUE_SIZE];
+  button_queue_tail++;
+  return button;
+}
+
+
+/***************************************************************************************
+* Function name:          button_wait
+* Description:            keep the client until the button press with the given id
+*                         has been handled and drawn
+* return value:           false if all waiter slots are in use
+***************************************************************************************/
+bool button_wait(WiFiClient &client, uint32_t press_id){
+  for(int i=0; i<BUTTON_MAX_WAITERS; i++){
+    button_waiter_t &w = button_waiters[i];
+    if(!w.active){
+      w.client = client;
+      w.active = true;
+      w.press_id = press_id;
+      w.deadline = millis() + BUTTON_WAIT_TIMEOUT_MS;
+      return true;
     }
-    file.close();
-    return true;
   }
   return false;
 }
 
+
 /***************************************************************************************
-* Function name:          M5Screen2bmp
-* Description:            Dump the screen to a WiFi client
-* Image file format:      Content-type:image/bmp
-* return value:           always true
+* Function name:          service_button_waiters
+* Description:            answer waiting clients with the generation of the new frame
+*                         Response body: {"generation":1234}
 ***************************************************************************************/
-bool M5Screen2bmp(WiFiClient &client){
-  int image_height = M5.Lcd.height();
-  int image_width = M5.Lcd.width();
-  const uint pad=(4-(3*image_width)%4)%4;
-  uint filesize=54+(3*image_width+pad)*image_height; 
-  unsigned char header[54] = { 
-    'B','M',  // BMP signature (Windows 3.1x, 95, NT, …)
-    0,0,0,0,  // image file size in bytes
-    0,0,0,0,  // reserved
-    54,0,0,0, // start of pixel array
-    40,0,0,0, // info header size
-    0,0,0,0,  // image width
-    0,0,0,0,  // image height
-    1,0,      // number of color planes
-    24,0,     // bits per pixel
-    0,0,0,0,  // compression
-    0,0,0,0,  // image size (can be 0 for uncompressed images)
-    0,0,0,0,  // horizontal resolution (dpm)
-    0,0,0,0,  // vertical resolution (dpm)
-    0,0,0,0,  // colors in color table (0 = none)
-    0,0,0,0 };// important color count (0 = all colors are important)
-  // fill filesize, width and heigth in the header array
-  for(uint i=0; i<4; i++) {
-      header[ 2+i] = (char)((filesize>>(8*i))&255);
-      header[18+i] = (char)((image_width   >>(8*i))&255);
-      header[22+i] = (char)((image_height  >>(8*i))&255);
+void service_button_waiters(){
+  for(int i=0; i<BUTTON_MAX_WAITERS; i++){
+    button_waiter_t &w = button_waiters[i];
+    if(!w.active)
+      continue;
+    // the press is handled as soon as the queue tail moved past its id
+    if((int32_t)(button_queue_tail - w.press_id) > 0){
+      char body[32];
+      snprintf(body, sizeof(body), "{\"generation\":%u}", (unsigned)screen_generation);
+      http_send_json(w.client, body);
+    } else if((long)(millis() - w.deadline) >= 0){
+      http_send_text(w.client, 504, "Gateway Timeout", "button press not handled in time");
+    } else {
+      continue;
+    }
+    w.client.stop();
+    w.active = false;
   }
-  // write the header to the file
-  client.write(header, 54);
-  
-  // To keep the required memory low, the image is captured line by line
-  unsigned char line_data[image_width*3+pad];
-  // initialize padded pixel with 0 
-  for(int i=(image_width-1)*3; i<(image_width*3+pad); i++){
-    line_data[i]=0;
+}
+
+
+/***************************************************************************************
+* Function name:          capture_done
+* Description:            completion callback of the button captures
+***************************************************************************************/
+void capture_done(const char *path, bool ok, void *arg){
+  events_capture(path, ok);
+}
+
+
+/***************************************************************************************
+* Function name:          capture_button
+* Description:            capture the screen into the next numbered file
+*                         (source "btnA" for the button, "webA" for the web interface)
+*                         Captures of the buttons on the device are evicted after the
+*                         captures requested over the network.
+***************************************************************************************/
+void capture_button(char button, bool web){
+  char source[8];
+  snprintf(source, sizeof(source), "%s%c", web ? "web" : "btn", button);
+  char path[CAPTURE_NAME_LEN];
+  capture_name_next(source, path, sizeof(path));
+  // reported by capture_done()
+  storage_capture(SD, path, STORAGE_BMP, capture_done, NULL,
+                  web ? RETENTION_PRIORITY_LOW : RETENTION_PRIORITY_HIGH);
+}
+
+
+/***************************************************************************************
+* Function name:          handle_ws_command
+* Description:            handle a command from a live view client
+***************************************************************************************/
+void handle_ws_command(uint8_t command, uint8_t argument){
+  if(command == WS_CMD_BUTTON){
+    if(argument == 'A') button_queue_push('A');
+    if(argument == 'B') button_queue_push('B');
+    if(argument == 'C') button_queue_push('C');
   }
-  // The coordinate origin of a BMP image is at the bottom left.
-  // Therefore, the image must be read from bottom to top.
-  for(int y=image_height; y>0; y--){
-    // get one line of the screen content
-    M5.Lcd.readRectRGB(0, y-1, image_width, 1, line_data);
-    // BMP color order is: Blue, Green, Red
-    // return values from readRectRGB is: Red, Green, Blue
-    // therefore: R und B need to be swapped
-    for(int x=0; x<image_width; x++){
-      unsigned char r_buff = line_data[x*3];
-      line_data[x*3] = line_data[x*3+2];
-      line_data[x*3+2] = r_buff;
-    }
-    // write the line to the file
-    client.write(line_data, (image_width*3)+pad);
+  if(command == WS_CMD_GAUGE && argument <= 100){
+    gauge_val = argument;
+    // drawn by the next frames
+    anim_set_target(needle, gauge_val);
+    next_millis = millis() + 1000;
   }
-  return true;
 }
 
 
@@ -543,8 +912,7 @@ boolean connect_Wifi(){
   // Establish connection to the specified network until success.
   // Important to disconnect in case that there is a valid connection
   WiFi.disconnect();
-  Serial.print("Connecting to ");
-  Serial.println(ssid);
+  logger_write(LOG_WIFI, LOG_INFO, "Connecting to %s", ssid);
   delay(1500);
   //Start connecting (done by the ESP in the background)
   WiFi.begin(ssid, password);
@@ -560,92 +928,64 @@ boolean connect_Wifi(){
     n_trials++;
     switch(wifi_Status){
       case WL_NO_SSID_AVAIL:
-          Serial.println("[ERR] WIFI SSID not available");
+          logger_fast(LOG_WIFI, LOG_ERR, "WIFI SSID not available");
           break;
       case WL_CONNECT_FAILED:
-          Serial.println("[ERR] WIFI Connection failed");
+          logger_fast(LOG_WIFI, LOG_ERR, "WIFI Connection failed");
           break;
       case WL_CONNECTION_LOST:
-          Serial.println("[ERR] WIFI Connection lost");
+          logger_fast(LOG_WIFI, LOG_ERR, "WIFI Connection lost");
           break;
       case WL_DISCONNECTED:
-          Serial.println("[STATE] WiFi disconnected");
+          logger_fast(LOG_WIFI, LOG_DEBUG, "WiFi disconnected");
           break;
       case WL_IDLE_STATUS:
-          Serial.println("[STATE] WiFi idle status");
+          logger_fast(LOG_WIFI, LOG_DEBUG, "WiFi idle status");
           break;
       case WL_SCAN_COMPLETED:
-          Serial.println("[OK] WiFi scan completed");
+          logger_fast(LOG_WIFI, LOG_INFO, "WiFi scan completed");
           break;
       case WL_CONNECTED:
-          Serial.println("[OK] WiFi connected");
+          logger_fast(LOG_WIFI, LOG_INFO, "WiFi connected");
           break;
       default:
-          Serial.println("[ERR] WIFI unknown Status");
+          logger_fast(LOG_WIFI, LOG_ERR, "WIFI unknown Status");
           break;
     }
     delay(500);
   }
   if(wifi_Status == WL_CONNECTED){
     // if connected
-    Serial.print("IP address: ");
-    Serial.println(WiFi.localIP());
+    logger_write(LOG_WIFI, LOG_INFO, "IP address: %s", WiFi.localIP().toString().c_str());
     return true;
   } else {
     // if not connected
-    Serial.println("[ERR] unable to connect Wifi");
+    logger_fast(LOG_WIFI, LOG_ERR, "unable to connect Wifi");
     return false;
   }
 }
 
 
 /***************************************************************************************
-* Function name:          draw_gauge
-* Description:            Draw a nice gauge on the screen with two indicators
+* Function name:          draw_dashboard
+* Description:            show the values on the dashboard
 * parameter:              val_1 = value between 0 and 100 for the red arrow
 *                         val_2 = value between 0 and 100 for the green line
 * Note:                   val_2 is optional
                           values below 0 will not be displayed (hide the arrow)
 * example for a gauge with then red arrow at 45% and the freen line at 80%: 
-*                         draw_gauge(45,80);
+*                         draw_dashboard(45,80);
+* Note:                   The first call draws the whole dashboard. After that, only
+*                         the widgets with changed values are redrawn (see widgets.h).
+*                         Call widgets_invalidate() after drawing something else on
+*                         the screen.
 ***************************************************************************************/
-void draw_gauge(float val_1, float val_2 = -1.0){
-  // fill screen with gauge image
-  M5.Lcd.pushImage(0, 0, 320, 240, gauge_pic);
-  
-  // unrotated arrow is pointing on the x-axis to the right
-  int xpos1 = 80.0;
-  int ypos1 = 0.0;
-  // with the origin in the center of the screen
-  int xpos0 = (int)(M5.Lcd.width()/2);
-  int ypos0 = (int)(M5.Lcd.height()/2);
-  // rotate the endpoint for the thin green line
-  if(val_2 >= 0 && val_2 <= 100){
-    float angle = (239.0-((val_2/100)*298)) * DEG2RAD;
-    int xpos2 = (int) roundf(xpos1 * cos(angle) + ypos1 * sin(angle)) + xpos0;
-    int ypos2 = (int) roundf(-1.0*xpos1 * sin(angle) + ypos1 * cos(angle)) + ypos0;
-    M5.Lcd.drawLine(xpos0, ypos0, xpos2, ypos2, TFT_GREEN);
-  }
-  if(val_1 >= 0 && val_1 <= 100){
-    // calculate the endpoint of the red arrow after rotation
-    // 0%   = 239 deg
-    // 100% = -60 deg
-    float angle = (239.0-((val_1/100)*298)) * DEG2RAD;
-    int xpos2 = (int) roundf(xpos1 * cos(angle) + ypos1 * sin(angle)) + xpos0;
-    int ypos2 = (int) roundf(-1.0*xpos1 * sin(angle) + ypos1 * cos(angle)) + ypos0;
-    // this will be the new origin, so translate the centerpoint
-    xpos1 = xpos0 - xpos2;
-    ypos1 = ypos0 - ypos2;
-    // now rotate the original centerpoint by +4.5 and -4.5 deg to get the triangle
-    angle = (float) -4.5 * DEG2RAD;
-    int xpos3 = xpos2 + (int) roundf(xpos1 * cos(angle) + ypos1 * sin(angle));
-    int ypos3 = ypos2 + (int) roundf(-1.0*xpos1 * sin(angle) + ypos1 * cos(angle));
-    angle = (float) 4.5 * DEG2RAD;
-    int xpos4 = xpos2 + (int) roundf(xpos1 * cos(angle) + ypos1 * sin(angle));
-    int ypos4 = ypos2 + (int) roundf(-1.0*xpos1 * sin(angle) + ypos1 * cos(angle));
-    M5.Lcd.fillTriangle(xpos2, ypos2, xpos3, ypos3, xpos4, ypos4, TFT_RED);
-    // draw the center circle
-    M5.Lcd.fillCircle(xpos0, ypos0, 10, TFT_RED);
-    M5.Lcd.fillCircle(xpos0, ypos0, 2, TFT_BLACK);
-  }
+void draw_dashboard(float val_1, float val_2 = -1.0){
+  widget_set(DASH_GAUGE, val_1);
+  widget_set2(DASH_GAUGE, val_2);
+  // the readout and the event stream show the target value
+  widget_set(DASH_VALUE, gauge_val);
+  events_gauge(gauge_val);
+  widgets_update();
+  dashboard_visible = true;
 }
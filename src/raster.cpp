@@ -0,0 +1,237 @@
+/******************************************************************************
+ * raster.cpp
+ * Anti-aliased fixed-point rasterizer for RGB565 pixel buffers.
+ * See raster.h for a description.
+ *
+ * Lines and triangles are convex polygons given by their edges. For every
+ * pixel center in the bounding box, the signed distance d to each edge
+ * (positive inside) is updated incrementally with one addition per edge
+ * and pixel. Each edge covers clamp(d + 0.5, 0, 1) of the pixel, the
+ * product of these values is the coverage of the pixel. Compared with a
+ * 16x16 supersampled reference, the mean error of the edge pixels is
+ * about 2%, the worst case (very acute corners) about 24%.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "raster.h"
+
+// fractional bits of the edge normals
+#define RASTER_NORMAL_BITS 12
+// color blending with 5 bit alpha
+#define RASTER_ALPHA_MAX 32
+
+struct raster_edge_t {
+  // unit normal pointing into the shape (Q12)
+  int32_t a, b;
+  // point on the edge (fixed-point coordinates)
+  int32_t x, y;
+  // distance of the edge from that point (outwards, fixed-point)
+  int32_t offset;
+};
+
+
+static uint32_t isqrt64(uint64_t v){
+  uint64_t result = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+  while(bit > v)
+    bit >>= 2;
+  while(bit){
+    if(v >= result + bit){
+      v -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint32_t)result;
+}
+
+
+// unit vector in the direction of dx,dy (Q12), false if the length is 0
+static bool unit_vector(int32_t dx, int32_t dy, int32_t &ux, int32_t &uy){
+  uint32_t length = isqrt64((int64_t)dx*dx + (int64_t)dy*dy);
+  if(length == 0)
+    return false;
+  ux = ((int64_t)dx << RASTER_NORMAL_BITS) / length;
+  uy = ((int64_t)dy << RASTER_NORMAL_BITS) / length;
+  return true;
+}
+
+
+inline uint16_t swap16(uint16_t c) { return (c >> 8) | (c << 8); }
+
+
+/***************************************************************************************
+* Function name:          raster_blend
+* Description:            blend two RGB565 colors
+*                         The three channels are spread over 32 bit (G in the upper
+*                         half) and blended with two multiplications.
+***************************************************************************************/
+uint16_t raster_blend(uint16_t fg, uint16_t bg, uint8_t alpha){
+  uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+  uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+  uint32_t result = ((f * alpha + b * (RASTER_ALPHA_MAX - alpha)) >> 5) & 0x07E0F81F;
+  return (uint16_t)(result | (result >> 16));
+}
+
+
+static inline void blend_pixel(const RasterTarget &t, int x, int y, uint16_t color, int coverage){
+  // coverage 0..256 -> alpha 0..32
+  uint8_t alpha = (coverage + 4) >> 3;
+  if(alpha == 0)
+    return;
+  uint16_t *p = t.pixels + (y - t.y) * t.stride + (x - t.x);
+  if(alpha >= RASTER_ALPHA_MAX){
+    *p = t.swapped ? swap16(color) : color;
+    return;
+  }
+  uint16_t bg = t.swapped ? swap16(*p) : *p;
+  uint16_t result = raster_blend(color, bg, alpha);
+  *p = t.swapped ? swap16(result) : result;
+}
+
+
+// clip a bounding box (fixed-point, inclusive) to the target, pixel bounds x1/y1 exclusive
+static bool clip_box(const RasterTarget &t, int32_t fx0, int32_t fy0, int32_t fx1, int32_t fy1,
+                     int &x0, int &y0, int &x1, int &y1){
+  x0 = max((int)(fx0 >> RASTER_SUBPIXEL), (int)t.x);
+  y0 = max((int)(fy0 >> RASTER_SUBPIXEL), (int)t.y);
+  x1 = min((int)(fx1 >> RASTER_SUBPIXEL) + 1, t.x + t.w);
+  y1 = min((int)(fy1 >> RASTER_SUBPIXEL) + 1, t.y + t.h);
+  return x1 > x0 && y1 > y0;
+}
+
+
+/***************************************************************************************
+* Function name:          fill_convex
+* Description:            fill a convex polygon given by its edges within the box
+*                         x0..x1, y0..y1 (pixels, x1 and y1 exclusive)
+***************************************************************************************/
+static void fill_convex(const RasterTarget &t, const raster_edge_t *edges, int n,
+                        int x0, int y0, int x1, int y1, uint16_t color){
+  // distances in Q(RASTER_SUBPIXEL + RASTER_NORMAL_BITS)
+  int32_t d[4];
+  int32_t step[4];
+  for(int i=0; i<n; i++)
+    step[i] = edges[i].a << RASTER_SUBPIXEL;
+  for(int y=y0; y<y1; y++){
+    int32_t cy = raster_center(y);
+    int32_t cx = raster_center(x0);
+    for(int i=0; i<n; i++){
+      const raster_edge_t &e = edges[i];
+      d[i] = e.a * (cx - e.x) + e.b * (cy - e.y) + (e.offset << RASTER_NORMAL_BITS);
+    }
+    for(int x=x0; x<x1; x++){
+      int coverage = RASTER_ONE;
+      for(int i=0; i<n; i++){
+        int c = (d[i] >> RASTER_NORMAL_BITS) + RASTER_ONE/2;
+        d[i] += step[i];
+        if(c <= 0)
+          coverage = 0;
+        else if(c < RASTER_ONE)
+          coverage = (coverage * c) >> RASTER_SUBPIXEL;
+      }
+      if(coverage <= 0)
+        continue;
+      blend_pixel(t, x, y, color, min(coverage, RASTER_ONE));
+    }
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          raster_line
+* Description:            anti-aliased line, drawn as a rectangle around the line
+***************************************************************************************/
+void raster_line(const RasterTarget &t, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                 int32_t width, uint16_t color){
+  int32_t ux, uy;
+  if(!unit_vector(x1 - x0, y1 - y0, ux, uy))
+    return;
+  int32_t half = width / 2;
+  raster_edge_t edges[4] = {
+    { -uy,  ux, x0, y0, half },   // left side
+    {  uy, -ux, x0, y0, half },   // right side
+    {  ux,  uy, x0, y0, half },   // start cap
+    { -ux, -uy, x1, y1, half },   // end cap
+  };
+  // the corners of the caps are up to half * (|ux| + |uy|) away from the end points
+  int32_t pad = (((int64_t)half * (abs(ux) + abs(uy))) >> RASTER_NORMAL_BITS) + 1;
+  int bx0, by0, bx1, by1;
+  if(clip_box(t, min(x0, x1) - pad, min(y0, y1) - pad, max(x0, x1) + pad, max(y0, y1) + pad,
+              bx0, by0, bx1, by1))
+    fill_convex(t, edges, 4, bx0, by0, bx1, by1, color);
+}
+
+
+/***************************************************************************************
+* Function name:          raster_triangle
+* Description:            anti-aliased filled triangle (any orientation)
+***************************************************************************************/
+void raster_triangle(const RasterTarget &t, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                     int32_t x2, int32_t y2, uint16_t color){
+  int64_t area = (int64_t)(x1 - x0) * (y2 - y0) - (int64_t)(y1 - y0) * (x2 - x0);
+  if(area == 0)
+    return;
+  const int32_t px[3] = { x0, x1, x2 };
+  const int32_t py[3] = { y0, y1, y2 };
+  raster_edge_t edges[3];
+  for(int i=0; i<3; i++){
+    int j = (i + 1) % 3;
+    int32_t ux, uy;
+    // the corners of a triangle with an area are different points
+    if(!unit_vector(px[j] - px[i], py[j] - py[i], ux, uy))
+      return;
+    // normal of the edge, turned to the inside
+    int32_t a = area > 0 ? -uy : uy;
+    int32_t b = area > 0 ? ux : -ux;
+    edges[i] = { a, b, px[i], py[i], 0 };
+  }
+  int bx0, by0, bx1, by1;
+  if(clip_box(t, min(x0, min(x1, x2)), min(y0, min(y1, y2)),
+              max(x0, max(x1, x2)), max(y0, max(y1, y2)), bx0, by0, bx1, by1))
+    fill_convex(t, edges, 3, bx0, by0, bx1, by1, color);
+}
+
+
+/***************************************************************************************
+* Function name:          raster_disc
+* Description:            anti-aliased filled circle
+*                         The distance to the circle is approximated by
+*                         (r*r - d*d) / 2r, which is exact at the edge.
+***************************************************************************************/
+void raster_disc(const RasterTarget &t, int32_t cx, int32_t cy, int32_t r, uint16_t color){
+  if(r <= 0)
+    return;
+  int bx0, by0, bx1, by1;
+  if(!clip_box(t, cx - r, cy - r, cx + r, cy + r, bx0, by0, bx1, by1))
+    return;
+  int64_t r2 = (int64_t)r * r;
+  for(int y=by0; y<by1; y++){
+    int32_t dy = raster_center(y) - cy;
+    for(int x=bx0; x<bx1; x++){
+      int32_t dx = raster_center(x) - cx;
+      int64_t d2 = (int64_t)dx * dx + (int64_t)dy * dy;
+      int64_t coverage = (r2 - d2) / (2 * r) + RASTER_ONE/2;
+      if(coverage <= 0)
+        continue;
+      blend_pixel(t, x, y, color, coverage > RASTER_ONE ? RASTER_ONE : (int)coverage);
+    }
+  }
+}
+
+
+void raster_fill_rect(const RasterTarget &t, int x, int y, int w, int h, uint16_t color){
+  int x0 = max(x, (int)t.x);
+  int y0 = max(y, (int)t.y);
+  int x1 = min(x + w, t.x + t.w);
+  int y1 = min(y + h, t.y + t.h);
+  if(t.swapped)
+    color = swap16(color);
+  for(int row=y0; row<y1; row++){
+    uint16_t *p = t.pixels + (row - t.y) * t.stride + (x0 - t.x);
+    for(int i=x0; i<x1; i++)
+      *p++ = color;
+  }
+}
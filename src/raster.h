@@ -0,0 +1,50 @@
+/******************************************************************************
+ * raster.h
+ * Anti-aliased fixed-point rasterizer for RGB565 pixel buffers.
+ *
+ * Lines, triangles and discs are drawn with an exact coverage estimate
+ * for every pixel (signed distance of the pixel center to the shape
+ * edges) and blended with the pixels that are already in the buffer.
+ * The buffer holds the background before the shapes are drawn, so the
+ * display is never read back.
+ *
+ * All coordinates are fixed-point with RASTER_SUBPIXEL fractional bits
+ * (1 pixel = 256). The pixel (x,y) covers the area x..x+1, y..y+1, its
+ * center is at x+0.5, y+0.5.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <Arduino.h>
+
+// fractional bits of the coordinates
+#define RASTER_SUBPIXEL 8
+#define RASTER_ONE (1 << RASTER_SUBPIXEL)
+
+// pixel buffer that covers the screen area x,y,w,h
+struct RasterTarget {
+  uint16_t *pixels;
+  int16_t x, y, w, h;
+  // distance between two rows in pixels
+  int16_t stride;
+  // true: pixels in LCD byte order (canvas buffer)
+  bool swapped;
+};
+
+// convert an integer pixel position to the center of that pixel
+inline int32_t raster_center(int v) { return (v << RASTER_SUBPIXEL) + RASTER_ONE/2; }
+
+// blend two RGB565 colors, alpha = 0 (bg) .. 32 (fg)
+uint16_t raster_blend(uint16_t fg, uint16_t bg, uint8_t alpha);
+// line with a width (all values fixed-point) and square caps of half the width
+void raster_line(const RasterTarget &t, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                 int32_t width, uint16_t color);
+void raster_triangle(const RasterTarget &t, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                     int32_t x2, int32_t y2, uint16_t color);
+void raster_disc(const RasterTarget &t, int32_t cx, int32_t cy, int32_t r, uint16_t color);
+// filled rectangle on whole pixels (no blending)
+void raster_fill_rect(const RasterTarget &t, int x, int y, int w, int h, uint16_t color);
+
+#endif
@@ -0,0 +1,531 @@
+/******************************************************************************
+ * retention.cpp
+ * Quota and eviction of the captures of the M5Stack Screen-Capture firmware.
+ * See retention.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "retention.h"
+#include "file_server.h"
+#include "file_writer.h"
+#include "logger.h"
+
+// record types of the journal
+#define RETENTION_RECORD_ADD 0x44444152  // "RADD"
+#define RETENTION_RECORD_DEL 0x4C454452  // "RDEL"
+// flag of an ADD record: the file replaces the file of the DEL record before
+// (e.g. transcoded), it keeps its place in the eviction order
+#define RETENTION_RECORD_REPLACE 0x01
+
+retention_stats_t retention_stats;
+
+struct retention_entry_t {
+  uint32_t size;
+  uint8_t priority;
+  bool live;
+  char path[CAPTURE_NAME_LEN];
+};
+
+struct retention_record_t {
+  uint32_t type;
+  uint32_t size;
+  uint8_t priority;
+  uint8_t reserved;
+  // sum of all other bytes, detects a torn record
+  uint16_t check;
+  char path[CAPTURE_NAME_LEN];
+};
+
+static fs::FS *retention_fs = NULL;
+static uint32_t quota_files;
+static uint64_t quota_bytes;
+static uint64_t fs_bytes;
+// index in the order of the captures, removed files stay in the array
+// (live = false) until it is compacted
+static retention_entry_t *entries = NULL;
+static uint32_t capacity;
+static uint32_t first;
+static uint32_t used;
+// entry of the file being written (not evicted by retention_evict()), -1 = none
+static int pending = -1;
+// file that is read by loop() (retention_hold), not evicted
+static char held[CAPTURE_NAME_LEN];
+static FileWriter journal_writer(4096);
+
+
+/***************************************************************************************
+* Function name:          record_check
+* Description:            checksum of a journal record
+***************************************************************************************/
+static uint16_t record_check(const retention_record_t &record){
+  const uint8_t *p = (const uint8_t *) &record;
+  uint16_t sum = 0;
+  for(size_t i=0; i<sizeof(record); i++){
+    if(i < offsetof(retention_record_t, check) || i >= offsetof(retention_record_t, path))
+      sum = sum * 31 + p[i];
+  }
+  return sum;
+}
+
+
+static void make_record(retention_record_t &record, uint32_t type, const retention_entry_t &entry,
+                        uint8_t flags = 0){
+  memset(&record, 0, sizeof(record));
+  record.type = type;
+  record.size = entry.size;
+  record.priority = entry.priority;
+  record.reserved = flags;
+  strlcpy(record.path, entry.path, sizeof(record.path));
+  record.check = record_check(record);
+}
+
+
+/***************************************************************************************
+* Function name:          journal_append
+* Description:            append one record to the journal (closed after every record,
+*                         so a power loss loses at most the record being written)
+***************************************************************************************/
+static void journal_append(uint32_t type, const retention_entry_t &entry, uint8_t flags = 0){
+  retention_record_t record;
+  make_record(record, type, entry, flags);
+  File file = retention_fs->open(RETENTION_JOURNAL, FILE_APPEND);
+  if(!file || file.write((const uint8_t *) &record, sizeof(record)) != sizeof(record)){
+    logger_write(LOG_CAPTURE, LOG_WARN, "unable to write %s", RETENTION_JOURNAL);
+    return;
+  }
+  file.close();
+  retention_stats.journal_records++;
+}
+
+
+/***************************************************************************************
+* Function name:          journal_rewrite
+* Description:            write the live entries into a new journal
+*                         The new journal is written under a temporary name and renamed,
+*                         retention_begin() picks up the temporary file if the power
+*                         fails between the remove and the rename.
+***************************************************************************************/
+static bool journal_rewrite(){
+  const char *tmp_path = RETENTION_JOURNAL ".tmp";
+  File file = retention_fs->open(tmp_path, FILE_WRITE);
+  if(!file)
+    return false;
+  journal_writer.begin(file);
+  uint32_t records = 0;
+  for(uint32_t i=first; i<used; i++){
+    if(!entries[i].live)
+      continue;
+    retention_record_t record;
+    make_record(record, RETENTION_RECORD_ADD, entries[i]);
+    journal_writer.write((const uint8_t *) &record, sizeof(record));
+    records++;
+  }
+  bool ok = journal_writer.end();
+  file.close();
+  if(!ok){
+    retention_fs->remove(tmp_path);
+    return false;
+  }
+  retention_fs->remove(RETENTION_JOURNAL);
+  if(!retention_fs->rename(tmp_path, RETENTION_JOURNAL))
+    return false;
+  retention_stats.journal_records = records;
+  return true;
+}
+
+
+// the journal has more than RETENTION_COMPACT_RATIO records per file of the quota
+static bool journal_full(){
+  return retention_stats.journal_records > RETENTION_COMPACT_RATIO * quota_files;
+}
+
+
+/***************************************************************************************
+* Function name:          find_entry
+* Return value:           index of the live entry with the path, -1 if not found
+***************************************************************************************/
+static int find_entry(const char *path){
+  for(uint32_t i=first; i<used; i++){
+    if(entries[i].live && strcmp(entries[i].path, path) == 0)
+      return i;
+  }
+  return -1;
+}
+
+
+static void drop_entry(uint32_t i){
+  entries[i].live = false;
+  retention_stats.files--;
+  retention_stats.bytes -= entries[i].size;
+  // the oldest entries are removed most of the time
+  while(first < used && !entries[first].live)
+    first++;
+}
+
+
+/***************************************************************************************
+* Function name:          find_victim
+* Description:            the oldest capture with the lowest priority (not the file being
+*                         written, read by loop() or downloaded)
+* return value:           index of the entry, -1 if the index is empty
+***************************************************************************************/
+static int find_victim(){
+  int victim = -1;
+  for(uint32_t i=first; i<used; i++){
+    if(!entries[i].live || (int)i == pending || strcmp(entries[i].path, held) == 0 ||
+       file_server_busy(*retention_fs, entries[i].path))
+      continue;
+    if(victim < 0 || entries[i].priority < entries[victim].priority)
+      victim = i;
+    if(entries[victim].priority == RETENTION_PRIORITY_LOW)
+      break;
+  }
+  return victim;
+}
+
+
+/***************************************************************************************
+* Function name:          add_entry
+* Description:            add a file to the index (a file with the same path is replaced)
+* return value:           false if the index is full (more files than the quota)
+***************************************************************************************/
+static bool add_entry(const char *path, uint32_t size, uint8_t priority){
+  int old = find_entry(path);
+  if(old >= 0)
+    drop_entry(old);
+  if(used == capacity){
+    // move the live entries to the start of the array
+    uint32_t n = 0;
+    for(uint32_t i=first; i<used; i++){
+      if(entries[i].live)
+        entries[n++] = entries[i];
+    }
+    first = 0;
+    used = n;
+    if(used == capacity)
+      return false;
+  }
+  retention_entry_t &entry = entries[used++];
+  entry.size = size;
+  entry.priority = priority;
+  entry.live = true;
+  strlcpy(entry.path, path, sizeof(entry.path));
+  retention_stats.files++;
+  retention_stats.bytes += size;
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          revive_entry
+* Description:            put a new file into the place of a dropped entry
+***************************************************************************************/
+static void revive_entry(uint32_t i, const char *path, uint32_t size, uint8_t priority){
+  retention_entry_t &entry = entries[i];
+  entry.size = size;
+  entry.priority = priority;
+  entry.live = true;
+  strlcpy(entry.path, path, sizeof(entry.path));
+  retention_stats.files++;
+  retention_stats.bytes += size;
+  if(i < first)
+    first = i;
+}
+
+
+/***************************************************************************************
+* Function name:          journal_load
+* Description:            rebuild the index from the journal
+* return value:           true if the journal has to be rewritten
+***************************************************************************************/
+static bool journal_load(){
+  const char *tmp_path = RETENTION_JOURNAL ".tmp";
+  if(!retention_fs->exists(RETENTION_JOURNAL) && retention_fs->exists(tmp_path))
+    retention_fs->rename(tmp_path, RETENTION_JOURNAL);
+  File file = retention_fs->open(RETENTION_JOURNAL, FILE_READ);
+  if(!file)
+    return false;
+  bool rewrite = false;
+  // entry of the last DEL record, for an ADD record that replaces it
+  int replaced = -1;
+  retention_record_t record;
+  while(file.read((uint8_t *) &record, sizeof(record)) == sizeof(record)){
+    retention_stats.journal_records++;
+    record.path[sizeof(record.path) - 1] = 0;
+    if(record.check != record_check(record)){
+      // torn or damaged record, the rest of the journal is not used
+      logger_write(LOG_CAPTURE, LOG_WARN, "%s: damaged record %u", RETENTION_JOURNAL,
+                   (unsigned)retention_stats.journal_records);
+      rewrite = true;
+      break;
+    }
+    if(record.type == RETENTION_RECORD_DEL){
+      int i = find_entry(record.path);
+      if(i >= 0)
+        drop_entry(i);
+      replaced = i;
+      continue;
+    }
+    if(record.type == RETENTION_RECORD_ADD && (record.reserved & RETENTION_RECORD_REPLACE) &&
+       replaced >= 0){
+      revive_entry(replaced, record.path, record.size, record.priority);
+    } else if(record.type == RETENTION_RECORD_ADD){
+      if(!add_entry(record.path, record.size, record.priority)){
+        // quota lowered since the last start: remove the oldest capture
+        int victim = find_victim();
+        retention_fs->remove(entries[victim].path);
+        drop_entry(victim);
+        retention_stats.evicted++;
+        add_entry(record.path, record.size, record.priority);
+        rewrite = true;
+      }
+    }
+    replaced = -1;
+  }
+  // a partial record at the end (power loss during the append)
+  if(file.available() > 0)
+    rewrite = true;
+  file.close();
+  return rewrite;
+}
+
+
+/***************************************************************************************
+* Function name:          retention_begin
+* Description:            allocate the index and load it from the journal
+*                         fs_size: size of the file system (0 = unknown), the byte quota
+*                         is limited to 90 % of it
+***************************************************************************************/
+bool retention_begin(fs::FS &fs, uint64_t fs_size, uint32_t max_files, uint64_t max_bytes){
+  if(entries)
+    return true;
+  capacity = max_files;
+  if(psramFound())
+    entries = (retention_entry_t *) ps_malloc(capacity * sizeof(retention_entry_t));
+  if(!entries)
+    entries = (retention_entry_t *) malloc(capacity * sizeof(retention_entry_t));
+  if(!entries){
+    logger_write(LOG_CAPTURE, LOG_WARN, "no memory for the capture index, no retention");
+    return false;
+  }
+  retention_fs = &fs;
+  fs_bytes = fs_size;
+  quota_files = max_files;
+  quota_bytes = max_bytes;
+  if(fs_bytes > 0 && quota_bytes > fs_bytes / 10 * 9)
+    quota_bytes = fs_bytes / 10 * 9;
+  first = used = 0;
+  // directory of the journal
+  char dir[CAPTURE_NAME_LEN];
+  strlcpy(dir, RETENTION_JOURNAL, sizeof(dir));
+  char *slash = strrchr(dir, '/');
+  if(slash && slash != dir){
+    *slash = 0;
+    fs.mkdir(dir);
+  }
+  unsigned long start = millis();
+  if(journal_load() || journal_full())
+    journal_rewrite();
+  logger_write(LOG_CAPTURE, LOG_INFO, "%u captures (%u kB) kept, quota %u files / %u MB, loaded in %u ms",
+               (unsigned)retention_stats.files, (unsigned)(retention_stats.bytes / 1024),
+               (unsigned)quota_files, (unsigned)(quota_bytes / (1024*1024)),
+               (unsigned)(millis() - start));
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          retention_prepare
+* Description:            evict captures until a file of the given size fits into the
+*                         quota and add the new file to the index
+*                         The last evicted file is renamed to the new path, so a file of
+*                         the same size is overwritten in place. The new file is in the
+*                         journal before it is written: after a power loss during the
+*                         write, the incomplete file is still counted and evicted later.
+***************************************************************************************/
+void retention_prepare(fs::FS &fs, const char *path, size_t size, uint8_t priority){
+  if(!entries || &fs != retention_fs)
+    return;
+  // the file is replaced
+  int old = find_entry(path);
+  if(old >= 0){
+    journal_append(RETENTION_RECORD_DEL, entries[old]);
+    drop_entry(old);
+  }
+  retention_entry_t recycle;
+  recycle.live = false;
+  // no download may open a file between the choice and the removal or rename
+  file_server_pause(true);
+  while(retention_stats.files > 0 &&
+        (retention_stats.files + 1 > quota_files || retention_stats.bytes + size > quota_bytes)){
+    int victim = find_victim();
+    if(victim < 0)
+      break;
+    if(recycle.live)
+      fs.remove(recycle.path);
+    recycle = entries[victim];
+    drop_entry(victim);
+    journal_append(RETENTION_RECORD_DEL, recycle);
+    retention_stats.evicted++;
+  }
+  if(recycle.live){
+    if(recycle.size == size && !fs.exists(path) && fs.rename(recycle.path, path))
+      retention_stats.recycled++;
+    else
+      fs.remove(recycle.path);
+  }
+  file_server_pause(false);
+  if(!add_entry(path, size, priority)){
+    // every entry is being written, read or downloaded: the file is not managed
+    logger_write(LOG_CAPTURE, LOG_WARN, "capture index full, %s not kept in the quota", path);
+    pending = -1;
+    return;
+  }
+  pending = used - 1;
+  journal_append(RETENTION_RECORD_ADD, entries[pending]);
+}
+
+
+/***************************************************************************************
+* Function name:          retention_evict
+* Description:            remove the oldest capture with the lowest priority (not the
+*                         file being written)
+* return value:           false if there is no capture to remove
+***************************************************************************************/
+bool retention_evict(fs::FS &fs){
+  if(!entries || &fs != retention_fs)
+    return false;
+  file_server_pause(true);
+  int victim = find_victim();
+  if(victim >= 0)
+    fs.remove(entries[victim].path);
+  file_server_pause(false);
+  if(victim < 0)
+    return false;
+  retention_entry_t entry = entries[victim];
+  drop_entry(victim);
+  journal_append(RETENTION_RECORD_DEL, entry);
+  retention_stats.evicted++;
+  retention_stats.retried++;
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          retention_commit
+* Description:            end of the write of the file from retention_prepare()
+*                         (a failed file is removed from the index and the file system,
+*                         it may be incomplete)
+***************************************************************************************/
+void retention_commit(fs::FS &fs, const char *path, bool ok){
+  if(!entries || &fs != retention_fs || pending < 0)
+    return;
+  if(!ok){
+    journal_append(RETENTION_RECORD_DEL, entries[pending]);
+    drop_entry(pending);
+    fs.remove(path);
+  }
+  pending = -1;
+  if(journal_full())
+    journal_rewrite();
+}
+
+
+/***************************************************************************************
+* Function name:          retention_find
+* Description:            next capture whose path ends with the suffix, from the entry
+*                         *cursor on in the order of the captures (start with 0)
+*                         The file being written is not returned.
+* return value:           false if there is no more capture
+***************************************************************************************/
+bool retention_find(const char *suffix, uint32_t *cursor, char *path, size_t size){
+  if(!entries)
+    return false;
+  size_t suffix_len = strlen(suffix);
+  for(uint32_t i=max(*cursor, first); i<used; i++){
+    size_t len = strlen(entries[i].path);
+    if(!entries[i].live || (int)i == pending || len < suffix_len ||
+       strcmp(entries[i].path + len - suffix_len, suffix) != 0)
+      continue;
+    strlcpy(path, entries[i].path, size);
+    *cursor = i + 1;
+    return true;
+  }
+  *cursor = used;
+  return false;
+}
+
+
+void retention_hold(const char *path){
+  strlcpy(held, path ? path : "", sizeof(held));
+}
+
+
+/***************************************************************************************
+* Function name:          retention_replace
+* Description:            replace a capture by a new file (e.g. a transcoded image) in
+*                         the index; the new file keeps the place of the old one in the
+*                         eviction order, also after a restart
+* return value:           false if the old file is not in the index
+***************************************************************************************/
+bool retention_replace(fs::FS &fs, const char *path, const char *new_path, size_t new_size){
+  if(!entries || &fs != retention_fs)
+    return false;
+  int i = find_entry(path);
+  if(i < 0)
+    return false;
+  retention_entry_t &entry = entries[i];
+  journal_append(RETENTION_RECORD_DEL, entry);
+  retention_stats.bytes = retention_stats.bytes - entry.size + new_size;
+  entry.size = new_size;
+  strlcpy(entry.path, new_path, sizeof(entry.path));
+  journal_append(RETENTION_RECORD_ADD, entry, RETENTION_RECORD_REPLACE);
+  if(journal_full())
+    journal_rewrite();
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          retention_raise
+* Description:            raise the priority of a kept capture (e.g. a capture of the
+*                         same screen was skipped); the capture keeps its place in the
+*                         eviction order, also after a restart
+* return value:           false if the file is not in the index
+***************************************************************************************/
+bool retention_raise(fs::FS &fs, const char *path, uint8_t priority){
+  if(!entries || &fs != retention_fs)
+    return false;
+  int i = find_entry(path);
+  if(i < 0)
+    return false;
+  retention_entry_t &entry = entries[i];
+  if(entry.priority >= priority)
+    return true;
+  journal_append(RETENTION_RECORD_DEL, entry);
+  entry.priority = priority;
+  journal_append(RETENTION_RECORD_ADD, entry, RETENTION_RECORD_REPLACE);
+  if(journal_full())
+    journal_rewrite();
+  return true;
+}
+
+
+bool retention_kept(fs::FS &fs, const char *path){
+  if(!entries || &fs != retention_fs)
+    return true;
+  return find_entry(path) >= 0;
+}
+
+
+size_t retention_status_json(char *buf, size_t size){
+  int n = snprintf(buf, size,
+                   "{\"enabled\":%s,\"files\":%u,\"bytes\":%llu,\"max_files\":%u,\"max_bytes\":%llu,"
+                   "\"fs_bytes\":%llu,\"evicted\":%u,\"recycled\":%u,\"retried\":%u,\"journal\":%u}",
+                   entries ? "true" : "false", (unsigned)retention_stats.files,
+                   (unsigned long long)retention_stats.bytes, (unsigned)quota_files,
+                   (unsigned long long)quota_bytes, (unsigned long long)fs_bytes,
+                   (unsigned)retention_stats.evicted, (unsigned)retention_stats.recycled,
+                   (unsigned)retention_stats.retried, (unsigned)retention_stats.journal_records);
+  return n < 0 ? 0 : min((size_t)n, size - 1);
+}
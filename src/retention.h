@@ -0,0 +1,96 @@
+/******************************************************************************
+ * retention.h
+ * Quota and eviction of the captures of the M5Stack Screen-Capture firmware.
+ *
+ * With numbered captures (capture_name.h) the SD card fills up, and then
+ * every capture fails because fs.open() returns no file. The retention
+ * manager keeps the captures within a quota of files and bytes, so the
+ * device can capture unattended for months.
+ *
+ *  - all kept captures are in an index in memory (PSRAM if available),
+ *    eviction never walks the directories of the card
+ *  - the index is kept in a journal on the card (RETENTION_JOURNAL),
+ *    one record per added or removed file, and loaded at startup;
+ *    a torn record after a power loss is ignored
+ *  - before a capture is written, the oldest captures with the lowest
+ *    priority are evicted until the new file fits into the quota; the
+ *    new file is added to the journal before it is written, so an
+ *    incomplete file after a power loss is still counted
+ *  - the last evicted file is not removed but renamed to the new name:
+ *    a file of the same size is overwritten in place (file_writer_open),
+ *    so a full card works like a ring buffer without cluster allocations
+ *  - if a file cannot be written (card full, not accounted files), one
+ *    more capture is evicted and the write is repeated once
+ *
+ *  - a capture can be replaced by a smaller file (transcode.h), the new
+ *    file keeps the place of the old one in the eviction order
+ *  - a capture that is being downloaded (file_server.h) is not evicted
+ *    or recycled
+ *
+ * The calls come from the storage task (storage.cpp); the status for
+ * GET /api/retention is read from loop(). retention_find(), _hold(),
+ * _replace() and _raise() are called from loop() while the storage task is idle
+ * (storage_pending() == 0).
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef RETENTION_H
+#define RETENTION_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "capture_name.h"
+
+// quota of the captures (the byte quota is limited to 90 % of the card)
+#ifndef RETENTION_MAX_FILES
+#define RETENTION_MAX_FILES 1024
+#endif
+#ifndef RETENTION_MAX_BYTES
+#define RETENTION_MAX_BYTES (512ULL*1024*1024)
+#endif
+#define RETENTION_JOURNAL "/cap/index.dat"
+// the journal is rewritten when it has this many records per file of the quota
+#define RETENTION_COMPACT_RATIO 4
+
+// priority of a capture, lower priorities are evicted first
+#define RETENTION_PRIORITY_LOW 0
+#define RETENTION_PRIORITY_HIGH 1
+
+struct retention_stats_t {
+  uint32_t files;
+  uint64_t bytes;
+  uint32_t evicted;
+  // evicted files renamed for the next capture
+  uint32_t recycled;
+  // writes repeated after evicting another file
+  uint32_t retried;
+  uint32_t journal_records;
+};
+
+extern retention_stats_t retention_stats;
+
+// load the index from the journal, captures on other file systems are not managed
+// fs_size: size of the file system in bytes (0 = unknown)
+bool retention_begin(fs::FS &fs, uint64_t fs_size, uint32_t max_files = RETENTION_MAX_FILES,
+                     uint64_t max_bytes = RETENTION_MAX_BYTES);
+// make room for a new file of the given size and add it to the index
+void retention_prepare(fs::FS &fs, const char *path, size_t size, uint8_t priority);
+// evict the oldest capture (after a failed write)
+// return value: false if there is nothing to evict
+bool retention_evict(fs::FS &fs);
+// end of the write (a failed file is removed)
+void retention_commit(fs::FS &fs, const char *path, bool ok);
+// next capture whose path ends with suffix, from the entry *cursor on (start with 0)
+bool retention_find(const char *suffix, uint32_t *cursor, char *path, size_t size);
+// keep a file that is being read from eviction (NULL: release it)
+void retention_hold(const char *path);
+// replace a capture by a new file of the given size (same place in the eviction order)
+bool retention_replace(fs::FS &fs, const char *path, const char *new_path, size_t new_size);
+// raise the priority of a capture (same place in the eviction order)
+bool retention_raise(fs::FS &fs, const char *path, uint8_t priority);
+// false if the file was evicted or replaced (true for files that are not managed)
+bool retention_kept(fs::FS &fs, const char *path);
+// status as JSON object (for GET /api/retention)
+size_t retention_status_json(char *buf, size_t size);
+
+#endif
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * screen.cpp
+ * Bookkeeping of screen changes for the M5Stack Screen-Capture firmware.
+ * See screen.h for a description of the interface.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "screen.h"
+#include <M5Stack.h>
+#include "canvas.h"
+
+volatile uint32_t screen_generation = 0;
+static ScreenRect *trackers[SCREEN_MAX_TRACKERS];
+
+
+void ScreenRect::add(int x, int y, int w, int h){
+  // clip the area to the screen
+  int ax0 = max(x, 0);
+  int ay0 = max(y, 0);
+  int ax1 = min(x + w, (int)M5.Lcd.width());
+  int ay1 = min(y + h, (int)M5.Lcd.height());
+  if(ax1 <= ax0 || ay1 <= ay0)
+    return;
+  if(empty()){
+    x0 = ax0; y0 = ay0; x1 = ax1; y1 = ay1;
+  } else {
+    x0 = min((int)x0, ax0);
+    y0 = min((int)y0, ay0);
+    x1 = max((int)x1, ax1);
+    y1 = max((int)y1, ay1);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          screen_invalidate
+* Description:            report a changed screen area
+***************************************************************************************/
+void screen_invalidate(int x, int y, int w, int h){
+  screen_generation++;
+  for(int i=0; i<SCREEN_MAX_TRACKERS; i++){
+    if(trackers[i])
+      trackers[i]->add(x, y, w, h);
+  }
+}
+
+
+void screen_invalidate_all(){
+  screen_invalidate(0, 0, M5.Lcd.width(), M5.Lcd.height());
+}
+
+
+/***************************************************************************************
+* Function name:          screen_add_tracker
+* Description:            register a dirty rectangle that collects all screen changes
+* return value:           false if all tracker slots are in use
+***************************************************************************************/
+bool screen_add_tracker(ScreenRect *rect){
+  for(int i=0; i<SCREEN_MAX_TRACKERS; i++){
+    if(!trackers[i]){
+      trackers[i] = rect;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+void screen_remove_tracker(ScreenRect *rect){
+  for(int i=0; i<SCREEN_MAX_TRACKERS; i++){
+    if(trackers[i] == rect)
+      trackers[i] = NULL;
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          screen_read_rgb565
+* Description:            read a screen area as RGB565 values
+*                         If the screen shows the canvas, the pixels are taken from the
+*                         canvas, otherwise the display is read line by line with
+*                         readRectRGB() (the same function that is used for the screenshots).
+***************************************************************************************/
+void screen_read_rgb565(int x, int y, int w, int h, uint16_t *data){
+  if(canvas_on_screen){
+    const uint16_t *pixels = canvas_buffer();
+    int width = M5.Lcd.width();
+    for(int row=0; row<h; row++){
+      const uint16_t *src = pixels + (y+row)*width + x;
+      for(int i=0; i<w; i++)
+        *data++ = canvas_swap(src[i]);
+    }
+    return;
+  }
+  uint8_t line_data[w*3];
+  for(int row=0; row<h; row++){
+    M5.Lcd.readRectRGB(x, y+row, w, 1, line_data);
+    for(int i=0; i<w; i++){
+      uint8_t r = line_data[i*3];
+      uint8_t g = line_data[i*3+1];
+      uint8_t b = line_data[i*3+2];
+      *data++ = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          screen_read_rgb888
+* Description:            read a screen area as RGB 8 bit colour values (like readRectRGB)
+*                         from the canvas or from the display
+***************************************************************************************/
+void screen_read_rgb888(int x, int y, int w, int h, uint8_t *data){
+  if(!canvas_on_screen){
+    M5.Lcd.readRectRGB(x, y, w, h, data);
+    return;
+  }
+  const uint16_t *pixels = canvas_buffer();
+  int width = M5.Lcd.width();
+  for(int row=0; row<h; row++){
+    const uint16_t *src = pixels + (y+row)*width + x;
+    for(int i=0; i<w; i++){
+      uint16_t c = canvas_swap(src[i]);
+      uint8_t r = c >> 11;
+      uint8_t g = (c >> 5) & 0x3F;
+      uint8_t b = c & 0x1F;
+      // bit replication to use the full 8 bit range
+      *data++ = (r << 3) | (r >> 2);
+      *data++ = (g << 2) | (g >> 4);
+      *data++ = (b << 3) | (b >> 2);
+    }
+  }
+}
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * screen.h
+ * Bookkeeping of screen changes for the M5Stack Screen-Capture firmware.
+ *
+ * Every drawing function reports the area it changed with
+ * screen_invalidate(). The screen generation counter is incremented on
+ * every change, and all registered dirty rectangles (e.g. one for each
+ * live view client) grow by the changed area. A consumer reads the area
+ * of its dirty rectangle and clears it afterwards.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include <Arduino.h>
+
+// maximum number of registered dirty rectangles
+#define SCREEN_MAX_TRACKERS 8
+
+// rectangle on the screen, x1 and y1 are exclusive
+struct ScreenRect {
+  int16_t x0, y0, x1, y1;
+  void clear() { x0 = y0 = x1 = y1 = 0; }
+  bool empty() const { return x1 <= x0 || y1 <= y0; }
+  int16_t width() const { return x1 - x0; }
+  int16_t height() const { return y1 - y0; }
+  // grow the rectangle to include the given area
+  void add(int x, int y, int w, int h);
+};
+
+// incremented on every change of the screen content
+extern volatile uint32_t screen_generation;
+
+void screen_invalidate(int x, int y, int w, int h);
+void screen_invalidate_all();
+bool screen_add_tracker(ScreenRect *rect);
+void screen_remove_tracker(ScreenRect *rect);
+// read a screen area as RGB565 values (w*h values)
+void screen_read_rgb565(int x, int y, int w, int h, uint16_t *data);
+// read a screen area as RGB 8 bit values (w*h*3 bytes, like readRectRGB)
+void screen_read_rgb888(int x, int y, int w, int h, uint8_t *data);
+
+#endif
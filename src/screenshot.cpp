@@ -0,0 +1,263 @@
+/******************************************************************************
+ * screenshot.cpp
+ * Admission control for the /screenshot.bmp requests.
+ * See screenshot.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "screenshot.h"
+#include <M5Stack.h>
+#include "capture.h"
+#include "frame_hash.h"
+#include "screen.h"
+#include "http_writer.h"
+#include "logger.h"
+
+screenshot_stats_t screenshot_stats;
+
+struct screenshot_client_t {
+  WiFiClient client;
+  bool active;
+  // true: the image of the current snapshot is being sent
+  bool streaming;
+  size_t sent;
+  unsigned long deadline;
+};
+
+struct rate_entry_t {
+  uint32_t ip;
+  // available requests in 1/1000
+  int32_t tokens;
+  unsigned long last;
+};
+
+static screenshot_client_t shot_clients[SCREENSHOT_QUEUE_SIZE];
+static rate_entry_t rate_table[SCREENSHOT_RATE_CLIENTS];
+// complete bmp file of the last snapshot
+static uint8_t *snapshot = NULL;
+static size_t snapshot_size = 0;
+static bool snapshot_valid = false;
+static uint32_t snapshot_generation = 0;
+static uint64_t snapshot_hash;
+
+
+// Print into a memory buffer (used to create the bmp file of the snapshot)
+class BufferPrint : public Print {
+  public:
+    BufferPrint(uint8_t *buffer, size_t size) : buf(buffer), size(size), pos(0) {}
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *data, size_t len) override {
+      len = min(len, size - pos);
+      memcpy(buf + pos, data, len);
+      pos += len;
+      return len;
+    }
+  private:
+    uint8_t *buf;
+    size_t size;
+    size_t pos;
+};
+
+
+void screenshot_begin(){
+  snapshot_size = M5Screen_bmp_filesize();
+  // 230 kB do not fit into the internal RAM, the snapshot needs the PSRAM
+  if(psramFound())
+    snapshot = (uint8_t *) ps_malloc(snapshot_size);
+  if(!snapshot)
+    logger_write(LOG_CAPTURE, LOG_WARN, "no PSRAM for screenshot snapshots, sending directly");
+}
+
+
+/***************************************************************************************
+* Function name:          rate_check
+* Description:            token bucket rate limit per IP address
+* return value:           0 if the request is allowed, otherwise seconds to wait
+***************************************************************************************/
+static unsigned long rate_check(uint32_t ip){
+  unsigned long now = millis();
+  rate_entry_t *entry = NULL;
+  rate_entry_t *oldest = &rate_table[0];
+  for(int i=0; i<SCREENSHOT_RATE_CLIENTS; i++){
+    if(rate_table[i].ip == ip){
+      entry = &rate_table[i];
+      break;
+    }
+    if((long)(rate_table[i].last - oldest->last) < 0)
+      oldest = &rate_table[i];
+  }
+  if(!entry){
+    // replace the least recently seen client
+    entry = oldest;
+    entry->ip = ip;
+    entry->tokens = SCREENSHOT_RATE_BURST * 1000;
+    entry->last = now;
+  }
+  // refill; the bucket is full after this time, a longer pause (days) would overflow
+  unsigned long elapsed = min(now - entry->last,
+                              (unsigned long)(SCREENSHOT_RATE_BURST * 1000 / SCREENSHOT_RATE_PER_S));
+  entry->tokens += elapsed * SCREENSHOT_RATE_PER_S;
+  entry->tokens = min(entry->tokens, (int32_t)(SCREENSHOT_RATE_BURST * 1000));
+  entry->last = now;
+  if(entry->tokens >= 1000){
+    entry->tokens -= 1000;
+    return 0;
+  }
+  // time until one request is available again
+  return ((1000 - entry->tokens) / SCREENSHOT_RATE_PER_S + 999) / 1000;
+}
+
+
+static void screenshot_send_header(WiFiClient &client, uint64_t hash){
+  char etag[FRAME_HASH_ETAG_LEN];
+  frame_hash_etag(hash, etag, sizeof(etag));
+  http_response.begin(client);
+  http_response.status(200, "OK");
+  http_response.header("Content-type", "image/bmp");
+  http_response.header("Content-Length", (unsigned long)M5Screen_bmp_filesize());
+  // the client has to ask again, but gets 304 if the screen is unchanged
+  http_response.header("Cache-Control", "no-cache");
+  http_response.header("ETag", etag);
+  http_response.end_headers();
+  http_response.end();
+}
+
+
+/***************************************************************************************
+* Function name:          not_modified
+* Description:            answer a conditional request with 304 if the client has the
+*                         image of the current screen already
+* return value:           true if the request was answered
+***************************************************************************************/
+static bool not_modified(WiFiClient &client, const char *if_none_match){
+  if(!if_none_match || !if_none_match[0])
+    return false;
+  char etag[FRAME_HASH_ETAG_LEN];
+  frame_hash_etag(frame_hash_screen(), etag, sizeof(etag));
+  // the header may contain a list of ETags or weak ETags (W/"...")
+  bool hit = strcmp(if_none_match, "*") == 0 || strstr(if_none_match, etag) != NULL;
+  frame_dedup_count(DEDUP_HTTP, hit);
+  if(!hit)
+    return false;
+  screenshot_stats.not_modified++;
+  http_response.begin(client);
+  http_response.status(304, "Not Modified");
+  http_response.header("Cache-Control", "no-cache");
+  http_response.header("ETag", etag);
+  http_response.end_headers();
+  http_response.end();
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          screenshot_request
+* Description:            admission control for one /screenshot.bmp request
+* return value:           true if the connection was taken over (queued),
+*                         false if the request was answered already
+***************************************************************************************/
+bool screenshot_request(WiFiClient &client, const char *if_none_match){
+  screenshot_stats.requests++;
+  unsigned long wait = rate_check((uint32_t)client.remoteIP());
+  if(wait > 0){
+    screenshot_stats.limited++;
+    http_send_text(client, 429, "Too Many Requests", "screenshot rate limit", wait);
+    return false;
+  }
+  if(not_modified(client, if_none_match))
+    return false;
+  if(!snapshot){
+    // no PSRAM: send the screen directly (blocking)
+    screenshot_send_header(client, frame_hash_screen());
+    http_response.begin(client);
+    M5Screen2bmp(http_response);
+    http_response.end();
+    return false;
+  }
+  for(int i=0; i<SCREENSHOT_QUEUE_SIZE; i++){
+    screenshot_client_t &c = shot_clients[i];
+    if(!c.active){
+      c.client = client;
+      c.active = true;
+      c.streaming = false;
+      c.sent = 0;
+      c.deadline = millis() + SCREENSHOT_TIMEOUT_MS;
+      return true;
+    }
+  }
+  screenshot_stats.rejected++;
+  logger_fast(LOG_CAPTURE, LOG_WARN, "screenshot queue full, request rejected");
+  http_send_text(client, 503, "Service Unavailable", "screenshot queue full", 1);
+  return false;
+}
+
+
+/***************************************************************************************
+* Function name:          screenshot_service
+* Description:            take snapshots and send one slice of the image to every client
+*                         needs to be called frequently from loop()
+***************************************************************************************/
+void screenshot_service(){
+  bool waiting = false;
+  bool streaming = false;
+  for(int i=0; i<SCREENSHOT_QUEUE_SIZE; i++){
+    if(shot_clients[i].active){
+      if(shot_clients[i].streaming)
+        streaming = true;
+      else
+        waiting = true;
+    }
+  }
+  // Waiting clients can start as soon as the snapshot is up to date.
+  // A new snapshot may only be taken if nobody is reading the old one.
+  if(waiting){
+    bool current = snapshot_valid && snapshot_generation == screen_generation;
+    if(!current && !streaming){
+      // the screen is only encoded again if the content changed
+      snapshot_hash = frame_hash_screen();
+      if(!frame_dedup_check(DEDUP_SNAPSHOT, snapshot_hash) || !snapshot_valid){
+        BufferPrint out(snapshot, snapshot_size);
+        M5Screen2bmp(out);
+        screenshot_stats.snapshots++;
+      }
+      snapshot_valid = true;
+      snapshot_generation = screen_generation;
+      current = true;
+    }
+    if(current){
+      for(int i=0; i<SCREENSHOT_QUEUE_SIZE; i++){
+        screenshot_client_t &c = shot_clients[i];
+        if(c.active && !c.streaming){
+          // every client after the first one shares the snapshot
+          if(streaming)
+            screenshot_stats.coalesced++;
+          streaming = true;
+          c.streaming = true;
+          screenshot_send_header(c.client, snapshot_hash);
+        }
+      }
+    }
+  }
+  unsigned long now = millis();
+  for(int i=0; i<SCREENSHOT_QUEUE_SIZE; i++){
+    screenshot_client_t &c = shot_clients[i];
+    if(!c.active)
+      continue;
+    bool done = !c.client.connected() || (long)(now - c.deadline) >= 0;
+    if(!done && c.streaming){
+      size_t n = min((size_t)SCREENSHOT_SLICE_SIZE, snapshot_size - c.sent);
+      size_t written = c.client.write(snapshot + c.sent, n);
+      c.sent += written;
+      // nothing written: the send buffer is full, try again with the next call;
+      // a slow client is dropped if it takes nothing for the timeout
+      if(written > 0)
+        c.deadline = now + SCREENSHOT_TIMEOUT_MS;
+      done = (c.sent >= snapshot_size);
+    }
+    if(done){
+      c.client.stop();
+      c.active = false;
+      c.streaming = false;
+    }
+  }
+}
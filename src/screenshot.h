@@ -0,0 +1,56 @@
+/******************************************************************************
+ * screenshot.h
+ * Admission control for the /screenshot.bmp requests.
+ *
+ * Screenshot requests are not answered directly anymore. They are placed
+ * into a small queue and served from a snapshot of the screen in PSRAM:
+ *  - all queued requests share one snapshot (one screen readback)
+ *  - a new snapshot is only taken if the screen changed in between
+ *  - the image is sent in slices, so loop() keeps running during the
+ *    transfer (the gauge is not frozen by a slow client)
+ *  - a full queue is answered with 503 and a Retry-After header
+ *  - every client (IP address) is limited to a few requests per second,
+ *    more requests are answered with 429 and a Retry-After header
+ *  - every image has an ETag (content hash, frame_hash.h); a request with
+ *    the ETag of the current screen in If-None-Match is answered with
+ *    304 Not Modified, without any encoding
+ *  - a changed screen generation with the same content (e.g. the needle
+ *    moved back) keeps the snapshot
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef SCREENSHOT_H
+#define SCREENSHOT_H
+
+#include <Arduino.h>
+#include "WiFi.h"
+
+// number of screenshot requests that are served or waiting
+#define SCREENSHOT_QUEUE_SIZE 4
+// bytes sent to one client per call of screenshot_service()
+#define SCREENSHOT_SLICE_SIZE 8192
+// drop a client that takes no data of the image within this time
+#define SCREENSHOT_TIMEOUT_MS 10000
+// rate limit per client: burst size and requests per second
+#define SCREENSHOT_RATE_BURST 4
+#define SCREENSHOT_RATE_PER_S 2
+// number of clients (IP addresses) tracked by the rate limit
+#define SCREENSHOT_RATE_CLIENTS 8
+
+struct screenshot_stats_t {
+  uint32_t requests;
+  uint32_t snapshots;
+  uint32_t coalesced;
+  uint32_t rejected;
+  uint32_t limited;
+  // answered with 304 Not Modified
+  uint32_t not_modified;
+};
+extern screenshot_stats_t screenshot_stats;
+
+void screenshot_begin();
+// if_none_match: value of the If-None-Match header (NULL or "" if there is none)
+bool screenshot_request(WiFiClient &client, const char *if_none_match = NULL);
+void screenshot_service();
+
+#endif
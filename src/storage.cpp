@@ -0,0 +1,457 @@
+/******************************************************************************
+ * storage.cpp
+ * Background writer for screen captures of the M5Stack Screen-Capture firmware.
+ * See storage.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "storage.h"
+#include <M5Stack.h>
+#include <atomic>
+#include "freertos/queue.h"
+#include "capture.h"
+#include "screen.h"
+#include "file_writer.h"
+#include "frame_hash.h"
+#include "retention.h"
+#include "logger.h"
+
+storage_stats_t storage_stats;
+
+enum slot_state_t : uint8_t {
+  SLOT_FREE,
+  // captured, waiting for the task
+  SLOT_QUEUED,
+  SLOT_WRITING,
+  // written, callback not called yet
+  SLOT_DONE
+};
+
+struct storage_slot_t {
+  // changed by loop() and by the task
+  std::atomic<uint8_t> state;
+  // RGB565 image of the screen
+  uint16_t *pixels;
+  // data of a STORAGE_DATA file (owned by the caller until the callback)
+  const uint8_t *data;
+  size_t data_size;
+  fs::FS *fs;
+  char path[STORAGE_PATH_LEN];
+  storage_format_t format;
+  storage_done_t done;
+  void *arg;
+  uint8_t priority;
+  bool ok;
+  // last capture (DEDUP_STORAGE) when the slot was queued and whether it is still
+  // kept after the write (the write may evict it)
+  char dedup_path[STORAGE_PATH_LEN];
+  bool dedup_kept;
+};
+
+static storage_slot_t slots[STORAGE_SLOTS];
+// indices of the queued slots
+static QueueHandle_t storage_queue = NULL;
+static TaskHandle_t storage_task_handle = NULL;
+static char last_path[STORAGE_PATH_LEN];
+// last queued capture (DEDUP_STORAGE holds its hash)
+static fs::FS *dedup_fs = NULL;
+static storage_format_t dedup_format;
+static char dedup_path[STORAGE_PATH_LEN];
+static uint8_t dedup_priority;
+// block buffer of the storage task
+static FileWriter storage_writer;
+
+
+/***************************************************************************************
+* Function name:          encode_row
+* Description:            convert a row of RGB565 pixels to 8 bit colour values
+*                         (bit replication like screen_read_rgb888)
+*                         bgr = true: BMP order (blue, green, red)
+***************************************************************************************/
+static void encode_row(const uint16_t *src, int w, uint8_t *dst, bool bgr){
+  for(int i=0; i<w; i++){
+    uint16_t c = src[i];
+    uint8_t r = c >> 11;
+    uint8_t g = (c >> 5) & 0x3F;
+    uint8_t b = c & 0x1F;
+    r = (r << 3) | (r >> 2);
+    g = (g << 2) | (g >> 4);
+    b = (b << 3) | (b >> 2);
+    *dst++ = bgr ? b : r;
+    *dst++ = g;
+    *dst++ = bgr ? r : b;
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          write_image
+* Description:            encode the image of a slot (or copy its data) and write the file
+*                         (runs in the storage task)
+***************************************************************************************/
+static bool write_image(storage_slot_t &slot, size_t size){
+  // preallocated, or an old file of the same size is overwritten in place
+  File file = file_writer_open(*slot.fs, slot.path, size);
+  if(!file)
+    return false;
+  int width = M5.Lcd.width();
+  int height = M5.Lcd.height();
+  // rows of a BMP image are padded to a multiple of 4 bytes
+  int pad = (slot.format == STORAGE_BMP) ? (4 - (3*width) % 4) % 4 : 0;
+  uint8_t line_data[3*width + pad];
+  memset(line_data, 0, sizeof(line_data));
+  // sector aligned blocks instead of one write per row
+  storage_writer.begin(file);
+  if(slot.format == STORAGE_DATA){
+    storage_writer.write(slot.data, slot.data_size);
+  } else if(slot.format == STORAGE_BMP){
+    uint8_t header[54];
+    M5Screen_bmp_header(header);
+    storage_writer.write(header, sizeof(header));
+    // the BMP image starts with the bottom row
+    for(int y=height-1; y>=0 && storage_writer.ok(); y--){
+      encode_row(slot.pixels + y*width, width, line_data, true);
+      storage_writer.write(line_data, 3*width + pad);
+    }
+  } else {
+    storage_writer.printf("P6\n%d %d\n255\n", width, height);
+    for(int y=0; y<height && storage_writer.ok(); y++){
+      encode_row(slot.pixels + y*width, width, line_data, false);
+      storage_writer.write(line_data, 3*width);
+    }
+  }
+  bool ok = storage_writer.end();
+  file.close();
+  return ok;
+}
+
+
+static size_t image_size(storage_format_t format){
+  return (format == STORAGE_BMP) ? M5Screen_bmp_filesize() : M5Screen_ppm_filesize();
+}
+
+
+static uint8_t find_free_slot(){
+  uint8_t index;
+  for(index=0; index<STORAGE_SLOTS; index++){
+    if(slots[index].state.load() == SLOT_FREE)
+      break;
+  }
+  return index;
+}
+
+
+/***************************************************************************************
+* Function name:          write_retained
+* Description:            write a capture within the retention quota: make room, write
+*                         the file and add it to the index
+*                         If the file cannot be written (card full), one more capture is
+*                         evicted and the file is written again.
+*                         slot = NULL: write the screen directly (without PSRAM)
+***************************************************************************************/
+static bool write_retained(fs::FS &fs, const char *path, storage_format_t format,
+                           uint8_t priority, storage_slot_t *slot){
+  size_t size = (format == STORAGE_DATA) ? slot->data_size : image_size(format);
+  retention_prepare(fs, path, size, priority);
+  bool ok = false;
+  for(int attempt=0; attempt<2 && !ok; attempt++){
+    if(attempt > 0 && !retention_evict(fs))
+      break;
+    if(slot)
+      ok = write_image(*slot, size);
+    else
+      ok = (format == STORAGE_BMP) ? M5Screen2bmp(fs, path) : M5Screen2ppm(fs, path);
+  }
+  retention_commit(fs, path, ok);
+  return ok;
+}
+
+
+static void storage_task(void *parameter){
+  uint8_t index;
+  for(;;){
+    if(xQueueReceive(storage_queue, &index, portMAX_DELAY) != pdTRUE)
+      continue;
+    storage_slot_t &slot = slots[index];
+    slot.state.store(SLOT_WRITING);
+    unsigned long start = millis();
+    slot.ok = write_retained(*slot.fs, slot.path, slot.format, slot.priority, &slot);
+    slot.dedup_kept = !slot.dedup_path[0] || retention_kept(*slot.fs, slot.dedup_path);
+    storage_stats.write_ms = millis() - start;
+    if(storage_stats.write_ms > storage_stats.write_max_ms)
+      storage_stats.write_max_ms = storage_stats.write_ms;
+    slot.state.store(SLOT_DONE);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          storage_begin
+* Description:            allocate the capture slots and start the storage task
+* return value:           false without PSRAM (the captures are written directly)
+***************************************************************************************/
+bool storage_begin(){
+  if(storage_queue)
+    return true;
+  if(!psramFound()){
+    logger_write(LOG_CAPTURE, LOG_WARN, "no PSRAM for capture slots, writing captures directly");
+    return false;
+  }
+  size_t size = M5.Lcd.width() * M5.Lcd.height() * sizeof(uint16_t);
+  for(int i=0; i<STORAGE_SLOTS; i++){
+    slots[i].pixels = (uint16_t *) ps_malloc(size);
+    slots[i].state.store(SLOT_FREE);
+    if(!slots[i].pixels){
+      logger_write(LOG_CAPTURE, LOG_WARN, "unable to allocate the capture slots, writing captures directly");
+      for(int j=0; j<i; j++){
+        free(slots[j].pixels);
+        slots[j].pixels = NULL;
+      }
+      return false;
+    }
+  }
+  storage_queue = xQueueCreate(STORAGE_SLOTS, sizeof(uint8_t));
+  // same core as the logger, loop() runs on core 1
+  xTaskCreatePinnedToCore(storage_task, "storage", 4096, NULL, 1,
+                          &storage_task_handle, 0);
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          storage_duplicate
+* Description:            check the screen against the last capture of the same file
+*                         system and format; a duplicate is not written again, the
+*                         callback gets the file of the last capture
+*                         A duplicate with a higher priority raises the priority of the
+*                         last capture; while a file is written, the index belongs to
+*                         the storage task and the capture is written again instead.
+* return value:           true if the capture is a duplicate
+***************************************************************************************/
+static bool storage_duplicate(fs::FS &fs, storage_format_t format, uint64_t hash,
+                              uint8_t priority, storage_done_t done, void *arg){
+  if(dedup_fs != &fs || dedup_format != format)
+    frame_dedup_forget(DEDUP_STORAGE);
+  if(!frame_dedup_check(DEDUP_STORAGE, hash))
+    return false;
+  if(priority > dedup_priority){
+    if(storage_pending() > 0)
+      return false;
+    retention_raise(fs, dedup_path, priority);
+    dedup_priority = priority;
+  }
+  storage_stats.deduplicated++;
+  logger_write(LOG_CAPTURE, LOG_INFO, "screen unchanged, capture skipped (%s)", dedup_path);
+  if(done)
+    done(dedup_path, true, arg);
+  return true;
+}
+
+
+static void storage_remember(fs::FS &fs, const char *path, storage_format_t format,
+                             uint8_t priority, uint64_t hash){
+  dedup_fs = &fs;
+  dedup_format = format;
+  dedup_priority = priority;
+  strlcpy(dedup_path, path, sizeof(dedup_path));
+  frame_dedup[DEDUP_STORAGE].hash = hash;
+  frame_dedup[DEDUP_STORAGE].valid = true;
+}
+
+
+// the storage task checks after the write whether the last capture is still kept
+static void queue_dedup(storage_slot_t &slot, fs::FS &fs){
+  if(dedup_fs == &fs && frame_dedup[DEDUP_STORAGE].valid)
+    strlcpy(slot.dedup_path, dedup_path, sizeof(slot.dedup_path));
+  else
+    slot.dedup_path[0] = 0;
+  slot.dedup_kept = true;
+}
+
+
+/***************************************************************************************
+* Function name:          storage_capture
+* Description:            copy the screen into a free slot and queue it for writing
+*                         The callback is called from storage_service() when the file
+*                         is written, or immediately if the capture is dropped.
+* return value:           false if the capture was dropped or could not be written
+***************************************************************************************/
+bool storage_capture(fs::FS &fs, const char *path, storage_format_t format,
+                     storage_done_t done, void *arg, uint8_t priority){
+  if(!storage_queue){
+    // no PSRAM: blocking, as before
+    uint64_t hash = frame_hash_screen();
+    if(storage_duplicate(fs, format, hash, priority, done, arg))
+      return true;
+    storage_remember(fs, path, format, priority, hash);
+    bool ok = write_retained(fs, path, format, priority, NULL);
+    if(!ok)
+      frame_dedup_forget(DEDUP_STORAGE);
+    if(ok)
+      storage_stats.written++;
+    else
+      storage_stats.failed++;
+    if(done)
+      done(path, ok, arg);
+    return ok;
+  }
+  uint8_t index = find_free_slot();
+  storage_slot_t *slot = (index < STORAGE_SLOTS) ? &slots[index] : NULL;
+  if(!slot){
+    storage_stats.dropped++;
+    logger_write(LOG_CAPTURE, LOG_WARN, "capture slots busy, %s dropped", path);
+    if(done)
+      done(path, false, arg);
+    return false;
+  }
+  // the screen is hashed while it is copied into the slot,
+  // the hash of an unchanged screen is known already
+  unsigned long start = micros();
+  bool copied = !frame_hash_current();
+  uint64_t hash = copied ? frame_hash_capture(slot->pixels) : frame_hash_screen();
+  if(storage_duplicate(fs, format, hash, priority, done, arg))
+    return true;
+  if(!copied)
+    screen_read_rgb565(0, 0, M5.Lcd.width(), M5.Lcd.height(), slot->pixels);
+  storage_stats.capture_us = micros() - start;
+  storage_remember(fs, path, format, priority, hash);
+  queue_dedup(*slot, fs);
+  slot->fs = &fs;
+  strlcpy(slot->path, path, sizeof(slot->path));
+  slot->format = format;
+  slot->done = done;
+  slot->arg = arg;
+  slot->priority = priority;
+  slot->ok = false;
+  slot->state.store(SLOT_QUEUED);
+  xQueueSend(storage_queue, &index, 0);
+  storage_stats.queued++;
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          storage_write
+* Description:            queue a block of data (e.g. a capture archive) for writing
+*                         The data must not be changed or freed until the callback.
+* return value:           false if all slots are busy or the file could not be written
+***************************************************************************************/
+bool storage_write(fs::FS &fs, const char *path, const uint8_t *data, size_t size,
+                   storage_done_t done, void *arg, uint8_t priority){
+  if(!storage_queue){
+    storage_slot_t direct;
+    direct.fs = &fs;
+    direct.format = STORAGE_DATA;
+    direct.data = data;
+    direct.data_size = size;
+    strlcpy(direct.path, path, sizeof(direct.path));
+    bool ok = write_retained(fs, path, STORAGE_DATA, priority, &direct);
+    // the last capture may have been evicted for the data
+    if(dedup_fs == &fs && !retention_kept(fs, dedup_path))
+      frame_dedup_forget(DEDUP_STORAGE);
+    if(ok)
+      storage_stats.written++;
+    else
+      storage_stats.failed++;
+    if(done)
+      done(path, ok, arg);
+    return ok;
+  }
+  uint8_t index = find_free_slot();
+  if(index >= STORAGE_SLOTS){
+    storage_stats.dropped++;
+    logger_write(LOG_CAPTURE, LOG_WARN, "capture slots busy, %s dropped", path);
+    if(done)
+      done(path, false, arg);
+    return false;
+  }
+  storage_slot_t &slot = slots[index];
+  slot.fs = &fs;
+  strlcpy(slot.path, path, sizeof(slot.path));
+  slot.format = STORAGE_DATA;
+  slot.data = data;
+  slot.data_size = size;
+  slot.done = done;
+  slot.arg = arg;
+  slot.priority = priority;
+  slot.ok = false;
+  queue_dedup(slot, fs);
+  slot.state.store(SLOT_QUEUED);
+  xQueueSend(storage_queue, &index, 0);
+  storage_stats.queued++;
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          storage_service
+* Description:            release the written slots and call their callbacks
+*                         needs to be called frequently from loop()
+***************************************************************************************/
+void storage_service(){
+  if(!storage_queue)
+    return;
+  for(int i=0; i<STORAGE_SLOTS; i++){
+    storage_slot_t &slot = slots[i];
+    if(slot.state.load() != SLOT_DONE)
+      continue;
+    char path[STORAGE_PATH_LEN];
+    strlcpy(path, slot.path, sizeof(path));
+    strlcpy(last_path, slot.path, sizeof(last_path));
+    bool ok = slot.ok;
+    storage_done_t done = slot.done;
+    void *arg = slot.arg;
+    if(ok){
+      storage_stats.written++;
+      logger_write(LOG_CAPTURE, LOG_INFO, "%s written in %u ms", path, (unsigned)storage_stats.write_ms);
+    } else {
+      storage_stats.failed++;
+      logger_write(LOG_CAPTURE, LOG_ERR, "unable to write %s", path);
+      // the next capture of the same screen has to be written
+      if(strcmp(path, dedup_path) == 0)
+        frame_dedup_forget(DEDUP_STORAGE);
+    }
+    // the last capture was evicted to make room for this file
+    if(!slot.dedup_kept && strcmp(slot.dedup_path, dedup_path) == 0)
+      frame_dedup_forget(DEDUP_STORAGE);
+    // free before the callback, so the callback can take the next capture
+    slot.state.store(SLOT_FREE);
+    if(done)
+      done(path, ok, arg);
+  }
+}
+
+
+void storage_replaced(const char *path, const char *new_path){
+  if(strcmp(path, dedup_path) == 0)
+    strlcpy(dedup_path, new_path, sizeof(dedup_path));
+}
+
+
+int storage_pending(){
+  int pending = 0;
+  if(storage_queue){
+    for(int i=0; i<STORAGE_SLOTS; i++){
+      if(slots[i].state.load() != SLOT_FREE)
+        pending++;
+    }
+  }
+  return pending;
+}
+
+
+size_t storage_status_json(char *buf, size_t size){
+  int n = snprintf(buf, size,
+                   "{\"async\":%s,\"slots\":%d,\"pending\":%d,\"queued\":%u,\"written\":%u,"
+                   "\"failed\":%u,\"dropped\":%u,\"capture_us\":%u,\"write_ms\":%u,"
+                   "\"write_max_ms\":%u,\"deduplicated\":%u,\"preallocated\":%u,\"recycled\":%u,"
+                   "\"last\":\"%s\"}",
+                   storage_queue ? "true" : "false", storage_queue ? STORAGE_SLOTS : 0,
+                   storage_pending(), (unsigned)storage_stats.queued, (unsigned)storage_stats.written,
+                   (unsigned)storage_stats.failed, (unsigned)storage_stats.dropped,
+                   (unsigned)storage_stats.capture_us, (unsigned)storage_stats.write_ms,
+                   (unsigned)storage_stats.write_max_ms, (unsigned)storage_stats.deduplicated,
+                   (unsigned)file_writer_stats.preallocated,
+                   (unsigned)file_writer_stats.recycled, last_path);
+  return n < 0 ? 0 : min((size_t)n, size - 1);
+}
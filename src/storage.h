@@ -0,0 +1,89 @@
+/******************************************************************************
+ * storage.h
+ * Background writer for screen captures of the M5Stack Screen-Capture firmware.
+ *
+ * storage_capture() only copies the screen into a free capture slot in
+ * PSRAM (a few ms from the canvas) and queues the slot. A background task
+ * encodes the image and writes the file, so loop() returns to the UI
+ * within one frame. With STORAGE_SLOTS = 2 the next capture is taken
+ * while the previous one is still being written (double buffering).
+ *
+ * When the file is written, the completion callback is called from
+ * storage_service() in loop(), so the callback may use the WiFi clients
+ * and everything else that belongs to loop().
+ *
+ * example:
+ *   void saved(const char *path, bool ok, void *arg){ ... }
+ *   storage_capture(SD, "/gauge_0.bmp", STORAGE_BMP, saved, NULL);
+ *
+ * A capture of the same screen as the last capture (same content hash,
+ * frame_hash.h) on the same file system is skipped: nothing is copied or
+ * written, the callback is called immediately with the file of the last
+ * capture (or the transcoded file that replaced it). A skipped capture
+ * with a higher priority raises the priority of the last capture. Once
+ * the last capture is evicted, the next capture is written again.
+ *
+ * If both slots are busy, the capture is dropped and the callback is
+ * called with ok = false. Without PSRAM the capture is written directly
+ * (blocking, as before) and the callback is called immediately.
+ *
+ * The files on the file system of retention_begin() are kept within the
+ * retention quota (retention.h); priority selects the captures that are
+ * evicted first (0 = lowest).
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// number of capture slots (frames in PSRAM)
+#define STORAGE_SLOTS 2
+#define STORAGE_PATH_LEN 48
+
+enum storage_format_t {
+  STORAGE_BMP,
+  STORAGE_PPM,
+  // a block of data from storage_write()
+  STORAGE_DATA
+};
+
+typedef void (*storage_done_t)(const char *path, bool ok, void *arg);
+
+struct storage_stats_t {
+  uint32_t queued;
+  uint32_t written;
+  uint32_t failed;
+  uint32_t dropped;
+  // captures skipped because the screen was the same as in the last capture
+  uint32_t deduplicated;
+  // time loop() spent taking the last capture
+  uint32_t capture_us;
+  // time of the background task for the last / slowest file
+  uint32_t write_ms;
+  uint32_t write_max_ms;
+};
+
+extern storage_stats_t storage_stats;
+
+bool storage_begin();
+// take a capture of the screen and queue it for writing
+// return value: false if the capture was dropped (no free slot)
+bool storage_capture(fs::FS &fs, const char *path, storage_format_t format,
+                     storage_done_t done = NULL, void *arg = NULL, uint8_t priority = 0);
+// queue a block of data for writing (kept by the caller until the callback)
+bool storage_write(fs::FS &fs, const char *path, const uint8_t *data, size_t size,
+                   storage_done_t done = NULL, void *arg = NULL, uint8_t priority = 0);
+// call the completion callbacks of the written files (from loop())
+void storage_service();
+// number of captures that are queued or being written
+int storage_pending();
+// a kept capture was replaced by a new file (transcoded), a skipped capture of the
+// same screen refers to the new file
+void storage_replaced(const char *path, const char *new_path);
+// status as JSON object (for GET /api/storage)
+size_t storage_status_json(char *buf, size_t size);
+
+#endif
@@ -0,0 +1,368 @@
+/******************************************************************************
+ * transcode.cpp
+ * Background transcoding of the BMP captures of the M5Stack Screen-Capture
+ * firmware.
+ * See transcode.h for a description.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "transcode.h"
+#include "capture_name.h"
+#include "file_server.h"
+#include "file_writer.h"
+#include "logger.h"
+#include "retention.h"
+#include "storage.h"
+
+// QOI operations (see https://qoiformat.org)
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF 0x40
+#define QOI_OP_LUMA 0x80
+#define QOI_OP_RUN 0xC0
+#define QOI_OP_RGB 0xFE
+#define QOI_MAX_RUN 62
+#define QOI_HEADER_SIZE 14
+
+transcode_stats_t transcode_stats;
+
+struct qoi_state_t {
+  // colours as r | g << 8 | b << 16 | a << 24
+  uint32_t index[64];
+  uint32_t prev;
+  uint8_t run;
+};
+
+struct transcode_job_t {
+  bool active;
+  char path[CAPTURE_NAME_LEN];
+  char qoi_path[CAPTURE_NAME_LEN];
+  char tmp_path[CAPTURE_NAME_LEN + 4];
+  File bmp;
+  File qoi;
+  int width;
+  int height;
+  int stride;
+  uint32_t pixel_offset;
+  // next row (top-down) and the rows in the read buffer
+  int row;
+  int block_first;
+  int block_rows;
+  qoi_state_t state;
+  unsigned long start_ms;
+};
+
+static fs::FS *transcode_fs = NULL;
+static transcode_job_t job;
+// position in the retention index and time of the next scan
+static uint32_t cursor = 0;
+static unsigned long next_scan_ms = 0;
+static char failed[TRANSCODE_MAX_FAILED][CAPTURE_NAME_LEN];
+static uint8_t failed_next = 0;
+// BMP rows of one read, allocated by the first job
+static uint8_t *block = NULL;
+// QOI data of one row (5 bytes per pixel at most, with a run before)
+static uint8_t qoi_row[TRANSCODE_MAX_WIDTH * 5 + 1];
+static FileWriter transcode_writer(4096);
+
+
+/***************************************************************************************
+* Function name:          qoi_encode_row
+* Description:            code one row of BGR pixels (BMP order) as QOI operations
+* return value:           number of bytes in out
+***************************************************************************************/
+static size_t qoi_encode_row(qoi_state_t &q, const uint8_t *bgr, int width, uint8_t *out){
+  size_t n = 0;
+  for(int i=0; i<width; i++, bgr+=3){
+    uint8_t b = bgr[0];
+    uint8_t g = bgr[1];
+    uint8_t r = bgr[2];
+    uint32_t px = r | (g << 8) | ((uint32_t)b << 16) | 0xFF000000;
+    if(px == q.prev){
+      if(++q.run == QOI_MAX_RUN){
+        out[n++] = QOI_OP_RUN | (q.run - 1);
+        q.run = 0;
+      }
+      continue;
+    }
+    if(q.run > 0){
+      out[n++] = QOI_OP_RUN | (q.run - 1);
+      q.run = 0;
+    }
+    uint8_t hash = (r*3 + g*5 + b*7 + 255*11) % 64;
+    if(q.index[hash] == px){
+      out[n++] = QOI_OP_INDEX | hash;
+    } else {
+      q.index[hash] = px;
+      int8_t dr = r - (uint8_t)q.prev;
+      int8_t dg = g - (uint8_t)(q.prev >> 8);
+      int8_t db = b - (uint8_t)(q.prev >> 16);
+      int8_t dr_dg = dr - dg;
+      int8_t db_dg = db - dg;
+      if(dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1){
+        out[n++] = QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2);
+      } else if(dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7){
+        out[n++] = QOI_OP_LUMA | (dg + 32);
+        out[n++] = ((dr_dg + 8) << 4) | (db_dg + 8);
+      } else {
+        out[n++] = QOI_OP_RGB;
+        out[n++] = r;
+        out[n++] = g;
+        out[n++] = b;
+      }
+    }
+    q.prev = px;
+  }
+  return n;
+}
+
+
+static void put_be32(uint8_t *p, uint32_t v){
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+
+static uint32_t get_le32(const uint8_t *p){
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+static bool is_failed(const char *path){
+  for(int i=0; i<TRANSCODE_MAX_FAILED; i++){
+    if(strcmp(failed[i], path) == 0)
+      return true;
+  }
+  return false;
+}
+
+
+/***************************************************************************************
+* Function name:          job_swap
+* Description:            replace the BMP file by the complete QOI file
+***************************************************************************************/
+static void job_swap(){
+  File file = transcode_fs->open(job.path, FILE_READ);
+  size_t bmp_size = file ? file.size() : 0;
+  if(file)
+    file.close();
+  file = transcode_fs->open(job.qoi_path, FILE_READ);
+  size_t qoi_size = file ? file.size() : 0;
+  if(file)
+    file.close();
+  transcode_fs->remove(job.path);
+  retention_replace(*transcode_fs, job.path, job.qoi_path, qoi_size);
+  storage_replaced(job.path, job.qoi_path);
+  transcode_stats.files++;
+  transcode_stats.bytes_in += bmp_size;
+  transcode_stats.bytes_out += qoi_size;
+  transcode_stats.file_ms = millis() - job.start_ms;
+  logger_write(LOG_CAPTURE, LOG_INFO, "%s: %u kB -> %u kB in %u ms", job.qoi_path,
+               (unsigned)(bmp_size / 1024), (unsigned)(qoi_size / 1024),
+               (unsigned)transcode_stats.file_ms);
+}
+
+
+static void job_close(){
+  if(job.bmp)
+    job.bmp.close();
+  if(job.qoi)
+    job.qoi.close();
+  retention_hold(NULL);
+  job.active = false;
+}
+
+
+static void job_fail(const char *reason){
+  logger_write(LOG_CAPTURE, LOG_WARN, "unable to transcode %s: %s", job.path, reason);
+  transcode_writer.end();
+  job_close();
+  transcode_fs->remove(job.tmp_path);
+  strlcpy(failed[failed_next], job.path, sizeof(failed[0]));
+  failed_next = (failed_next + 1) % TRANSCODE_MAX_FAILED;
+  transcode_stats.failed++;
+}
+
+
+/***************************************************************************************
+* Function name:          job_start
+* Description:            open the next BMP capture and start its QOI file
+* return value:           false if there is no job
+***************************************************************************************/
+static bool job_start(){
+  if((long)(millis() - next_scan_ms) < 0)
+    return false;
+  do {
+    if(!retention_find(TRANSCODE_SUFFIX, &cursor, job.path, sizeof(job.path))){
+      // all captures are done, look for new captures later
+      cursor = 0;
+      next_scan_ms = millis() + TRANSCODE_RESCAN_MS;
+      return false;
+    }
+  } while(is_failed(job.path));
+  // a capture that is being downloaded is done with the next scan
+  if(file_server_busy(*transcode_fs, job.path))
+    return false;
+  size_t base = strlen(job.path) - strlen(TRANSCODE_SUFFIX);
+  snprintf(job.qoi_path, sizeof(job.qoi_path), "%.*s%s", (int)base, job.path, TRANSCODE_EXTENSION);
+  snprintf(job.tmp_path, sizeof(job.tmp_path), "%s.tmp", job.qoi_path);
+  job.active = true;
+  job.start_ms = millis();
+  job.row = 0;
+  job.block_first = 0;
+  job.block_rows = 0;
+  memset(&job.state, 0, sizeof(job.state));
+  // power loss after the rename: the QOI file is complete
+  if(transcode_fs->exists(job.qoi_path)){
+    job_swap();
+    job.active = false;
+    return false;
+  }
+  job.bmp = transcode_fs->open(job.path, FILE_READ);
+  uint8_t header[54];
+  if(!job.bmp || job.bmp.read(header, sizeof(header)) != sizeof(header) ||
+     header[0] != 'B' || header[1] != 'M'){
+    job_fail("no BMP file");
+    return false;
+  }
+  job.pixel_offset = get_le32(header + 10);
+  job.width = (int32_t) get_le32(header + 18);
+  job.height = (int32_t) get_le32(header + 22);
+  uint16_t bits = header[28] | (header[29] << 8);
+  uint32_t compression = get_le32(header + 30);
+  job.stride = (3 * job.width + 3) & ~3;
+  // only the bottom-up 24 bit images of the captures
+  if(bits != 24 || compression != 0 || job.width <= 0 || job.width > TRANSCODE_MAX_WIDTH ||
+     job.height <= 0 || job.bmp.size() < job.pixel_offset + (size_t)job.stride * job.height){
+    job_fail("unsupported BMP format");
+    return false;
+  }
+  if(!block){
+    size_t size = TRANSCODE_READ_ROWS * ((3 * TRANSCODE_MAX_WIDTH + 3) & ~3);
+    if(psramFound())
+      block = (uint8_t *) ps_malloc(size);
+    if(!block)
+      block = (uint8_t *) malloc(size);
+    if(!block){
+      job_fail("no memory");
+      return false;
+    }
+  }
+  job.qoi = transcode_fs->open(job.tmp_path, FILE_WRITE);
+  if(!job.qoi){
+    job_fail("unable to create the QOI file");
+    return false;
+  }
+  // the BMP file is not evicted while it is read
+  retention_hold(job.path);
+  uint8_t qoi_header[QOI_HEADER_SIZE] = { 'q', 'o', 'i', 'f' };
+  put_be32(qoi_header + 4, job.width);
+  put_be32(qoi_header + 8, job.height);
+  // RGB, sRGB
+  qoi_header[12] = 3;
+  qoi_header[13] = 0;
+  transcode_writer.begin(job.qoi);
+  transcode_writer.write(qoi_header, sizeof(qoi_header));
+  job.state.prev = 0xFF000000;
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          job_finish
+* Description:            complete the QOI file and swap it with the BMP file
+***************************************************************************************/
+static void job_finish(){
+  qoi_state_t &q = job.state;
+  size_t n = 0;
+  if(q.run > 0)
+    qoi_row[n++] = QOI_OP_RUN | (q.run - 1);
+  // end marker
+  static const uint8_t padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+  memcpy(qoi_row + n, padding, sizeof(padding));
+  transcode_writer.write(qoi_row, n + sizeof(padding));
+  if(!transcode_writer.end()){
+    job_fail("write error");
+    return;
+  }
+  job_close();
+  if(!transcode_fs->rename(job.tmp_path, job.qoi_path)){
+    job_fail("rename failed");
+    return;
+  }
+  job_swap();
+}
+
+
+/***************************************************************************************
+* Function name:          job_rows
+* Description:            code rows until the time is up
+* return value:           false on a read error
+***************************************************************************************/
+static bool job_rows(unsigned long start, long slice_us){
+  while(job.row < job.height && (long)(micros() - start) < slice_us){
+    if(job.row >= job.block_first + job.block_rows){
+      // the next rows (top-down) are the previous rows in the file (bottom-up)
+      job.block_first = job.row;
+      job.block_rows = min(TRANSCODE_READ_ROWS, job.height - job.row);
+      int file_row = job.height - job.row - job.block_rows;
+      size_t size = (size_t)job.block_rows * job.stride;
+      if(!job.bmp.seek(job.pixel_offset + (size_t)file_row * job.stride) ||
+         job.bmp.read(block, size) != size)
+        return false;
+    }
+    const uint8_t *bgr = block + (size_t)(job.block_first + job.block_rows - 1 - job.row) * job.stride;
+    size_t n = qoi_encode_row(job.state, bgr, job.width, qoi_row);
+    transcode_writer.write(qoi_row, n);
+    job.row++;
+  }
+  return true;
+}
+
+
+void transcode_begin(fs::FS &fs){
+  transcode_fs = &fs;
+}
+
+
+/***************************************************************************************
+* Function name:          transcode_service
+* Description:            work on the current job in the idle time before the next frame
+*                         needs to be called frequently from loop()
+***************************************************************************************/
+void transcode_service(long idle_us){
+  long slice_us = min(idle_us - TRANSCODE_MARGIN_US, (long)TRANSCODE_SLICE_MAX_US);
+  // the captures have precedence (and the retention index belongs to the storage task)
+  if(!transcode_fs || slice_us <= 0 || storage_pending() > 0)
+    return;
+  unsigned long start = micros();
+  if(!job.active && !job_start())
+    return;
+  if(!job_rows(start, slice_us)){
+    job_fail("read error");
+    return;
+  }
+  // the BMP file is removed by the swap, not during a download
+  if(job.row >= job.height && !file_server_busy(*transcode_fs, job.path))
+    job_finish();
+  uint32_t us = micros() - start;
+  transcode_stats.slices++;
+  if(us > transcode_stats.slice_max_us)
+    transcode_stats.slice_max_us = us;
+}
+
+
+size_t transcode_status_json(char *buf, size_t size){
+  int n = snprintf(buf, size,
+                   "{\"files\":%u,\"failed\":%u,\"bytes_in\":%llu,\"bytes_out\":%llu,\"ratio\":%.1f,"
+                   "\"slices\":%u,\"slice_max_us\":%u,\"file_ms\":%u,\"current\":\"%s\",\"row\":%d}",
+                   (unsigned)transcode_stats.files, (unsigned)transcode_stats.failed,
+                   (unsigned long long)transcode_stats.bytes_in,
+                   (unsigned long long)transcode_stats.bytes_out,
+                   transcode_stats.bytes_out ? (double)transcode_stats.bytes_in / transcode_stats.bytes_out : 0.0,
+                   (unsigned)transcode_stats.slices, (unsigned)transcode_stats.slice_max_us,
+                   (unsigned)transcode_stats.file_ms, job.active ? job.path : "",
+                   job.active ? job.row : 0);
+  return n < 0 ? 0 : min((size_t)n, size - 1);
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * transcode.h
+ * Background transcoding of the BMP captures of the M5Stack Screen-Capture
+ * firmware.
+ *
+ * A BMP capture of the screen has 230 kB, the same image as QOI ("Quite
+ * OK Image Format", lossless) has 10..30 kB for the dashboard: large
+ * areas of one colour are coded as runs and repeated colours as one
+ * byte. QOI needs no compression tables and codes one row at a time, so
+ * the work can be cut into slices of a few rows.
+ *
+ * The jobs are the BMP captures in the retention index (retention.h),
+ * the oldest first. loop() calls transcode_service() with the idle time
+ * until the next frame; a slice:
+ *  - only runs if nothing else is waiting: no capture is being written
+ *    (storage_pending()), and loop() does not call it during a burst or
+ *    while a client is waiting for the connection; a capture that is being
+ *    downloaded (file_server.h) is left for the next scan
+ *  - reads the BMP rows (bottom-up) in blocks of TRANSCODE_READ_ROWS rows
+ *    and codes row by row until the idle time minus TRANSCODE_MARGIN_US
+ *    (at most TRANSCODE_SLICE_MAX_US) is used up
+ * The frames stay on time, the transcoding uses the time loop() would
+ * sleep otherwise.
+ *
+ * The file is swapped atomically: the QOI image is written under a
+ * temporary name (.qoi.tmp) and renamed when it is complete, then the BMP
+ * file is removed and the capture is replaced in the retention index
+ * (same place in the eviction order). After a power loss in between, the
+ * job finds the complete QOI image and finishes the swap; an incomplete
+ * temporary file is overwritten by the next attempt.
+ *
+ * tools/qoi2png.py converts the QOI images to PNG.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef TRANSCODE_H
+#define TRANSCODE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+#define TRANSCODE_SUFFIX ".bmp"
+#define TRANSCODE_EXTENSION ".qoi"
+// longest slice and idle time that is left for the start of the next frame
+#ifndef TRANSCODE_SLICE_MAX_US
+#define TRANSCODE_SLICE_MAX_US 4000
+#endif
+#define TRANSCODE_MARGIN_US 1000
+// BMP rows per read
+#define TRANSCODE_READ_ROWS 8
+#define TRANSCODE_MAX_WIDTH 480
+// pause after all captures have been transcoded
+#define TRANSCODE_RESCAN_MS 10000
+// files that could not be transcoded and are not tried again
+#define TRANSCODE_MAX_FAILED 4
+
+struct transcode_stats_t {
+  uint32_t files;
+  uint32_t failed;
+  // size of the BMP files and the QOI files
+  uint64_t bytes_in;
+  uint64_t bytes_out;
+  uint32_t slices;
+  uint32_t slice_max_us;
+  // time of the last file from the first to the last slice
+  uint32_t file_ms;
+};
+
+extern transcode_stats_t transcode_stats;
+
+void transcode_begin(fs::FS &fs);
+// one slice of the current job, idle_us: time until the next frame
+void transcode_service(long idle_us);
+// status as JSON object (for GET /api/transcode)
+size_t transcode_status_json(char *buf, size_t size);
+
+#endif
@@ -0,0 +1,393 @@
+/******************************************************************************
+ * websocket.cpp
+ * WebSocket live view for the M5Stack Screen-Capture firmware.
+ * See websocket.h for a description of the protocol.
+ *
+ * WebSocket protocol: RFC 6455
+ * Only the parts needed for the live view are implemented:
+ * single-frame binary messages, ping/pong and close.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "websocket.h"
+#include <M5Stack.h>
+#include "screen.h"
+#include "http_writer.h"
+#include "logger.h"
+
+// largest message that is accepted from a browser (commands are tiny)
+#define WS_RX_SIZE 32
+// payload size of one frame update message
+#define WS_TX_SIZE 4096
+// WebSocket header of a server message: max. 4 bytes for payloads < 64k
+#define WS_TX_HEADER 4
+// maximum screen width for the tile band buffer
+#define WS_MAX_WIDTH 320
+#define WS_TILES_X (WS_MAX_WIDTH / WS_TILE_SIZE)
+#define WS_TILES_Y (240 / WS_TILE_SIZE)
+
+struct ws_client_t {
+  WiFiClient client;
+  bool active;
+  // send all tiles with the next update (new connection)
+  bool force_all;
+  ScreenRect dirty;
+  unsigned long next_update;
+  uint32_t tile_hash[WS_TILES_X * WS_TILES_Y];
+  uint8_t rx[WS_RX_SIZE];
+  size_t rx_len;
+};
+
+static ws_client_t ws_clients[WS_MAX_CLIENTS];
+static ws_command_callback_t ws_command_callback = NULL;
+static uint8_t ws_tx[WS_TX_HEADER + WS_TX_SIZE];
+static uint16_t ws_band[WS_MAX_WIDTH * WS_TILE_SIZE];
+
+
+/***************************************************************************************
+* Function name:          sha1
+* Description:            SHA-1 hash, needed for the Sec-WebSocket-Accept header
+***************************************************************************************/
+static inline uint32_t rol32(uint32_t v, int n){
+  return (v << n) | (v >> (32 - n));
+}
+
+static void sha1(const uint8_t *data, size_t len, uint8_t digest[20]){
+  uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+  // the message is short (key + GUID), so the padded message fits into 2 blocks
+  uint8_t msg[128];
+  size_t n_blocks = (len + 8) / 64 + 1;
+  memset(msg, 0, sizeof(msg));
+  memcpy(msg, data, len);
+  msg[len] = 0x80;
+  uint64_t bits = (uint64_t)len * 8;
+  for(int i=0; i<8; i++)
+    msg[n_blocks*64 - 1 - i] = (uint8_t)(bits >> (8*i));
+  for(size_t block=0; block<n_blocks; block++){
+    uint32_t w[80];
+    for(int i=0; i<16; i++){
+      const uint8_t *p = &msg[block*64 + i*4];
+      w[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+    for(int i=16; i<80; i++)
+      w[i] = rol32(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for(int i=0; i<80; i++){
+      uint32_t f, k;
+      if(i < 20)      { f = (b & c) | (~b & d);          k = 0x5A827999; }
+      else if(i < 40) { f = b ^ c ^ d;                   k = 0x6ED9EBA1; }
+      else if(i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+      else            { f = b ^ c ^ d;                   k = 0xCA62C1D6; }
+      uint32_t t = rol32(a, 5) + f + e + k + w[i];
+      e = d; d = c; c = rol32(b, 30); b = a; a = t;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+  }
+  for(int i=0; i<20; i++)
+    digest[i] = (uint8_t)(h[i/4] >> (24 - 8*(i%4)));
+}
+
+
+static void base64_encode(const uint8_t *data, size_t len, char *out){
+  static const char table[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t i = 0;
+  for(; i + 2 < len; i += 3){
+    uint32_t v = (data[i] << 16) | (data[i+1] << 8) | data[i+2];
+    *out++ = table[(v >> 18) & 63];
+    *out++ = table[(v >> 12) & 63];
+    *out++ = table[(v >> 6) & 63];
+    *out++ = table[v & 63];
+  }
+  if(i < len){
+    uint32_t v = data[i] << 16;
+    if(i + 1 < len)
+      v |= data[i+1] << 8;
+    *out++ = table[(v >> 18) & 63];
+    *out++ = table[(v >> 12) & 63];
+    *out++ = (i + 1 < len) ? table[(v >> 6) & 63] : '=';
+    *out++ = '=';
+  }
+  *out = 0;
+}
+
+
+static void ws_close(ws_client_t &c){
+  uint8_t close_frame[2] = { 0x88, 0x00 };
+  c.client.write(close_frame, 2);
+  c.client.stop();
+  c.active = false;
+  screen_remove_tracker(&c.dirty);
+  logger_fast(LOG_HTTP, LOG_INFO, "WebSocket client %d closed", (int32_t)(&c - ws_clients));
+}
+
+
+/***************************************************************************************
+* Function name:          ws_send
+* Description:            send one unmasked WebSocket frame
+*                         payload must point behind WS_TX_HEADER reserved bytes
+*                         The connection is closed if the frame is not sent completely:
+*                         a partial frame breaks the framing of everything after it.
+* return value:           false if the client was closed
+***************************************************************************************/
+static bool ws_send(ws_client_t &c, uint8_t opcode, uint8_t *payload, size_t len){
+  uint8_t *frame;
+  if(len < 126){
+    frame = payload - 2;
+    frame[1] = (uint8_t)len;
+  } else {
+    frame = payload - 4;
+    frame[1] = 126;
+    frame[2] = (uint8_t)(len >> 8);
+    frame[3] = (uint8_t)len;
+  }
+  // FIN bit + opcode
+  frame[0] = 0x80 | opcode;
+  size_t total = len + (payload - frame);
+  if(c.client.write(frame, total) == total)
+    return true;
+  ws_close(c);
+  return false;
+}
+
+
+/***************************************************************************************
+* Function name:          ws_accept
+* Description:            answer the upgrade request and take over the connection
+* parameter:              key = value of the Sec-WebSocket-Key header
+* return value:           false if all client slots are in use
+***************************************************************************************/
+bool ws_accept(WiFiClient &client, const char *key){
+  ws_client_t *c = NULL;
+  for(int i=0; i<WS_MAX_CLIENTS; i++){
+    if(!ws_clients[i].active){
+      c = &ws_clients[i];
+      break;
+    }
+  }
+  if(!c || strlen(key) > 40)
+    return false;
+  char accept_src[80];
+  snprintf(accept_src, sizeof(accept_src), "%s258EAFA5-E914-47DA-95CA-C5AB0DC85B11", key);
+  uint8_t digest[20];
+  sha1((const uint8_t *)accept_src, strlen(accept_src), digest);
+  char accept[32];
+  base64_encode(digest, 20, accept);
+
+  http_response.begin(client);
+  http_response.status(101, "Switching Protocols");
+  http_response.header("Upgrade", "websocket");
+  http_response.header("Connection", "Upgrade");
+  http_response.header("Sec-WebSocket-Accept", accept);
+  http_response.end_headers();
+  http_response.end();
+
+  c->client = client;
+  c->active = true;
+  c->force_all = true;
+  c->rx_len = 0;
+  c->next_update = millis();
+  c->dirty.clear();
+  c->dirty.add(0, 0, M5.Lcd.width(), M5.Lcd.height());
+  screen_add_tracker(&c->dirty);
+  logger_fast(LOG_HTTP, LOG_INFO, "WebSocket client %d connected", (int32_t)(c - ws_clients));
+  return true;
+}
+
+
+/***************************************************************************************
+* Function name:          ws_receive
+* Description:            read and handle the messages from the browser
+***************************************************************************************/
+static void ws_receive(ws_client_t &c){
+  while(c.client.available() && c.rx_len < WS_RX_SIZE)
+    c.rx[c.rx_len++] = c.client.read();
+  while(c.rx_len >= 2){
+    uint8_t opcode = c.rx[0] & 0x0F;
+    bool masked = c.rx[1] & 0x80;
+    size_t len = c.rx[1] & 0x7F;
+    // messages from the browser must be masked and are always small
+    if(!masked || len > WS_RX_SIZE - 6){
+      ws_close(c);
+      return;
+    }
+    size_t total = 6 + len;
+    if(c.rx_len < total)
+      return;
+    uint8_t *mask = &c.rx[2];
+    uint8_t *payload = &c.rx[6];
+    for(size_t i=0; i<len; i++)
+      payload[i] ^= mask[i & 3];
+    switch(opcode){
+      case 0x2: // binary message
+        if(len >= 2 && ws_command_callback)
+          ws_command_callback(payload[0], payload[1]);
+        break;
+      case 0x8: // close
+        ws_close(c);
+        return;
+      case 0x9: { // ping -> pong with the same payload
+        uint8_t pong[WS_TX_HEADER + WS_RX_SIZE];
+        memcpy(pong + WS_TX_HEADER, payload, len);
+        if(!ws_send(c, 0xA, pong + WS_TX_HEADER, len))
+          return;
+        break;
+      }
+      default:
+        break;
+    }
+    c.rx_len -= total;
+    memmove(c.rx, c.rx + total, c.rx_len);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          ws_send_tiles
+* Description:            send all changed tiles inside the dirty rectangle
+*                         The tiles are compared by a hash of their content, so
+*                         a redraw with the same pixels does not cause any traffic.
+***************************************************************************************/
+static void ws_send_tiles(ws_client_t &c){
+  uint8_t *payload = ws_tx + WS_TX_HEADER;
+  size_t len = 0;
+  uint16_t n_tiles = 0;
+  // align the dirty rectangle to the tile grid
+  int tx0 = c.dirty.x0 / WS_TILE_SIZE;
+  int ty0 = c.dirty.y0 / WS_TILE_SIZE;
+  int tx1 = (c.dirty.x1 + WS_TILE_SIZE - 1) / WS_TILE_SIZE;
+  int ty1 = (c.dirty.y1 + WS_TILE_SIZE - 1) / WS_TILE_SIZE;
+  c.dirty.clear();
+  int band_x = tx0 * WS_TILE_SIZE;
+  int band_w = min(tx1 * WS_TILE_SIZE, (int)M5.Lcd.width()) - band_x;
+  for(int ty=ty0; ty<ty1; ty++){
+    int y = ty * WS_TILE_SIZE;
+    int h = min(WS_TILE_SIZE, M5.Lcd.height() - y);
+    screen_read_rgb565(band_x, y, band_w, h, ws_band);
+    for(int tx=tx0; tx<tx1; tx++){
+      int x = tx * WS_TILE_SIZE;
+      int w = min(WS_TILE_SIZE, M5.Lcd.width() - x);
+      uint16_t *tile = ws_band + (x - band_x);
+      // FNV-1a hash of the tile content
+      uint32_t hash = 2166136261u;
+      for(int row=0; row<h; row++){
+        for(int i=0; i<w; i++){
+          uint16_t p = tile[row*band_w + i];
+          hash = (hash ^ (p & 0xFF)) * 16777619u;
+          hash = (hash ^ (p >> 8)) * 16777619u;
+        }
+      }
+      uint32_t &known = c.tile_hash[ty*WS_TILES_X + tx];
+      if(!c.force_all && known == hash)
+        continue;
+      known = hash;
+      // worst case: every pixel is a run of its own
+      if(len + 10 + w*h*3 > WS_TX_SIZE){
+        payload[5] = n_tiles & 0xFF;
+        payload[6] = n_tiles >> 8;
+        // the tiles are marked as sent already, the client is closed on a failure
+        if(!ws_send(c, 0x2, payload, len))
+          return;
+        len = 0;
+        n_tiles = 0;
+      }
+      if(len == 0){
+        payload[0] = WS_MSG_FRAME;
+        for(int i=0; i<4; i++)
+          payload[1+i] = (uint8_t)(screen_generation >> (8*i));
+        len = 7;
+      }
+      uint8_t *t = payload + len;
+      t[0] = x & 0xFF; t[1] = x >> 8;
+      t[2] = y & 0xFF; t[3] = y >> 8;
+      t[4] = w - 1;
+      t[5] = h - 1;
+      size_t pos = 8;
+      uint16_t n_runs = 0;
+      // run length encoding of the tile (row by row)
+      int count = 0;
+      uint16_t color = 0;
+      for(int row=0; row<h; row++){
+        for(int i=0; i<w; i++){
+          uint16_t p = tile[row*band_w + i];
+          if(count > 0 && (p != color || count == 256)){
+            t[pos++] = count - 1;
+            t[pos++] = color & 0xFF;
+            t[pos++] = color >> 8;
+            n_runs++;
+            count = 0;
+          }
+          color = p;
+          count++;
+        }
+      }
+      t[pos++] = count - 1;
+      t[pos++] = color & 0xFF;
+      t[pos++] = color >> 8;
+      n_runs++;
+      t[6] = n_runs & 0xFF;
+      t[7] = n_runs >> 8;
+      len += pos;
+      n_tiles++;
+    }
+  }
+  c.force_all = false;
+  if(n_tiles > 0){
+    payload[5] = n_tiles & 0xFF;
+    payload[6] = n_tiles >> 8;
+    ws_send(c, 0x2, payload, len);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          ws_service
+* Description:            handle incoming messages and send screen updates
+*                         needs to be called frequently from loop()
+***************************************************************************************/
+void ws_service(){
+  unsigned long now = millis();
+  for(int i=0; i<WS_MAX_CLIENTS; i++){
+    ws_client_t &c = ws_clients[i];
+    if(!c.active)
+      continue;
+    if(!c.client.connected()){
+      ws_close(c);
+      continue;
+    }
+    ws_receive(c);
+    if(!c.active)
+      continue;
+    if(!c.dirty.empty() && (long)(now - c.next_update) >= 0){
+      ws_send_tiles(c);
+      c.next_update = now + WS_UPDATE_INTERVAL_MS;
+    }
+  }
+}
+
+
+void ws_button_event(char button){
+  for(int i=0; i<WS_MAX_CLIENTS; i++){
+    if(ws_clients[i].active){
+      uint8_t msg[WS_TX_HEADER + 2];
+      msg[WS_TX_HEADER] = WS_MSG_BUTTON;
+      msg[WS_TX_HEADER + 1] = button;
+      ws_send(ws_clients[i], 0x2, msg + WS_TX_HEADER, 2);
+    }
+  }
+}
+
+
+int ws_client_count(){
+  int n = 0;
+  for(int i=0; i<WS_MAX_CLIENTS; i++){
+    if(ws_clients[i].active)
+      n++;
+  }
+  return n;
+}
+
+
+void ws_begin(ws_command_callback_t callback){
+  ws_command_callback = callback;
+}
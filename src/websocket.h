@@ -0,0 +1,53 @@
+/******************************************************************************
+ * websocket.h
+ * WebSocket live view for the M5Stack Screen-Capture firmware.
+ *
+ * A browser connects to ws://<device>/ws and receives the screen content
+ * as incremental updates: the screen is divided into tiles of 16x16
+ * pixels and only tiles that changed since the last update are sent,
+ * run-length compressed. Button presses on the device are pushed to the
+ * browser as well. The browser can send button presses and gauge values.
+ *
+ * All messages are binary, multi-byte values are little endian.
+ *
+ * device -> browser:
+ *   0x01 frame update:  u32 generation, u16 number of tiles, then per tile:
+ *                       u16 x, u16 y, u8 width-1, u8 height-1, u16 number of runs,
+ *                       runs of (u8 count-1, u16 RGB565 color)
+ *   0x02 button event:  u8 button ('A', 'B' or 'C')
+ *
+ * browser -> device:
+ *   0x01 button press:  u8 button ('A', 'B' or 'C')
+ *   0x02 gauge value:   u8 value (0..100)
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef WEBSOCKET_H
+#define WEBSOCKET_H
+
+#include <Arduino.h>
+#include "WiFi.h"
+
+// number of live view clients served at the same time
+#define WS_MAX_CLIENTS 2
+// minimum time between two frame updates for one client
+#define WS_UPDATE_INTERVAL_MS 100
+// edge length of the tiles for the change detection
+#define WS_TILE_SIZE 16
+
+// message types
+#define WS_MSG_FRAME   0x01
+#define WS_MSG_BUTTON  0x02
+#define WS_CMD_BUTTON  0x01
+#define WS_CMD_GAUGE   0x02
+
+// called for every command received from a browser
+typedef void (*ws_command_callback_t)(uint8_t command, uint8_t argument);
+
+void ws_begin(ws_command_callback_t callback);
+bool ws_accept(WiFiClient &client, const char *key);
+void ws_service();
+void ws_button_event(char button);
+int ws_client_count();
+
+#endif
@@ -0,0 +1,327 @@
+/******************************************************************************
+ * widgets.cpp
+ * Dashboard of gauges, bar graphs and numeric readouts.
+ * See widgets.h for a description.
+ *
+ * An area of the screen is always drawn completely: background from the
+ * compressed gauge image, then all gauges and bars that overlap the area
+ * (anti-aliased, raster.h), then the numeric readouts. With the canvas,
+ * the area is composed in the canvas and sent in one transfer. Without
+ * canvas, gauges and bars are drawn into the background strips before
+ * they are sent, the text is drawn on the LCD afterwards.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include "widgets.h"
+#include <M5Stack.h>
+#include "Free_Fonts.h"
+#include "canvas.h"
+#include "gauge_bg.h"
+#include "gauge_geometry.h"
+#include "raster.h"
+#include "logger.h"
+
+// maximum length of the text of a numeric readout
+#define WIDGET_TEXT_SIZE 16
+// color of the frame around the bar graphs
+#define WIDGET_FRAME_COLOR TFT_DARKGREY
+
+unsigned long widgets_render_us;
+uint32_t widgets_render_pixels;
+static widget_t *widgets = NULL;
+static int widget_count = 0;
+// false: the whole dashboard needs to be drawn
+static bool widgets_on_screen = false;
+
+// sub-pixel geometry of a gauge
+struct gauge_shapes_t {
+  // center, end of the line, radius of the center circle
+  int32_t cx, cy, lx, ly, radius;
+  gauge_needle_fixed_t needle;
+};
+
+
+// value in percent of the widget range, -1 if outside of the range
+static float widget_percent(const widget_t &w, float value){
+  if(!(value >= w.min && value <= w.max) || w.max <= w.min)
+    return -1;
+  return (value - w.min) * 100 / (w.max - w.min);
+}
+
+
+static void widget_text(const widget_t &w, float value, char *text){
+  snprintf(text, WIDGET_TEXT_SIZE, w.format ? w.format : "%.0f", value);
+}
+
+
+/***************************************************************************************
+* Function name:          widget_quantize
+* Description:            the visible result of a value: table index of a gauge,
+*                         height of a bar in pixels, hash of the text of a readout
+***************************************************************************************/
+static int32_t widget_quantize(const widget_t &w, float value){
+  switch(w.type){
+    case WIDGET_GAUGE: {
+      float percent = widget_percent(w, value);
+      return percent < 0 ? -1 : gauge_index(percent);
+    }
+    case WIDGET_BAR: {
+      float percent = widget_percent(w, constrain(value, w.min, w.max));
+      return percent < 0 ? 0 : (int32_t)(percent * (w.h - 2) / 100 + 0.5f);
+    }
+    case WIDGET_NUMBER: {
+      char text[WIDGET_TEXT_SIZE];
+      widget_text(w, value, text);
+      // FNV-1a
+      uint32_t hash = 2166136261u;
+      for(const char *c = text; *c; c++)
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+      return (int32_t)hash;
+    }
+  }
+  return 0;
+}
+
+
+static void gauge_shapes(const widget_t &w, gauge_shapes_t &s){
+  int length = min(w.w, w.h) / 3;
+  s.cx = raster_center(w.x + w.w/2);
+  s.cy = raster_center(w.y + w.h/2);
+  s.radius = length / 8;
+  if(w.shown2 >= 0)
+    gauge_tip_fixed(w.shown2, length, s.cx, s.cy, RASTER_SUBPIXEL, s.lx, s.ly);
+  if(w.shown >= 0)
+    gauge_arrow_fixed(w.shown, length, s.cx, s.cy, RASTER_SUBPIXEL, s.needle);
+}
+
+
+// grow an area by a fixed-point bounding box plus one pixel for the anti-aliasing
+static void add_fixed_box(ScreenRect &area, int32_t x0, int32_t y0, int32_t x1, int32_t y1){
+  int px0 = (x0 >> RASTER_SUBPIXEL) - 1;
+  int py0 = (y0 >> RASTER_SUBPIXEL) - 1;
+  int px1 = (x1 >> RASTER_SUBPIXEL) + 2;
+  int py1 = (y1 >> RASTER_SUBPIXEL) + 2;
+  area.add(px0, py0, px1 - px0, py1 - py0);
+}
+
+
+/***************************************************************************************
+* Function name:          widget_area
+* Description:            area of the dynamic content of a widget for the shown values
+*                         gauge: needle, line and center circle
+*                         bar:   filled part of the bar
+*                         readout: the whole widget
+***************************************************************************************/
+static void widget_area(const widget_t &w, ScreenRect &area){
+  area.clear();
+  if(w.type == WIDGET_GAUGE){
+    gauge_shapes_t s;
+    gauge_shapes(w, s);
+    if(w.shown2 >= 0)
+      add_fixed_box(area, min(s.cx, s.lx), min(s.cy, s.ly), max(s.cx, s.lx), max(s.cy, s.ly));
+    if(w.shown >= 0){
+      const gauge_needle_fixed_t &a = s.needle;
+      add_fixed_box(area, min(a.x2, min(a.x3, a.x4)), min(a.y2, min(a.y3, a.y4)),
+                    max(a.x2, max(a.x3, a.x4)), max(a.y2, max(a.y3, a.y4)));
+      int r = s.radius + 1;
+      area.add((s.cx >> RASTER_SUBPIXEL) - r, (s.cy >> RASTER_SUBPIXEL) - r, 2*r + 1, 2*r + 1);
+    }
+  } else if(w.type == WIDGET_BAR){
+    area.add(w.x + 1, w.y + w.h - 1 - w.shown, w.w - 2, w.shown);
+  } else {
+    area.add(w.x, w.y, w.w, w.h);
+  }
+}
+
+
+static void draw_gauge(const widget_t &w, const RasterTarget &t){
+  gauge_shapes_t s;
+  gauge_shapes(w, s);
+  if(w.shown2 >= 0)
+    raster_line(t, s.cx, s.cy, s.lx, s.ly, RASTER_ONE, TFT_GREEN);
+  if(w.shown >= 0){
+    const gauge_needle_fixed_t &a = s.needle;
+    raster_triangle(t, a.x2, a.y2, a.x3, a.y3, a.x4, a.y4, w.color);
+    // the center circles cover the same pixels as fillCircle() with radius 10 and 2
+    raster_disc(t, s.cx, s.cy, s.radius*RASTER_ONE + RASTER_ONE/2, w.color);
+    raster_disc(t, s.cx, s.cy, (s.radius/5)*RASTER_ONE + RASTER_ONE/2, TFT_BLACK);
+  }
+}
+
+
+static void draw_bar(const widget_t &w, const RasterTarget &t){
+  raster_fill_rect(t, w.x, w.y, w.w, 1, WIDGET_FRAME_COLOR);
+  raster_fill_rect(t, w.x, w.y + w.h - 1, w.w, 1, WIDGET_FRAME_COLOR);
+  raster_fill_rect(t, w.x, w.y + 1, 1, w.h - 2, WIDGET_FRAME_COLOR);
+  raster_fill_rect(t, w.x + w.w - 1, w.y + 1, 1, w.h - 2, WIDGET_FRAME_COLOR);
+  raster_fill_rect(t, w.x + 1, w.y + w.h - 1 - w.shown, w.w - 2, w.shown, w.color);
+}
+
+
+static bool widget_overlaps(const widget_t &w, int x, int y, int width, int height){
+  return w.x < x + width && w.x + w.w > x && w.y < y + height && w.y + w.h > y;
+}
+
+
+// draw all gauges and bars that overlap the target
+static void draw_raster_widgets(const RasterTarget &t){
+  for(int i=0; i<widget_count; i++){
+    const widget_t &w = widgets[i];
+    if(!widget_overlaps(w, t.x, t.y, t.w, t.h))
+      continue;
+    if(w.type == WIDGET_GAUGE)
+      draw_gauge(w, t);
+    else if(w.type == WIDGET_BAR)
+      draw_bar(w, t);
+  }
+}
+
+
+// overlay function for gauge_bg_push_rect() (drawing without canvas)
+static void draw_strip(uint16_t *pixels, int x, int y, int w, int h){
+  RasterTarget t = { pixels, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, (int16_t)w, false };
+  draw_raster_widgets(t);
+}
+
+
+// draw all numeric readouts that overlap the area
+static void draw_text_widgets(TFT_eSPI &gfx, const ScreenRect &area){
+  for(int i=0; i<widget_count; i++){
+    const widget_t &w = widgets[i];
+    if(w.type != WIDGET_NUMBER || !widget_overlaps(w, area.x0, area.y0, area.width(), area.height()))
+      continue;
+    char text[WIDGET_TEXT_SIZE];
+    widget_text(w, w.value, text);
+    gfx.setTextDatum(CC_DATUM);
+    gfx.setFreeFont(FF1);
+    gfx.setTextColor(w.color);
+    gfx.drawString(text, w.x + w.w/2, w.y + w.h/2, 1);
+  }
+}
+
+
+/***************************************************************************************
+* Function name:          render_area
+* Description:            restore the background of a screen area and draw all widgets
+*                         in that area
+***************************************************************************************/
+static void render_area(const ScreenRect &area){
+  if(area.empty())
+    return;
+  if(canvas_ready()){
+    uint16_t *pixels = canvas_buffer() + area.y0*GAUGE_BG_WIDTH + area.x0;
+    gauge_bg_decode_rect(area.x0, area.y0, area.width(), area.height(), pixels, GAUGE_BG_WIDTH, true);
+    RasterTarget t = { pixels, area.x0, area.y0, area.width(), area.height(), GAUGE_BG_WIDTH, true };
+    draw_raster_widgets(t);
+    draw_text_widgets(canvas(), area);
+    canvas_push(area.x0, area.y0, area.width(), area.height());
+  } else {
+    gauge_bg_push_rect(area.x0, area.y0, area.width(), area.height(), draw_strip);
+    draw_text_widgets(M5.Lcd, area);
+  }
+  screen_invalidate(area.x0, area.y0, area.width(), area.height());
+  widgets_render_pixels += area.width() * area.height();
+}
+
+
+void widgets_begin(widget_t *table, int count){
+  widgets = table;
+  widget_count = count;
+  for(int i=0; i<count; i++){
+    widget_t &w = widgets[i];
+    w.value = w.min;
+    w.value2 = NAN;
+    w.shown = widget_quantize(w, w.value);
+    w.shown2 = -1;
+    w.dirty = false;
+    w.area.clear();
+  }
+  widgets_on_screen = false;
+}
+
+
+void widget_set(int index, float value){
+  if(index < 0 || index >= widget_count)
+    return;
+  widget_t &w = widgets[index];
+  w.value = value;
+  int32_t shown = widget_quantize(w, value);
+  if(shown != w.shown){
+    w.shown = shown;
+    w.dirty = true;
+  }
+}
+
+
+void widget_set2(int index, float value2){
+  if(index < 0 || index >= widget_count || widgets[index].type != WIDGET_GAUGE)
+    return;
+  widget_t &w = widgets[index];
+  w.value2 = value2;
+  int32_t shown2 = widget_quantize(w, value2);
+  if(shown2 != w.shown2){
+    w.shown2 = shown2;
+    w.dirty = true;
+  }
+}
+
+
+void widgets_invalidate(){
+  widgets_on_screen = false;
+}
+
+
+/***************************************************************************************
+* Function name:          widgets_update
+* Description:            redraw the widgets with changed values
+*                         Each widget restores and redraws only the area of its old and
+*                         new content (for bars only the rows between the old and the
+*                         new fill level).
+* return value:           number of redrawn widgets
+***************************************************************************************/
+int widgets_update(){
+  unsigned long start_us = micros();
+  int redrawn = 0;
+  widgets_render_pixels = 0;
+  if(!widgets_on_screen){
+    for(int i=0; i<widget_count; i++){
+      widgets[i].dirty = false;
+      widget_area(widgets[i], widgets[i].area);
+    }
+    ScreenRect all;
+    all.clear();
+    all.add(0, 0, GAUGE_BG_WIDTH, GAUGE_BG_HEIGHT);
+    render_area(all);
+    widgets_on_screen = true;
+    redrawn = widget_count;
+  } else {
+    for(int i=0; i<widget_count; i++){
+      widget_t &w = widgets[i];
+      if(!w.dirty)
+        continue;
+      w.dirty = false;
+      ScreenRect area;
+      widget_area(w, area);
+      ScreenRect changed;
+      if(w.type == WIDGET_BAR){
+        // rows between the old and the new fill level
+        int bottom = w.y + w.h - 1;
+        int old_top = w.area.empty() ? bottom : w.area.y0;
+        int new_top = area.empty() ? bottom : area.y0;
+        changed.clear();
+        changed.add(w.x + 1, min(old_top, new_top), w.w - 2, abs(new_top - old_top));
+      } else {
+        changed = w.area;
+        changed.add(area.x0, area.y0, area.width(), area.height());
+      }
+      w.area = area;
+      render_area(changed);
+      redrawn++;
+    }
+  }
+  widgets_render_us = micros() - start_us;
+  if(redrawn > 0)
+    logger_fast(LOG_SYS, LOG_DEBUG, "widgets: %d redrawn, %d pixels in %d us",
+                redrawn, widgets_render_pixels, widgets_render_us);
+  return redrawn;
+}
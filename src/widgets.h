@@ -0,0 +1,73 @@
+/******************************************************************************
+ * widgets.h
+ * Dashboard of gauges, bar graphs and numeric readouts.
+ *
+ * The dashboard is described by a layout table (array of widget_t) with
+ * the type, position, value range and color of every widget. The gauge
+ * background image is the background of the whole dashboard.
+ *
+ * New values are set with widget_set(). A widget is only redrawn if the
+ * visible result changes (gauge position in 0.1% steps, bar height in
+ * pixels, printed text), and only its own area is restored from the
+ * background, drawn again and reported with screen_invalidate().
+ * All widgets that overlap that area are drawn again (gauges and bars in
+ * table order, numeric readouts on top).
+ *
+ * usage:
+ *   widget_t dashboard[] = {
+ *     // type          x    y    w    h   min  max  color      format
+ *     { WIDGET_GAUGE,  0,   0, 320, 240,   0, 100, TFT_RED,   NULL },
+ *     { WIDGET_NUMBER, 2,   2,  48,  20,   0, 100, TFT_BLACK, "%.0f" },
+ *   };
+ *   widgets_begin(dashboard, 2);
+ *   widget_set(0, 45.0);
+ *   widgets_update();
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include <Arduino.h>
+#include "screen.h"
+
+enum widget_type_t {
+  // needle (value) and thin line (value2) around the center of the area
+  WIDGET_GAUGE,
+  // vertical bar, filled from the bottom
+  WIDGET_BAR,
+  // value printed with the format string, centered in the area
+  WIDGET_NUMBER
+};
+
+struct widget_t {
+  // layout
+  uint8_t type;
+  int16_t x, y, w, h;
+  float min, max;
+  uint16_t color;
+  const char *format;
+  // state (set by widgets_begin / widget_set)
+  float value;
+  // second value of a gauge (green line), hidden if outside min..max
+  float value2;
+  bool dirty;
+  // visible result of value and value2 (gauge index, bar height, text hash)
+  int32_t shown, shown2;
+  // area of the dynamic content on screen (e.g. the gauge needle)
+  ScreenRect area;
+};
+
+// render time and number of restored pixels of the last update
+extern unsigned long widgets_render_us;
+extern uint32_t widgets_render_pixels;
+
+void widgets_begin(widget_t *table, int count);
+void widget_set(int index, float value);
+void widget_set2(int index, float value2);
+// draw the complete dashboard with the next update (after other screen content)
+void widgets_invalidate();
+// redraw the changed widgets, return value: number of redrawn widgets
+int widgets_update();
+
+#endif
@@ -0,0 +1,197 @@
+/******************************************************************************
+ * test_raster.cpp
+ * Coverage of the anti-aliased rasterizer (src/raster.h) compared with a
+ * 16x16 supersampled reference.
+ *
+ *   pio test -e native -f test_raster
+ *
+ * Every shape is drawn in white on a black buffer and the coverage of a
+ * pixel is read back from the green channel (6 bit). The reference counts
+ * the 256 sub-pixel centers of the pixel that are inside the exact shape
+ * (the same fixed-point coordinates). A test fails if the mean error of
+ * the edge pixels (0 < reference < 1) or the largest error of any pixel
+ * is above the bound of the shape; the figures are printed.
+ *
+ * Distributed as-is; no warranty is given.
+ ******************************************************************************/
+#include <unity.h>
+#include <Arduino.h>
+#include "../../src/raster.cpp"
+
+#define TEST_SIZE 64
+#define TEST_SUPERSAMPLE 16
+#define TEST_SHAPES 60
+// bounds of the coverage error (coverage 0..1)
+#define LINE_MEAN_MAX 0.03
+#define LINE_ERROR_MAX 0.12
+// acute corners are the worst case of the product of the edge coverages
+#define TRIANGLE_MEAN_MAX 0.04
+#define TRIANGLE_ERROR_MAX 0.30
+#define DISC_MEAN_MAX 0.03
+#define DISC_ERROR_MAX 0.12
+
+struct coverage_error_t {
+  double sum;
+  int edge_pixels;
+  double max;
+};
+
+static uint16_t pixels[TEST_SIZE * TEST_SIZE];
+static const RasterTarget target = { pixels, 0, 0, TEST_SIZE, TEST_SIZE, TEST_SIZE, false };
+static uint32_t seed = 12345;
+
+
+// deterministic random numbers, the same shapes on every run
+static double random_unit(){
+  seed = seed * 1664525 + 1013904223;
+  return (seed >> 8) / (double)(1 << 24);
+}
+
+
+static double random_range(double low, double high){
+  return low + (high - low) * random_unit();
+}
+
+
+static int32_t fixed(double v){
+  return (int32_t)lround(v * RASTER_ONE);
+}
+
+
+static double to_double(int32_t v){
+  return v / (double)RASTER_ONE;
+}
+
+
+/***************************************************************************************
+* Function name:          compare
+* Description:            compare the coverage of the drawn pixels with the supersampled
+*                         shape (inside(x, y) with pixel coordinates)
+***************************************************************************************/
+template <typename Inside>
+static void compare(Inside inside, coverage_error_t &error){
+  for(int y=0; y<TEST_SIZE; y++){
+    for(int x=0; x<TEST_SIZE; x++){
+      int count = 0;
+      for(int sy=0; sy<TEST_SUPERSAMPLE; sy++){
+        for(int sx=0; sx<TEST_SUPERSAMPLE; sx++){
+          if(inside(x + (sx + 0.5) / TEST_SUPERSAMPLE, y + (sy + 0.5) / TEST_SUPERSAMPLE))
+            count++;
+        }
+      }
+      double reference = count / (double)(TEST_SUPERSAMPLE * TEST_SUPERSAMPLE);
+      double drawn = ((pixels[y * TEST_SIZE + x] >> 5) & 0x3F) / 63.0;
+      double e = fabs(drawn - reference);
+      if(reference > 0 && reference < 1){
+        error.sum += e;
+        error.edge_pixels++;
+      }
+      if(e > error.max)
+        error.max = e;
+    }
+  }
+}
+
+
+static void check(const char *name, const coverage_error_t &error, double mean_max, double error_max){
+  double mean = error.sum / max(error.edge_pixels, 1);
+  char message[128];
+  snprintf(message, sizeof(message), "%s: %d edge pixels, mean error %.1f %%, max error %.1f %%",
+           name, error.edge_pixels, 100 * mean, 100 * error.max);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE_MESSAGE(error.edge_pixels > 0, message);
+  TEST_ASSERT_TRUE_MESSAGE(mean <= mean_max, message);
+  TEST_ASSERT_TRUE_MESSAGE(error.max <= error_max, message);
+}
+
+
+void setUp(){
+  memset(pixels, 0, sizeof(pixels));
+}
+
+
+void tearDown(){
+}
+
+
+void test_line_coverage(){
+  coverage_error_t error = { 0, 0, 0 };
+  for(int i=0; i<TEST_SHAPES; i++){
+    setUp();
+    double angle = i * 3.1;
+    double length = random_range(8, 40);
+    int32_t x0 = fixed(random_range(20, 44));
+    int32_t y0 = fixed(random_range(20, 44));
+    int32_t x1 = x0 + fixed(length * cos(angle * M_PI / 180));
+    int32_t y1 = y0 + fixed(length * sin(angle * M_PI / 180));
+    int32_t width = fixed(random_range(1, 6));
+    raster_line(target, x0, y0, x1, y1, width, 0xFFFF);
+    // rectangle around the line with square caps of half the width
+    double ax = to_double(x0), ay = to_double(y0);
+    double dx = to_double(x1) - ax, dy = to_double(y1) - ay;
+    double l = sqrt(dx * dx + dy * dy);
+    double half = to_double(width / 2);
+    compare([&](double px, double py){
+      double along = ((px - ax) * dx + (py - ay) * dy) / l;
+      double across = ((px - ax) * dy - (py - ay) * dx) / l;
+      return along >= -half && along <= l + half && fabs(across) <= half;
+    }, error);
+  }
+  check("raster_line", error, LINE_MEAN_MAX, LINE_ERROR_MAX);
+}
+
+
+void test_triangle_coverage(){
+  coverage_error_t error = { 0, 0, 0 };
+  for(int i=0; i<TEST_SHAPES; i++){
+    setUp();
+    int32_t x[3], y[3];
+    for(int j=0; j<3; j++){
+      x[j] = fixed(random_range(2, TEST_SIZE - 2));
+      y[j] = fixed(random_range(2, TEST_SIZE - 2));
+    }
+    raster_triangle(target, x[0], y[0], x[1], y[1], x[2], y[2], 0xFFFF);
+    compare([&](double px, double py){
+      // inside: the same side of all edges (either orientation)
+      int positive = 0, negative = 0;
+      for(int j=0; j<3; j++){
+        int k = (j + 1) % 3;
+        double e = (to_double(x[k]) - to_double(x[j])) * (py - to_double(y[j])) -
+                   (to_double(y[k]) - to_double(y[j])) * (px - to_double(x[j]));
+        if(e > 0)
+          positive++;
+        if(e < 0)
+          negative++;
+      }
+      return positive == 0 || negative == 0;
+    }, error);
+  }
+  check("raster_triangle", error, TRIANGLE_MEAN_MAX, TRIANGLE_ERROR_MAX);
+}
+
+
+void test_disc_coverage(){
+  coverage_error_t error = { 0, 0, 0 };
+  for(int i=0; i<TEST_SHAPES; i++){
+    setUp();
+    int32_t cx = fixed(random_range(26, 38));
+    int32_t cy = fixed(random_range(26, 38));
+    int32_t r = fixed(random_range(0.5, 25));
+    raster_disc(target, cx, cy, r, 0xFFFF);
+    double r2 = to_double(r) * to_double(r);
+    compare([&](double px, double py){
+      double dx = px - to_double(cx), dy = py - to_double(cy);
+      return dx * dx + dy * dy <= r2;
+    }, error);
+  }
+  check("raster_disc", error, DISC_MEAN_MAX, DISC_ERROR_MAX);
+}
+
+
+int main(){
+  UNITY_BEGIN();
+  RUN_TEST(test_line_coverage);
+  RUN_TEST(test_triangle_coverage);
+  RUN_TEST(test_disc_coverage);
+  return UNITY_END();
+}
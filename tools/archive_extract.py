@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+archive_extract.py
+Extract the frames of a capture archive (src/archive.h, *.m5a) as PNG
+images or as a video.
+
+The frames are found with the index at the end of the file. An archive
+without a valid index (power loss during the burst) is scanned from the
+start up to the first frame with a bad CRC.
+
+Format (little endian):
+  header  "M5AR", u16 version, u16 header size, u16 width, u16 height,
+          u16 key frame interval, u16 reserved, u32 start time (ms)
+  frame   "FRME", u32 sequence, u32 time (ms), u32 payload length,
+          u8 flags (1 = delta to the previous frame, 2 = run-length coded),
+          3 reserved bytes, payload, u32 CRC-32 of the payload
+  index   per frame: u32 offset, u32 time (ms), u32 payload length, u8 flags,
+          3 reserved bytes
+  footer  "M5AI", u32 frames, u32 index offset, u32 CRC-32 of the index
+  run-length tokens:
+    0x00..0x7F  (token+1) times the next pixel
+    0x80..0xFF  (token-0x7F) literal pixels
+  pixels: RGB565, 2 bytes each
+
+usage:
+  python3 tools/archive_extract.py burst.m5a out_dir          PNG per frame
+  python3 tools/archive_extract.py burst.m5a --video out.mp4  video (ffmpeg)
+  python3 tools/archive_extract.py burst.m5a --list           frame list
+"""
+import os
+import struct
+import subprocess
+import sys
+import zlib
+from array import array
+
+HEADER = struct.Struct("<4sHHHHHHI12x")
+FRAME = struct.Struct("<4sIIIB3x")
+INDEX = struct.Struct("<IIIB3x")
+FOOTER = struct.Struct("<4sIII")
+DELTA = 0x01
+RLE = 0x02
+
+
+def read_index(data, header_size, pixel_bytes):
+    """frames as (offset, time, length, flags), from the index or by scanning"""
+    if len(data) >= header_size + FOOTER.size:
+        magic, frames, index_offset, index_crc = FOOTER.unpack_from(data, len(data) - FOOTER.size)
+        index_end = index_offset + frames * INDEX.size
+        if magic == b"M5AI" and index_end + FOOTER.size == len(data) and \
+           zlib.crc32(data[index_offset:index_end]) == index_crc:
+            return [INDEX.unpack_from(data, index_offset + i * INDEX.size) for i in range(frames)], True
+    frames = []
+    offset = header_size
+    while offset + FRAME.size <= len(data):
+        magic, _, time_ms, length, flags = FRAME.unpack_from(data, offset)
+        start = offset + FRAME.size
+        if magic != b"FRME" or length > pixel_bytes or start + length + 4 > len(data):
+            break
+        (crc,) = struct.unpack_from("<I", data, start + length)
+        if zlib.crc32(data[start:start + length]) != crc:
+            break
+        frames.append((offset, time_ms, length, flags))
+        offset = start + length + 4
+    return frames, False
+
+
+def decode_payload(payload, flags, pixel_count):
+    if not flags & RLE:
+        pixels = array("H")
+        pixels.frombytes(payload)
+        if sys.byteorder != "little":
+            pixels.byteswap()
+        return pixels
+    pixels = array("H", bytes(2 * pixel_count))
+    i = 0
+    pos = 0
+    while i < pixel_count:
+        token = payload[pos]
+        pos += 1
+        if token < 0x80:
+            value = payload[pos] | payload[pos + 1] << 8
+            pos += 2
+            for k in range(token + 1):
+                pixels[i + k] = value
+            i += token + 1
+        else:
+            count = token - 0x7F
+            for k in range(count):
+                pixels[i + k] = payload[pos] | payload[pos + 1] << 8
+                pos += 2
+            i += count
+    return pixels
+
+
+def frames_rgb(path):
+    """yield (number, time in ms, width, height, RGB888 bytes) for every frame"""
+    data = open(path, "rb").read()
+    magic, version, header_size, width, height, _, _, start_ms = HEADER.unpack_from(data, 0)
+    if magic != b"M5AR":
+        sys.exit("%s: not a capture archive" % path)
+    pixel_count = width * height
+    frames, indexed = read_index(data, header_size, 2 * pixel_count)
+    print("%s: %dx%d, %d frames%s" % (path, width, height, len(frames),
+                                      "" if indexed else " (no index, scanned)"), file=sys.stderr)
+    previous = None
+    for n, (offset, time_ms, length, flags) in enumerate(frames):
+        start = offset + FRAME.size
+        pixels = decode_payload(data[start:start + length], flags, pixel_count)
+        if flags & DELTA:
+            if previous is None:
+                sys.exit("frame %d: delta frame without key frame" % n)
+            pixels = array("H", (a ^ b for a, b in zip(pixels, previous)))
+        previous = pixels
+        rgb = bytearray(3 * pixel_count)
+        for i, c in enumerate(pixels):
+            r, g, b = c >> 11, (c >> 5) & 0x3F, c & 0x1F
+            rgb[3 * i] = (r << 3) | (r >> 2)
+            rgb[3 * i + 1] = (g << 2) | (g >> 4)
+            rgb[3 * i + 2] = (b << 3) | (b >> 2)
+        yield n, time_ms - start_ms, width, height, bytes(rgb)
+
+
+def write_png(path, width, height, rgb):
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+    rows = b"".join(b"\0" + rgb[y * 3 * width:(y + 1) * 3 * width] for y in range(height))
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(rows, 6)))
+        f.write(chunk(b"IEND", b""))
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.exit(__doc__)
+    path = argv[1]
+    if argv[2] == "--list":
+        for n, time_ms, _, _, _ in frames_rgb(path):
+            print("%5d %8d ms" % (n, time_ms))
+    elif argv[2] == "--video" and len(argv) > 3:
+        video = None
+        times = []
+        for n, time_ms, width, height, rgb in frames_rgb(path):
+            times.append(time_ms)
+            if video is None:
+                # fixed 30 fps, the real frame times are printed by --list
+                try:
+                    video = subprocess.Popen(["ffmpeg", "-y", "-loglevel", "error", "-f", "rawvideo",
+                                              "-pix_fmt", "rgb24", "-s", "%dx%d" % (width, height),
+                                              "-r", "30", "-i", "-", "-pix_fmt", "yuv420p", argv[3]],
+                                             stdin=subprocess.PIPE)
+                except OSError:
+                    sys.exit("ffmpeg not found, use the PNG images")
+            video.stdin.write(rgb)
+        if video:
+            video.stdin.close()
+            video.wait()
+        if len(times) > 1:
+            print("average frame interval %.1f ms" % ((times[-1] - times[0]) / (len(times) - 1)),
+                  file=sys.stderr)
+    else:
+        out_dir = argv[2]
+        os.makedirs(out_dir, exist_ok=True)
+        for n, time_ms, width, height, rgb in frames_rgb(path):
+            write_png(os.path.join(out_dir, "frame_%05d_%06dms.png" % (n, time_ms)), width, height, rgb)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
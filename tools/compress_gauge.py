@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+compress_gauge.py
+Compress the gauge background image (src/gauge.h, RGB565, generated by
+ImageConverter 565) into a palette + run-length format (src/gauge_rle.h)
+that is decoded on the fly by src/gauge_bg.cpp.
+
+Format:
+  palette   up to 255 RGB565 colors, sorted by frequency
+  row_index offset of the first token of every row in the data array
+  data      tokens, rows never share a token:
+    0x00..0x7F  run: (token+1) pixels with the color of the next byte
+    0x80..0xFF  literal: (token-0x7F) pixels, one color byte each
+  color byte: index into the palette, 0xFF = escape, followed by the
+              RGB565 value (low byte first)
+
+usage:
+  python3 tools/compress_gauge.py src/gauge.h src/gauge_rle.h
+"""
+import re
+import sys
+from collections import Counter
+
+WIDTH = 320
+HEIGHT = 240
+ESCAPE = 0xFF
+MAX_RUN = 128
+MAX_LITERAL = 128
+
+
+def read_image(path):
+    text = open(path).read()
+    body = text[text.index("{") + 1:text.rindex("}")]
+    body = re.sub(r"//[^\n]*", "", body)
+    pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    if len(pixels) != WIDTH * HEIGHT:
+        sys.exit("unexpected image size: %d pixels" % len(pixels))
+    return pixels
+
+
+def color_bytes(color, index):
+    if color in index:
+        return [index[color]]
+    return [ESCAPE, color & 0xFF, color >> 8]
+
+
+def encode_row(row, index):
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            part = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(0x7F + len(part))
+            for c in part:
+                out.extend(color_bytes(c, index))
+
+    i = 0
+    while i < len(row):
+        n = 1
+        while i + n < len(row) and row[i + n] == row[i] and n < MAX_RUN:
+            n += 1
+        if n >= 2:
+            flush_literal()
+            out.append(n - 1)
+            out.extend(color_bytes(row[i], index))
+        else:
+            literal.append(row[i])
+        i += n
+    flush_literal()
+    return out
+
+
+def decode_row(data, pos, palette):
+    row = []
+    while len(row) < WIDTH:
+        token = data[pos]
+        pos += 1
+        count = token + 1 if token < 0x80 else token - 0x7F
+        for _ in range(1 if token < 0x80 else count):
+            c = data[pos]
+            pos += 1
+            if c == ESCAPE:
+                c = data[pos] | (data[pos + 1] << 8)
+                pos += 2
+            else:
+                c = palette[c]
+            row.extend([c] * (count if token < 0x80 else 1))
+    return row
+
+
+def compress(pixels):
+    palette = [c for c, _ in Counter(pixels).most_common(255)]
+    index = {c: i for i, c in enumerate(palette)}
+    data = []
+    row_index = []
+    for y in range(HEIGHT):
+        row_index.append(len(data))
+        data.extend(encode_row(pixels[y * WIDTH:(y + 1) * WIDTH], index))
+    # check the result before it is written
+    for y in range(HEIGHT):
+        if decode_row(data, row_index[y], palette) != pixels[y * WIDTH:(y + 1) * WIDTH]:
+            sys.exit("verification failed in row %d" % y)
+    return palette, row_index, data
+
+
+def write_header(path, palette, row_index, data):
+    size = len(palette) * 2 + len(row_index) * 4 + len(data)
+    lines = [
+        "// Generated by  : tools/compress_gauge.py from gauge.h",
+        "// Dimensions    : %dx%d pixels" % (WIDTH, HEIGHT),
+        "// Size          : %d Bytes (raw: %d Bytes)" % (size, WIDTH * HEIGHT * 2),
+        "// Format        : palette + run-length, see tools/compress_gauge.py",
+        "",
+        "#include <pgmspace.h>",
+        "",
+        "#define GAUGE_RLE_WIDTH %d" % WIDTH,
+        "#define GAUGE_RLE_HEIGHT %d" % HEIGHT,
+        "",
+        "const unsigned short gauge_rle_palette[%d] PROGMEM ={" % len(palette),
+    ]
+    for i in range(0, len(palette), 16):
+        lines.append("".join("0x%04X, " % c for c in palette[i:i + 16]))
+    lines.append("};")
+    lines.append("")
+    lines.append("const unsigned int gauge_rle_rows[%d] PROGMEM ={" % len(row_index))
+    for i in range(0, len(row_index), 12):
+        lines.append("".join("%d, " % c for c in row_index[i:i + 12]))
+    lines.append("};")
+    lines.append("")
+    lines.append("const unsigned char gauge_rle_data[%d] PROGMEM ={" % len(data))
+    for i in range(0, len(data), 16):
+        lines.append("".join("0x%02X, " % c for c in data[i:i + 16]))
+    lines.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    return size
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    palette, row_index, data = compress(read_image(sys.argv[1]))
+    size = write_header(sys.argv[2], palette, row_index, data)
+    print("%d colors in palette, %d bytes (%.1f%% of raw)"
+          % (len(palette), size, 100.0 * size / (WIDTH * HEIGHT * 2)))
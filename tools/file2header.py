@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+"""
+file2header.py
+Convert a file of the web interface (html, png, jpg, ico, ...) into a
+C header with a PROGMEM byte array, as used by the files in src/.
+
+usage:
+  python3 tools/file2header.py html/index.html index_html src/index.h
+"""
+import sys
+
+
+def convert(data, name):
+    lines = ["#include <pgmspace.h>  // PROGMEM support header", "",
+             "PROGMEM const char %s[]={" % name]
+    for i in range(0, len(data), 16):
+        lines.append("".join("0x%02x, " % b for b in data[i:i + 16]))
+    lines.append("};")
+    return "\r\n".join(lines) + "\r\n"
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+    with open(sys.argv[3], "w", newline="") as f:
+        f.write(convert(data, sys.argv[2]))
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""
+qoi2png.py
+Convert the QOI images of the background transcoding (src/transcode.h,
+*.qoi) to PNG images.
+
+QOI ("Quite OK Image Format", https://qoiformat.org) is lossless: the PNG
+image has the same pixels as the BMP capture it was made from.
+
+usage:
+  python3 tools/qoi2png.py capture.qoi [capture.png]   one image
+  python3 tools/qoi2png.py cap_dir                     every *.qoi in the directory tree
+"""
+import os
+import struct
+import sys
+import zlib
+
+QOI_OP_INDEX = 0x00
+QOI_OP_DIFF = 0x40
+QOI_OP_LUMA = 0x80
+QOI_OP_RUN = 0xC0
+QOI_OP_RGB = 0xFE
+QOI_OP_RGBA = 0xFF
+
+
+def decode_qoi(data):
+    """(width, height, channels, RGB or RGBA bytes) of a QOI image"""
+    magic, width, height, channels, _ = struct.unpack_from(">4sIIBB", data, 0)
+    if magic != b"qoif":
+        raise ValueError("not a QOI image")
+    index = [(0, 0, 0, 0)] * 64
+    r, g, b, a = 0, 0, 0, 255
+    out = bytearray(width * height * channels)
+    pos = 14
+    run = 0
+    for i in range(0, len(out), channels):
+        if run > 0:
+            run -= 1
+        else:
+            op = data[pos]
+            pos += 1
+            if op == QOI_OP_RGB:
+                r, g, b = data[pos], data[pos + 1], data[pos + 2]
+                pos += 3
+            elif op == QOI_OP_RGBA:
+                r, g, b, a = data[pos], data[pos + 1], data[pos + 2], data[pos + 3]
+                pos += 4
+            elif op & 0xC0 == QOI_OP_INDEX:
+                r, g, b, a = index[op]
+            elif op & 0xC0 == QOI_OP_DIFF:
+                r = (r + ((op >> 4) & 3) - 2) & 0xFF
+                g = (g + ((op >> 2) & 3) - 2) & 0xFF
+                b = (b + (op & 3) - 2) & 0xFF
+            elif op & 0xC0 == QOI_OP_LUMA:
+                dg = (op & 0x3F) - 32
+                second = data[pos]
+                pos += 1
+                r = (r + dg + (second >> 4) - 8) & 0xFF
+                g = (g + dg) & 0xFF
+                b = (b + dg + (second & 0x0F) - 8) & 0xFF
+            else:
+                run = op & 0x3F
+            index[(r * 3 + g * 5 + b * 7 + a * 11) % 64] = (r, g, b, a)
+        out[i] = r
+        out[i + 1] = g
+        out[i + 2] = b
+        if channels == 4:
+            out[i + 3] = a
+    return width, height, channels, bytes(out)
+
+
+def write_png(path, width, height, channels, pixels):
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+    row = width * channels
+    rows = b"".join(b"\0" + pixels[y * row:(y + 1) * row] for y in range(height))
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 6 if channels == 4 else 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(rows, 6)))
+        f.write(chunk(b"IEND", b""))
+
+
+def convert(qoi_path, png_path):
+    with open(qoi_path, "rb") as f:
+        width, height, channels, pixels = decode_qoi(f.read())
+    write_png(png_path, width, height, channels, pixels)
+    print("%s -> %s (%dx%d)" % (qoi_path, png_path, width, height))
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit(__doc__)
+    if os.path.isdir(argv[1]):
+        for root, _, files in os.walk(argv[1]):
+            for name in sorted(files):
+                if name.endswith(".qoi"):
+                    path = os.path.join(root, name)
+                    convert(path, path[:-4] + ".png")
+    else:
+        convert(argv[1], argv[2] if len(argv) > 2 else os.path.splitext(argv[1])[0] + ".png")
+
+
+if __name__ == "__main__":
+    main(sys.argv)